@@ -45,6 +45,7 @@
 # USER SET PARAMETERS - COMMENT/UNCOMMENT AS NECESSARY
 
 PROC=1
+# REAL_TYPE CAN BE "DOUBLE", "SINGLE", OR "MIXED" (DOUBLE PRECISION CALCULATIONS WITH SCRATCH ARRAYS STORED IN SINGLE PRECISION)
 REAL_TYPE="DOUBLE"
 #PLANAR="PLANAR"
 #TEST_RUN="TEST_RUN"
@@ -69,6 +70,8 @@ if [ -z $PLANAR ]; then
     if [ -z $TEST_RUN ]; then
         if [ "$REAL_TYPE" == "DOUBLE" ]; then
             CC=mpicc CXX=mpicxx cmake ../../
+        elif [ "$REAL_TYPE" == "MIXED" ]; then
+            CC=mpicc CXX=mpicxx cmake ../../ -DMIXED_PRECISION=ON
         else
             CC=mpicc CXX=mpicxx cmake ../../ -DREAL_SINGLE=ON
         fi
@@ -79,6 +82,8 @@ else
     if [ -z $TEST_RUN ]; then
         if [ "$REAL_TYPE" == "DOUBLE" ]; then
             CC=mpicc CXX=mpicxx cmake ../../ -DPLANAR=ON
+        elif [ "$REAL_TYPE" == "MIXED" ]; then
+            CC=mpicc CXX=mpicxx cmake ../../ -DPLANAR=ON -DMIXED_PRECISION=ON
         else
             CC=mpicc CXX=mpicxx cmake ../../ -DPLANAR=ON -DREAL_SINGLE=ON
         fi
@@ -103,3 +103,16 @@ boundary::boundary(const grid &mesh, field &inField, const int bcWall):
  ********************************************************************************************************************************************
  */
 void boundary::imposeBC() { };
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Prototype function to advance the boundary conditions that evolve in time over a time step
+ *
+ *          Most BCs depend only on the instantaneous field, and do nothing here.
+ *          BCs which are integrated in time, like the convective outflow BC, store the state at the wall at the start of
+ *          each time step or sub-step of the time integration scheme.
+ *
+ * \param   stepSize is the time interval over which the BC will be advanced in the current time step or sub-step
+ ********************************************************************************************************************************************
+ */
+void boundary::advanceBC(const real stepSize) { };
@@ -50,6 +50,9 @@ class boundary {
         boundary(const grid &mesh, field &inField, const int bcWall);
 
         virtual void imposeBC();
+        virtual void advanceBC(const real stepSize);
+
+        virtual ~boundary() { };
 
     protected:
         /** A const reference to the global variables stored in the grid class to access mesh data. */
@@ -181,6 +184,137 @@ class hotPlate: public boundary {
  ********************************************************************************************************************************************
  */
 
+class symmetry: public boundary {
+    public:
+        symmetry(const grid &mesh, field &inField, const int bcWall, const bool normalComp);
+
+        inline void imposeBC();
+    private:
+        /** Sign with which the data is mirrored across the wall: -1 for the component of velocity normal to the wall, and 1 otherwise */
+        const real mirrorSign;
+
+        /** Wall and data slices of all the layers of pads at the wall, from the wall outwards */
+        std::vector<blitz::RectDomain<3> > wallLayers, dataLayers;
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class symmetry boundary.h "lib/boundary/boundary.h"
+ *  \brief The derived class from boundary to apply mirror boundary condition at a plane of symmetry for a cell-centered variable.
+ *
+ ********************************************************************************************************************************************
+ */
+
+class wallModel: public boundary {
+    public:
+        wallModel(const grid &mesh, field &inField, const int bcWall, const field &uField, const field &vField);
+        wallModel(const grid &mesh, field &inField, const int bcWall, const field &uField, const field &vField, const real bcValue);
+
+        void imposeBC();
+    private:
+        /** True when the heat flux is imposed on a scalar field, and false when the shear stress is imposed on a velocity component */
+        const bool scalarFlag;
+
+        /** Value of the scalar field at the wall. It is not used for velocity components */
+        const real fieldValue;
+
+        /** The two components of velocity tangential to the wall, from which the friction velocity is found */
+        const field &uTan, &vTan;
+
+        /** Diffusion constants of velocity and scalar, in the non-dimensionalization used by the solver */
+        real nu, kappa;
+
+        /** Distance of the matching layer from the wall, and the distance between the ghost point and the first point in the core */
+        real hMatch, gDelta;
+
+        /** The number of points by which the view of the wall slice is shifted to reach the matching layer */
+        int matchShift;
+
+        void setWallDistances();
+        real fluxCoefficient(const real uMag) const;
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class wallModel boundary.h "lib/boundary/boundary.h"
+ *  \brief The derived class from boundary to apply the wall shear stress or heat flux of an equilibrium wall model for a cell-centered variable.
+ *
+ ********************************************************************************************************************************************
+ */
+
+class convective: public boundary {
+    public:
+        convective(const grid &mesh, field &inField, const int bcWall, const real cVel);
+
+        void imposeBC();
+        void advanceBC(const real stepSize);
+    private:
+        /** Velocity with which the flow structures are convected out of the domain through the wall */
+        const real convVelocity;
+
+        /** Distance of the first point inside the domain from the wall */
+        real wDelta;
+
+        /** Time interval over which the wall values are advanced, as set at the start of each time step or sub-step */
+        real dtStep;
+
+        /** Values of the field on the wall at the start of the current time step or sub-step */
+        blitz::Array<real, 3> wallData;
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class convective boundary.h "lib/boundary/boundary.h"
+ *  \brief The derived class from boundary to apply convective outflow boundary condition for a cell-centered variable.
+ *
+ ********************************************************************************************************************************************
+ */
+
+class recycle: public boundary {
+    public:
+        recycle(const grid &mesh, field &inField, const int bcWall, const real bulkVel);
+        recycle(const grid &mesh, field &inField, const int bcWall, const recycle &uBC);
+
+        void imposeBC();
+        void advanceBC(const real stepSize);
+
+        ~recycle();
+    private:
+        /** The recycle BC of the streamwise component of velocity, whose communicator and rescaling factor are shared. NULL for the streamwise component */
+        const recycle *uRecycle;
+
+        /** The bulk velocity to be imposed at the inflow */
+        const real bulkVelocity;
+
+        /** Global and local indices of the recycling plane along X, and the rank along X which contains the plane */
+        int recGlobal, recLocal, recRank;
+
+        /** Sub-communicator connecting the inflow sub-domain with the sub-domain containing the recycling plane in each row */
+        MPI_Comm recComm;
+
+        /** Factor by which the recycled plane is rescaled, as computed from the flux of the streamwise component */
+        real scaleFactor;
+
+        /** Number of points on the recycled plane of the sub-domain */
+        int planeSize;
+
+        /** Buffer to send the recycled plane. For the streamwise component, the rescaling factor is appended at the end */
+        std::vector<real> planeBuffer;
+
+        /** Values of the field imposed at the inflow wall */
+        blitz::Array<real, 3> inflowData;
+
+        void initPlane();
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class recycle boundary.h "lib/boundary/boundary.h"
+ *  \brief The derived class from boundary to impose a turbulent inflow recycled and rescaled from a plane within the domain.
+ *
+ ********************************************************************************************************************************************
+ */
+
 class nullBC: public boundary {
     public:
         nullBC(const grid &mesh, field &inField, const int bcWall): boundary(mesh, inField, bcWall) { };
@@ -0,0 +1,146 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file convective.cc
+ *
+ *  \brief Definitions for functions of class boundary
+ *  \sa boundary.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include "boundary.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the convective class
+ *
+ *          The constructor initializes the base boundary class using part of the arguments supplied to it.
+ *          The distance of the first point inside the domain from the wall is computed from the grid, and the array
+ *          to store the values of the field on the wall is allocated.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class.
+ * \param   inField is a reference to the field to which the boundary conditions must be applied.
+ * \param   bcWall is a const integer which specifies the wall to which the BC must be applied.
+ * \param   cVel is the const real value of the velocity with which the field is convected out through the wall.
+ ********************************************************************************************************************************************
+ */
+convective::convective(const grid &mesh, field &inField, const int bcWall, const real cVel):
+                            boundary(mesh, inField, bcWall), convVelocity(cVel) {
+    const blitz::Array<real, 1> &wCoord = (shiftDim == 0)? mesh.x: ((shiftDim == 1)? mesh.y: mesh.z);
+    const real wLen = (shiftDim == 0)? mesh.xLen: ((shiftDim == 1)? mesh.yLen: mesh.zLen);
+
+    wDelta = fabs(wCoord(wallSlice.lbound(shiftDim) + shiftVal) - ((shiftVal > 0)? 0.0: wLen));
+
+    // THE BC REMAINS A ZERO-GRADIENT BC UNTIL IT IS ADVANCED FOR THE FIRST TIME
+    dtStep = 0.0;
+
+    wallData.resize(wallSlice.ubound() - wallSlice.lbound() + 1);
+    wallData.reindexSelf(wallSlice.lbound());
+    wallData = 0.0;
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to advance the convective BC to a new time step or sub-step
+ *
+ *          The values of the field on the wall at the end of the previous step, interpolated from the ghost point and
+ *          the adjacent point inside the domain, are stored as the initial values for the new step.
+ *          The function must be called at the start of each time step, or each sub-step of multi-stage schemes,
+ *          before any of the calls to \ref imposeBC in that step.
+ *
+ * \param   stepSize is the time interval over which the BC will be advanced in the current time step or sub-step
+ ********************************************************************************************************************************************
+ */
+void convective::advanceBC(const real stepSize) {
+    if (rankFlag) {
+        const blitz::TinyVector<int, 3> wLo = wallSlice.lbound();
+        const blitz::TinyVector<int, 3> wHi = wallSlice.ubound();
+
+        for (int iX = wLo(0); iX <= wHi(0); iX++) {
+            for (int iY = wLo(1); iY <= wHi(1); iY++) {
+                for (int iZ = wLo(2); iZ <= wHi(2); iZ++) {
+                    blitz::TinyVector<int, 3> gPoint(iX, iY, iZ);
+                    blitz::TinyVector<int, 3> dPoint(iX, iY, iZ);
+
+                    dPoint(shiftDim) += shiftVal;
+
+                    wallData(gPoint) = 0.5*(dField.F(gPoint) + dField.F(dPoint));
+                }
+            }
+        }
+    }
+
+    dtStep = stepSize;
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to impose convective outflow BC on a cell centered variable
+ *
+ *          The field on the wall is advanced by the convective equation, \f$ \partial f/\partial t + U_c \partial f/\partial n = 0 \f$,
+ *          so that the structures in the flow leave the domain with minimal reflection back into the interior.
+ *          The normal derivative is approximated by an upwind difference between the wall and the first point inside the domain.
+ *          It is integrated implicitly in time using the current values inside the domain, so that repeated calls to
+ *          this function within a step, as done by the iterative solvers, return the same values.
+ *          The ghost point is then set by averaging across the wall as done for the Dirichlet BC.
+ *
+ ********************************************************************************************************************************************
+ */
+inline void convective::imposeBC() {
+    if (rankFlag) {
+        const real cFactor = dtStep*convVelocity/wDelta;
+
+        const blitz::TinyVector<int, 3> wLo = wallSlice.lbound();
+        const blitz::TinyVector<int, 3> wHi = wallSlice.ubound();
+
+        for (int iX = wLo(0); iX <= wHi(0); iX++) {
+            for (int iY = wLo(1); iY <= wHi(1); iY++) {
+                for (int iZ = wLo(2); iZ <= wHi(2); iZ++) {
+                    blitz::TinyVector<int, 3> gPoint(iX, iY, iZ);
+                    blitz::TinyVector<int, 3> dPoint(iX, iY, iZ);
+
+                    dPoint(shiftDim) += shiftVal;
+
+                    if (dtStep > 0.0) {
+                        real wValue = (wallData(gPoint) + cFactor*dField.F(dPoint))/(1.0 + cFactor);
+                        dField.F(gPoint) = 2.0*wValue - dField.F(dPoint);
+                    } else {
+                        dField.F(gPoint) = dField.F(dPoint);
+                    }
+                }
+            }
+        }
+    }
+}
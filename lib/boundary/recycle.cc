@@ -0,0 +1,247 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file recycle.cc
+ *
+ *  \brief Definitions for functions of class boundary
+ *  \sa boundary.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include "boundary.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the recycle class for the streamwise component of velocity
+ *
+ *          The constructor initializes the base boundary class using part of the arguments supplied to it.
+ *          The index of the recycling plane, and the rank along X whose sub-domain contains it are found from the global grid.
+ *          A sub-communicator is then created in each row of sub-domains, which connects the inflow sub-domain with the
+ *          sub-domain containing the recycling plane.
+ *          The communicator, as well as the rescaling factor computed from the flux of this component, are shared with the
+ *          recycle BCs of the other components of velocity.
+ *          Until the inflow is recycled for the first time, a uniform flow with the bulk velocity is imposed.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class.
+ * \param   inField is a reference to the streamwise component of velocity to which the boundary conditions must be applied.
+ * \param   bcWall is a const integer which specifies the wall to which the BC must be applied.
+ * \param   bulkVel is the const real value of the bulk velocity to be imposed at the inflow.
+ ********************************************************************************************************************************************
+ */
+recycle::recycle(const grid &mesh, field &inField, const int bcWall, const real bulkVel):
+                        boundary(mesh, inField, bcWall), uRecycle(NULL), bulkVelocity(bulkVel) {
+    if (wallNum != 0) {
+        if (mesh.rankData.rank == 0) {
+            std::cout << "ERROR: Recycled inflow can be imposed only on the left wall. Aborting" << std::endl;
+        }
+        MPI_Finalize();
+        exit(0);
+    }
+
+    // THE RECYCLING PLANE IS THE FIRST PLANE OF CELL CENTERS AT OR DOWNSTREAM OF THE LOCATION SPECIFIED BY THE USER
+    recGlobal = 0;
+    while ((recGlobal < mesh.globalSize(0)) and (mesh.xGlobal(recGlobal) < mesh.inputParams.recPlane)) recGlobal++;
+
+    if ((recGlobal == 0) or (recGlobal >= mesh.globalSize(0))) {
+        if (mesh.rankData.rank == 0) {
+            std::cout << "ERROR: Recycling plane does not lie within the domain. Aborting" << std::endl;
+        }
+        MPI_Finalize();
+        exit(0);
+    }
+
+    recRank = recGlobal/mesh.coreSize(0);
+    recLocal = recGlobal - recRank*mesh.coreSize(0);
+
+    // ONLY THE INFLOW AND RECYCLING SUB-DOMAINS OF EACH ROW BELONG TO THE SUB-COMMUNICATOR, WITH THE INFLOW SUB-DOMAIN AS ITS FIRST RANK
+    MPI_Comm_split(mesh.rankData.MPI_ROW_COMM, ((mesh.rankData.xRank == 0) or (mesh.rankData.xRank == recRank))? 0: MPI_UNDEFINED,
+                   mesh.rankData.xRank, &recComm);
+
+    scaleFactor = 1.0;
+
+    initPlane();
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the recycle class for the other components of velocity
+ *
+ *          The recycling plane and the sub-communicator are taken from the recycle BC of the streamwise component,
+ *          so that no new communicator is created for these components.
+ *          The rescaling factor is also not computed here, but read from the BC of the streamwise component each time the
+ *          BC is advanced.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class.
+ * \param   inField is a reference to the field to which the boundary conditions must be applied.
+ * \param   bcWall is a const integer which specifies the wall to which the BC must be applied.
+ * \param   uBC is a const reference to the recycle BC of the streamwise component of velocity.
+ ********************************************************************************************************************************************
+ */
+recycle::recycle(const grid &mesh, field &inField, const int bcWall, const recycle &uBC):
+                        boundary(mesh, inField, bcWall), uRecycle(&uBC), bulkVelocity(uBC.bulkVelocity) {
+    if (wallNum != 0) {
+        if (mesh.rankData.rank == 0) {
+            std::cout << "ERROR: Recycled inflow can be imposed only on the left wall. Aborting" << std::endl;
+        }
+        MPI_Finalize();
+        exit(0);
+    }
+
+    recGlobal = uBC.recGlobal;
+    recLocal = uBC.recLocal;
+    recRank = uBC.recRank;
+
+    recComm = uBC.recComm;
+
+    scaleFactor = uBC.scaleFactor;
+
+    initPlane();
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to allocate the buffer used to send the recycled plane, and the values imposed at the inflow
+ *
+ *          Only the buffer of the streamwise component carries the rescaling factor at its end.
+ *          The inflow is initialized to a uniform flow with the bulk velocity.
+ ********************************************************************************************************************************************
+ */
+void recycle::initPlane() {
+    planeSize = (wallSlice.ubound(1) - wallSlice.lbound(1) + 1)*(wallSlice.ubound(2) - wallSlice.lbound(2) + 1);
+    planeBuffer.resize((uRecycle == NULL)? planeSize + 1: planeSize);
+
+    inflowData.resize(wallSlice.ubound() - wallSlice.lbound() + 1);
+    inflowData.reindexSelf(wallSlice.lbound());
+    inflowData = (uRecycle == NULL)? bulkVelocity: 0.0;
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to recycle the inflow from the recycling plane
+ *
+ *          For the streamwise component, the sub-domains containing the recycling plane first compute the bulk velocity
+ *          through the plane, for which a reduction is performed over the column communicator of the sub-domains.
+ *          Following the outer scaling of the velocity by the bulk velocity in a channel of fixed height, the plane
+ *          is rescaled by the ratio of the bulk velocity to be imposed at the inflow to the bulk velocity at the recycling plane.
+ *          This ensures that the recycled inflow carries the specified mass flux, while retaining the turbulent fluctuations.
+ *          The plane, along with the rescaling factor, is then broadcast to the inflow sub-domain through the sub-communicator.
+ *          The other components broadcast only their planes, and use the rescaling factor of the streamwise component.
+ *          Hence the BC of the streamwise component must be advanced first, as is done in \ref vfield#advanceBCs "advanceBCs".
+ *          The function is called at the start of each time step, or each sub-step of multi-stage schemes.
+ *
+ * \param   stepSize is the time interval of the current time step or sub-step, which is not used by this BC
+ ********************************************************************************************************************************************
+ */
+void recycle::advanceBC(const real stepSize) {
+    if (recComm == MPI_COMM_NULL) return;
+
+    const int yLo = wallSlice.lbound(1), yHi = wallSlice.ubound(1);
+    const int zLo = wallSlice.lbound(2), zHi = wallSlice.ubound(2);
+
+    if (mesh.rankData.xRank == recRank) {
+        int bIndex = 0;
+        for (int j = yLo; j <= yHi; j++) {
+            for (int k = zLo; k <= zHi; k++) {
+                planeBuffer[bIndex++] = dField.F(recLocal, j, k);
+            }
+        }
+
+        if (uRecycle == NULL) {
+            real cellArea;
+            real locFlux[2], gloFlux[2];
+
+            locFlux[0] = locFlux[1] = 0.0;
+            for (int j = 0; j < mesh.coreSize(1); j++) {
+                for (int k = 0; k < mesh.coreSize(2); k++) {
+                    cellArea = 1.0/(mesh.et_y(j)*mesh.zt_z(k));
+
+                    locFlux[0] += dField.F(recLocal, j, k)*cellArea;
+                    locFlux[1] += cellArea;
+                }
+            }
+
+            MPI_Allreduce(locFlux, gloFlux, 2, MPI_FP_REAL, MPI_SUM, mesh.rankData.MPI_COL_COMM);
+
+            // THE RESCALING FACTOR IS 1 UNTIL A FLOW HAS DEVELOPED THROUGH THE RECYCLING PLANE
+            planeBuffer[planeSize] = (fabs(gloFlux[0]) > 0.0)? bulkVelocity*gloFlux[1]/gloFlux[0]: 1.0;
+        }
+    }
+
+    MPI_Bcast(&planeBuffer[0], planeBuffer.size(), MPI_FP_REAL, (recRank == 0)? 0: 1, recComm);
+
+    scaleFactor = (uRecycle == NULL)? planeBuffer[planeSize]: uRecycle->scaleFactor;
+
+    if (rankFlag) {
+        int bIndex = 0;
+        for (int j = yLo; j <= yHi; j++) {
+            for (int k = zLo; k <= zHi; k++) {
+                inflowData(wallSlice.lbound(0), j, k) = scaleFactor*planeBuffer[bIndex++];
+            }
+        }
+    }
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to impose the recycled inflow on a cell centered variable
+ *
+ *          As in the Dirichlet BC, the ghost point and adjacent point just inside the domain lie on either side of the wall.
+ *          The value of the variable is hence set through averaging across the wall, using the recycled values at each point.
+ *
+ ********************************************************************************************************************************************
+ */
+inline void recycle::imposeBC() {
+    if (rankFlag) {
+        const int xG = wallSlice.lbound(0);
+
+        for (int j = wallSlice.lbound(1); j <= wallSlice.ubound(1); j++) {
+            for (int k = wallSlice.lbound(2); k <= wallSlice.ubound(2); k++) {
+                dField.F(xG, j, k) = 2.0*inflowData(xG, j, k) - dField.F(xG + 1, j, k);
+            }
+        }
+    }
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Destructor of the recycle class
+ *
+ *          The sub-communicator is freed only by the BC of the streamwise component which created it.
+ *          Hence the BCs of the other components must not be advanced once it is deleted.
+ ********************************************************************************************************************************************
+ */
+recycle::~recycle() {
+    if ((uRecycle == NULL) and (recComm != MPI_COMM_NULL)) MPI_Comm_free(&recComm);
+}
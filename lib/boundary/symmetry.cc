@@ -0,0 +1,86 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file symmetry.cc
+ *
+ *  \brief Definitions for functions of class boundary
+ *  \sa boundary.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include "boundary.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the symmetry class
+ *
+ *          The constructor initializes the base boundary class using part of the arguments supplied to it.
+ *          The slices of all the layers of pads at the wall, and of the layers of the core they mirror, are also set here.
+ *          The layer of pads at a distance of n cells from the wall mirrors the layer of the core at the same distance.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class.
+ * \param   inField is a reference to the field to which the boundary conditions must be applied.
+ * \param   bcWall is a const integer which specifies the wall to which the BC must be applied.
+ * \param   normalComp is a const boolean which is true if the field is the component of velocity normal to the wall.
+ ********************************************************************************************************************************************
+ */
+symmetry::symmetry(const grid &mesh, field &inField, const int bcWall, const bool normalComp):
+                            boundary(mesh, inField, bcWall), mirrorSign(normalComp? -1.0: 1.0) {
+    for (int i = 0; i < mesh.padWidths(shiftDim); i++) {
+        wallLayers.push_back(mesh.shift(shiftDim, wallSlice, -i*shiftVal));
+        dataLayers.push_back(mesh.shift(shiftDim, dataSlice, i*shiftVal));
+    }
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to impose mirror BC on a cell centered variable at a plane of symmetry
+ *
+ *          For Saras solver, all variables are at cell-centers, while the walls pass along
+ *          the faces of the cells.
+ *          At a plane of symmetry, the component of velocity normal to the plane is odd, so that it vanishes on the plane,
+ *          while its tangential components and scalar fields are even, so that their normal derivatives vanish on the plane.
+ *          The first layer of pads hence satisfies either Dirichlet or Neumann BC.
+ *          Unlike these BCs, all the layers of pads are filled by mirroring, so that wider stencils remain valid at the plane.
+ *
+ ********************************************************************************************************************************************
+ */
+inline void symmetry::imposeBC() {
+    if (rankFlag) {
+        for (unsigned int i = 0; i < wallLayers.size(); i++) {
+            dField.F(wallLayers[i]) = mirrorSign*dField.F(dataLayers[i]);
+        }
+    }
+}
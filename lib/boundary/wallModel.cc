@@ -0,0 +1,219 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file wallModel.cc
+ *
+ *  \brief Definitions for functions of class boundary
+ *  \sa boundary.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include "boundary.h"
+
+// VON KARMAN CONSTANT AND INTERCEPT OF THE LOG-LAW, AND THE WALL UNITS AT WHICH THE LOG-LAW MEETS THE LINEAR PROFILE OF THE VISCOUS SUB-LAYER
+static const real vonKarman = 0.41;
+static const real logIntercept = 5.2;
+static const real yPlusLam = 11.06;
+
+// TURBULENT PRANDTL NUMBER USED IN THE THERMAL LAW OF THE WALL
+static const real turbPrandtl = 0.85;
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the wallModel class for a velocity component tangential to the wall
+ *
+ *          The constructor initializes the base boundary class using part of the arguments supplied to it.
+ *          The value of the field at the wall is not used for velocity, and is set to zero.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class.
+ * \param   inField is a reference to the field to which the boundary conditions must be applied.
+ * \param   bcWall is a const integer which specifies the wall to which the BC must be applied.
+ * \param   uField is a const reference to the first component of velocity tangential to the wall.
+ * \param   vField is a const reference to the second component of velocity tangential to the wall.
+ ********************************************************************************************************************************************
+ */
+wallModel::wallModel(const grid &mesh, field &inField, const int bcWall, const field &uField, const field &vField):
+                            boundary(mesh, inField, bcWall), scalarFlag(false), fieldValue(0.0), uTan(uField), vTan(vField) {
+    setWallDistances();
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the wallModel class for a scalar field
+ *
+ *          The constructor initializes the base boundary class using part of the arguments supplied to it.
+ *          The value of the scalar at the wall, denoted by fieldValue, is also set in the initialization list.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class.
+ * \param   inField is a reference to the field to which the boundary conditions must be applied.
+ * \param   bcWall is a const integer which specifies the wall to which the BC must be applied.
+ * \param   uField is a const reference to the first component of velocity tangential to the wall.
+ * \param   vField is a const reference to the second component of velocity tangential to the wall.
+ * \param   bcValue is the const real value of the scalar at the wall.
+ ********************************************************************************************************************************************
+ */
+wallModel::wallModel(const grid &mesh, field &inField, const int bcWall, const field &uField, const field &vField, const real bcValue):
+                            boundary(mesh, inField, bcWall), scalarFlag(true), fieldValue(bcValue), uTan(uField), vTan(vField) {
+    setWallDistances();
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to set the distances and diffusion constants used by the wall model
+ *
+ *          The distance of the matching layer from the wall, and the distance between the ghost point and the
+ *          first point inside the domain are computed from the grid.
+ *          The diffusion constants are set according to the non-dimensionalization used by the \ref timestep class.
+ *
+ ********************************************************************************************************************************************
+ */
+void wallModel::setWallDistances() {
+    const blitz::Array<real, 1> &wCoord = (shiftDim == 0)? mesh.x: ((shiftDim == 1)? mesh.y: mesh.z);
+    const real wLen = (shiftDim == 0)? mesh.xLen: ((shiftDim == 1)? mesh.yLen: mesh.zLen);
+    const int gIndex = wallSlice.lbound(shiftDim);
+
+    // THE MATCHING LAYER IS COUNTED FROM THE LAYER OF THE CORE NEXT TO THE WALL
+    if (mesh.inputParams.wmLayer >= mesh.coreSize(shiftDim)) {
+        if (mesh.rankData.rank == 0) {
+            std::cout << "ERROR: Matching layer of the wall model lies outside the sub-domains adjacent to the wall. Aborting" << std::endl;
+        }
+        MPI_Finalize();
+        exit(0);
+    }
+    matchShift = (mesh.inputParams.wmLayer + 1)*shiftVal;
+
+    hMatch = fabs(wCoord(gIndex + matchShift) - ((shiftVal > 0)? 0.0: wLen));
+    gDelta = fabs(wCoord(gIndex + shiftVal) - wCoord(gIndex));
+
+    nu = kappa = 1.0/mesh.inputParams.Re;
+    if (mesh.inputParams.probType > 4) {
+        switch (mesh.inputParams.rbcType) {
+            case 1: nu = mesh.inputParams.Pr;
+                    kappa = 1.0;
+                break;
+            case 2: nu = sqrt(mesh.inputParams.Pr/mesh.inputParams.Ra);
+                    kappa = 1.0/sqrt(mesh.inputParams.Pr*mesh.inputParams.Ra);
+                break;
+            case 3: nu = 1.0;
+                    kappa = 1.0/mesh.inputParams.Pr;
+                break;
+            case 4: nu = sqrt(mesh.inputParams.Pr/mesh.inputParams.Ra);
+                    kappa = 1.0/sqrt(mesh.inputParams.Pr*mesh.inputParams.Ra);
+                break;
+        }
+    }
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the ratio of wall-normal gradient to the difference of field across the matching layer
+ *
+ *          The friction velocity is found from the tangential velocity at the matching layer by solving the log-law
+ *          with Newton iterations.
+ *          When the matching layer lies within the viscous sub-layer, the linear profile is used instead.
+ *          For velocity, the shear stress at the wall is then \f$ \tau_w = u_\tau^2 \f$, and the wall-normal gradient of
+ *          each tangential component is \f$ (\tau_w/U) u_i/\nu \f$.
+ *          For scalars, the thermal law of the wall is used, with the sub-layer resistance function of Jayatilleke.
+ *          In the laminar limit, both coefficients reduce to \f$ 1/h \f$, and the BC is the same as the Dirichlet BC.
+ *
+ * \param   uMag is the magnitude of tangential velocity at the matching layer
+ *
+ * \return  The ratio of the wall-normal gradient of the field at the wall to the difference between field at matching layer and wall
+ ********************************************************************************************************************************************
+ */
+real wallModel::fluxCoefficient(const real uMag) const {
+    real uTau = sqrt(nu*uMag/hMatch);
+
+    if (hMatch*uTau/nu < yPlusLam) return 1.0/hMatch;
+
+    for (int iterCount = 0; iterCount < 20; iterCount++) {
+        real fVal = uMag/uTau - log(hMatch*uTau/nu)/vonKarman - logIntercept;
+        real fDer = -uMag/(uTau*uTau) - 1.0/(vonKarman*uTau);
+        real uNew = uTau - fVal/fDer;
+
+        if (uNew <= 0.0) uNew = 0.5*uTau;
+        if (fabs(uNew - uTau) < 1.0e-8*uTau) {
+            uTau = uNew;
+            break;
+        }
+        uTau = uNew;
+    }
+
+    if (not scalarFlag) return uTau*uTau/(uMag*nu);
+
+    real prRatio = (nu/kappa)/turbPrandtl;
+    real pFunc = 9.24*(pow(prRatio, 0.75) - 1.0)*(1.0 + 0.28*exp(-0.007*prRatio));
+    real tPlus = turbPrandtl*(uMag/uTau + pFunc);
+
+    return uTau/(kappa*tPlus);
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to impose the wall-modelled BC on a cell centered variable
+ *
+ *          For coarse near-wall grids, the gradient across the wall cannot be resolved, and the Dirichlet BC
+ *          under-predicts the wall shear stress and heat flux.
+ *          Here the wall-normal gradient at the wall is instead computed at each point of the wall from the law of the wall,
+ *          using the tangential velocity at the matching layer.
+ *          The ghost point is then set such that the one-sided difference across the wall yields this gradient.
+ *
+ ********************************************************************************************************************************************
+ */
+inline void wallModel::imposeBC() {
+    if (rankFlag) {
+        const blitz::TinyVector<int, 3> wLo = wallSlice.lbound();
+        const blitz::TinyVector<int, 3> wHi = wallSlice.ubound();
+
+#pragma omp parallel for num_threads(mesh.inputParams.nThreads)
+        for (int iX = wLo(0); iX <= wHi(0); iX++) {
+            for (int iY = wLo(1); iY <= wHi(1); iY++) {
+                for (int iZ = wLo(2); iZ <= wHi(2); iZ++) {
+                    blitz::TinyVector<int, 3> gPoint(iX, iY, iZ);
+                    blitz::TinyVector<int, 3> dPoint(iX, iY, iZ);
+                    blitz::TinyVector<int, 3> mPoint(iX, iY, iZ);
+
+                    dPoint(shiftDim) += shiftVal;
+                    mPoint(shiftDim) += matchShift;
+
+                    real uMag = sqrt(uTan.F(mPoint)*uTan.F(mPoint) + vTan.F(mPoint)*vTan.F(mPoint));
+                    real fCoef = (uMag > 0.0)? fluxCoefficient(uMag): 1.0/hMatch;
+
+                    dField.F(gPoint) = dField.F(dPoint) - gDelta*fCoef*(dField.F(mPoint) - fieldValue);
+                }
+            }
+        }
+    }
+}
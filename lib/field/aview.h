@@ -0,0 +1,138 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file aview.h
+ *
+ *  \brief Class declaration and definition of aview - a non-owning view of blitz array data for stencil kernels
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef AVIEW_H
+#define AVIEW_H
+
+#include <mpi.h>
+#include <iostream>
+#include <blitz/array.h>
+
+#include "parser.h"
+
+/** Helper to obtain the element type of the blitz array viewed by an aview of const data */
+template <typename T> struct aviewBase { typedef T type; };
+template <typename T> struct aviewBase<const T> { typedef T type; };
+
+template <typename T, int rank>
+class aview {
+    private:
+        /** Pointer to the element at index 0 along all dimensions, which may lie inside the pads of the array */
+        T *origin;
+
+        /** Strides of the array along all dimensions. The stride along the last dimension is always 1 */
+        int strides[rank];
+
+    public:
+        /** Lower and upper bounds of the indices of the array, including the pads */
+        blitz::TinyVector<int, rank> lbound, ubound;
+
+        /**
+         ********************************************************************************************************************************************
+         * \brief   Constructor of the aview class
+         *
+         *          The view does not own the data, and remains valid only as long as the blitz array it was made from is neither
+         *          resized nor destroyed.
+         *          The array must be stored with unit stride along its last dimension, as are all the arrays allocated by the
+         *          field and plainsf classes.
+         *
+         * \param   A is the blitz array whose data is to be viewed
+         ********************************************************************************************************************************************
+         */
+        aview(const blitz::Array<typename aviewBase<T>::type, rank> &A): lbound(A.lbound()), ubound(A.ubound()) {
+            if (A.stride(rank - 1) != 1) {
+                std::cout << "ERROR: Array views can be made only from arrays with unit stride along the last dimension. ABORTING" << std::endl;
+                MPI_Finalize();
+                exit(0);
+            }
+
+            origin = const_cast<T *>(A.dataZero());
+            for (int i = 0; i < rank; i++) strides[i] = A.stride(i);
+        }
+
+        /** Stride of the data along a given dimension */
+        inline int stride(const int dim) const { return strides[dim]; }
+
+        /** Access to the data of 1D arrays */
+        inline T &operator()(const int iX) const {
+            return origin[iX];
+        }
+
+        /** Access to the data of 3D arrays */
+        inline T &operator()(const int iX, const int iY, const int iZ) const {
+            return origin[iX*strides[0] + iY*strides[1] + iZ];
+        }
+
+        /**
+         ********************************************************************************************************************************************
+         * \brief   Function to get a pointer to a row of a 3D array along the last dimension
+         *
+         *          The returned pointer points to the element at index 0 of the row, so that it can be indexed directly with the
+         *          indices along Z, including the negative indices of the pads.
+         *          Neighbours along X and Y are reached by adding the strides along the respective dimensions to the index.
+         *
+         * \param   iX is the index of the row along X
+         * \param   iY is the index of the row along Y
+         *
+         * \return  Pointer to the element at index (iX, iY, 0) of the array
+         ********************************************************************************************************************************************
+         */
+        inline T *row(const int iX, const int iY) const {
+            return origin + iX*strides[0] + iY*strides[1];
+        }
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class aview aview.h "lib/aview.h"
+ *  \brief Lightweight view of the data of a blitz array for use in the innermost loops of stencil kernels
+ *
+ *  Element access through blitz arrays and their expression templates carries the overhead of evaluating the storage order,
+ *  base indices and strides of every operand, and many compilers fail to vectorize the resulting loops.
+ *  The aview class holds only a pointer to the data, with the rank fixed at compile-time and the stride along the last
+ *  dimension fixed to 1, so that indexing reduces to a few integer operations that compilers can hoist out of loops.
+ *  The pads of the arrays are addressed with the same indices as in the blitz array, starting from -padWidths.
+ *  Views of read-only data are made by using a const element type, as in aview<const real, 3>.
+ ********************************************************************************************************************************************
+ */
+
+#endif
@@ -0,0 +1,305 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file brick.cc
+ *
+ *  \brief Definitions for functions of class brick - 3D data stored in contiguous cubic blocks
+ *  \sa brick.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include "brick.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the brick class
+ *
+ *          The index range is rounded up to a whole number of bricks along each direction, and the storage for all bricks
+ *          is allocated as a single contiguous vector.
+ *          Points in the rounded up region beyond upBound are never accessed.
+ *
+ * \param   loBound is the lower limit of the index range to be stored, including pads
+ * \param   upBound is the upper limit of the index range to be stored, including pads
+ ********************************************************************************************************************************************
+ */
+brick::brick(const blitz::TinyVector<int, 3> loBound, const blitz::TinyVector<int, 3> upBound): lBound(loBound), uBound(upBound) {
+    nBricks = (uBound - lBound + bSize) >> bShift;
+
+    bStride = bSize*bSize, bSize, 1;
+
+    data.assign(nBricks(0)*nBricks(1)*nBricks(2)*bVolume, 0.0);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to get the part of a region that lies within a given brick
+ *
+ *          The limits are inclusive, and the returned range is empty (hiInd < loInd) if the brick does not overlap the region.
+ *
+ * \param   region is the RectDomain object specifying the region
+ * \param   bInd is the index of the brick
+ * \param   loInd is the lower limit of the overlap, which is written by the function
+ * \param   hiInd is the upper limit of the overlap, which is written by the function
+ ********************************************************************************************************************************************
+ */
+void brick::brickLimits(const blitz::RectDomain<3> &region, const blitz::TinyVector<int, 3> bInd,
+                        blitz::TinyVector<int, 3> &loInd, blitz::TinyVector<int, 3> &hiInd) const {
+    for (int dim = 0; dim < 3; ++dim) {
+        loInd(dim) = std::max(region.lbound(dim), lBound(dim) + bInd(dim)*bSize);
+        hiInd(dim) = std::min(region.ubound(dim), lBound(dim) + bInd(dim)*bSize + bMask);
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to copy data from a blitz array into the brick layout
+ *
+ *          This is used both to fill the entire brick layout, and as the halo kernel to read only the pads
+ *          after they have been updated in the blitz array.
+ *
+ * \param   A is a const reference to the blitz array from which data is copied
+ * \param   region is the RectDomain object specifying the points to be copied
+ ********************************************************************************************************************************************
+ */
+void brick::fromArray(const blitz::Array<real, 3> &A, const blitz::RectDomain<3> &region) {
+    for (int i = region.lbound(0); i <= region.ubound(0); ++i) {
+        for (int j = region.lbound(1); j <= region.ubound(1); ++j) {
+            int p = index(blitz::TinyVector<int, 3>(i, j, region.lbound(2)));
+            for (int k = region.lbound(2); k <= region.ubound(2); ++k) {
+                data[p] = A(i, j, k);
+
+                // MOVE TO THE NEXT BRICK ALONG Z ONLY WHEN THE CURRENT ONE IS EXHAUSTED
+                p = (((k + 1 - lBound(2)) & bMask)? p + 1: index(blitz::TinyVector<int, 3>(i, j, k + 1)));
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to copy data from the brick layout into a blitz array
+ *
+ * \param   A is a reference to the blitz array into which data is copied
+ * \param   region is the RectDomain object specifying the points to be copied
+ ********************************************************************************************************************************************
+ */
+void brick::toArray(blitz::Array<real, 3> &A, const blitz::RectDomain<3> &region) const {
+    for (int i = region.lbound(0); i <= region.ubound(0); ++i) {
+        for (int j = region.lbound(1); j <= region.ubound(1); ++j) {
+            int p = index(blitz::TinyVector<int, 3>(i, j, region.lbound(2)));
+            for (int k = region.lbound(2); k <= region.ubound(2); ++k) {
+                A(i, j, k) = data[p];
+
+                p = (((k + 1 - lBound(2)) & bMask)? p + 1: index(blitz::TinyVector<int, 3>(i, j, k + 1)));
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Halo kernel to read the pads surrounding the core from a blitz array
+ *
+ *          Only the pads adjacent to the six faces of the core are read, since the stencils of the brick class do not use
+ *          the edge and corner pads.
+ *          The pads of the blitz array must have been updated (through MPI transfer and boundary conditions) before the call.
+ *
+ * \param   A is a const reference to the blitz array from which the pads are read
+ * \param   core is the RectDomain object specifying the core of the sub-domain
+ ********************************************************************************************************************************************
+ */
+void brick::readPads(const blitz::Array<real, 3> &A, const blitz::RectDomain<3> &core) {
+    blitz::TinyVector<int, 3> loInd, hiInd;
+
+    for (int dim = 0; dim < 3; ++dim) {
+        loInd = core.lbound();
+        hiInd = core.ubound();
+
+        // PADS ON THE LEFT FACE
+        loInd(dim) = lBound(dim);
+        hiInd(dim) = core.lbound(dim) - 1;
+        fromArray(A, blitz::RectDomain<3>(loInd, hiInd));
+
+        // PADS ON THE RIGHT FACE
+        loInd(dim) = core.ubound(dim) + 1;
+        hiInd(dim) = uBound(dim);
+        fromArray(A, blitz::RectDomain<3>(loInd, hiInd));
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Halo kernel to write the outermost layers of the core into a blitz array
+ *
+ *          The layers written are as thick as the pads, so that the blitz array has all the data needed
+ *          to update the pads of neighbouring sub-domains through MPI transfer.
+ *
+ * \param   A is a reference to the blitz array into which the faces are written
+ * \param   core is the RectDomain object specifying the core of the sub-domain
+ ********************************************************************************************************************************************
+ */
+void brick::writeFaces(blitz::Array<real, 3> &A, const blitz::RectDomain<3> &core) const {
+    blitz::TinyVector<int, 3> loInd, hiInd;
+
+    for (int dim = 0; dim < 3; ++dim) {
+        const int padWidth = core.lbound(dim) - lBound(dim);
+
+        loInd = core.lbound();
+        hiInd = core.ubound();
+
+        // LAYERS ADJACENT TO THE LEFT FACE
+        hiInd(dim) = core.lbound(dim) + padWidth - 1;
+        toArray(A, blitz::RectDomain<3>(loInd, hiInd));
+
+        // LAYERS ADJACENT TO THE RIGHT FACE
+        loInd(dim) = core.ubound(dim) - padWidth + 1;
+        hiInd(dim) = core.ubound(dim);
+        toArray(A, blitz::RectDomain<3>(loInd, hiInd));
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Stencil kernel to compute the derivative of data in brick layout along one direction
+ *
+ *          The derivative is computed using second order central differences on the computational plane and transformed to
+ *          the physical plane using the grid metrics, such that
+ *          out = c2*(f(+1) - 2f + f(-1)) + c1*(f(+1) - f(-1)).
+ *          For first derivatives, c2 is zero and c1 is the metric divided by twice the grid spacing.
+ *          The src and present bricks must have the same index range, and the pads of src must be up-to-date.
+ *
+ * \param   src is a const reference to the brick holding the data to be differentiated
+ * \param   core is the RectDomain object specifying the points at which the derivative is computed
+ * \param   dim is the direction along which the derivative is computed
+ * \param   c1 is the coefficient of the central difference along dim
+ * \param   c2 is the coefficient of the second difference along dim
+ * \param   nThreads is the number of OpenMP threads used by the kernel
+ ********************************************************************************************************************************************
+ */
+void brick::centralDiff(const brick &src, const blitz::RectDomain<3> &core, const int dim,
+                        const blitz::Array<real, 1> &c1, const blitz::Array<real, 1> &c2, const int nThreads) {
+#pragma omp parallel for num_threads(nThreads) collapse(3)
+    for (int bi = 0; bi < nBricks(0); ++bi) {
+        for (int bj = 0; bj < nBricks(1); ++bj) {
+            for (int bk = 0; bk < nBricks(2); ++bk) {
+                blitz::TinyVector<int, 3> loInd, hiInd, ind;
+                int pM, pP;
+
+                brickLimits(core, blitz::TinyVector<int, 3>(bi, bj, bk), loInd, hiInd);
+
+                for (ind(0) = loInd(0); ind(0) <= hiInd(0); ++ind(0)) {
+                    for (ind(1) = loInd(1); ind(1) <= hiInd(1); ++ind(1)) {
+                        ind(2) = loInd(2);
+                        int p = index(ind);
+                        for (; ind(2) <= hiInd(2); ++ind(2), ++p) {
+                            src.neighbours(p, (ind(dim) - lBound(dim)) & bMask, dim, ind, pM, pP);
+
+                            data[p] = c2(ind(dim))*(src.data[pP] - 2.0*src.data[p] + src.data[pM]) +
+                                      c1(ind(dim))*(src.data[pP] - src.data[pM]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Stencil kernel to perform one Jacobi iteration of a 7-point operator on data in brick layout
+ *
+ *          The operator is separable along the three directions, as is the case for the Laplacian on the non-uniform grids
+ *          used by the multigrid solver.
+ *          For each direction, cM and cP are the coefficients of the left and right neighbours, and cD is the contribution
+ *          to the diagonal, so that the updated value is
+ *          out = (sum of cM*f(-1) + cP*f(+1) over all directions - rhs) / (cD(i) + cD(j) + cD(k)).
+ *          The src, rhs and present bricks must have the same index range, and the pads of src must be up-to-date.
+ *
+ * \param   src is a const reference to the brick holding the data from the previous iteration
+ * \param   rhs is a const reference to the brick holding the right-hand side
+ * \param   core is the RectDomain object specifying the points to be updated
+ * \param   cM is the array of coefficients of the left neighbours along each direction
+ * \param   cP is the array of coefficients of the right neighbours along each direction
+ * \param   cD is the array of diagonal coefficients along each direction
+ * \param   nThreads is the number of OpenMP threads used by the kernel
+ ********************************************************************************************************************************************
+ */
+void brick::jacobiSweep(const brick &src, const brick &rhs, const blitz::RectDomain<3> &core,
+                        const blitz::Array<blitz::Array<real, 1>, 1> &cM,
+                        const blitz::Array<blitz::Array<real, 1>, 1> &cP,
+                        const blitz::Array<blitz::Array<real, 1>, 1> &cD, const int nThreads) {
+    const blitz::Array<real, 1> &cMx = cM(0), &cMy = cM(1), &cMz = cM(2);
+    const blitz::Array<real, 1> &cPx = cP(0), &cPy = cP(1), &cPz = cP(2);
+    const blitz::Array<real, 1> &cDx = cD(0), &cDy = cD(1), &cDz = cD(2);
+
+#pragma omp parallel for num_threads(nThreads) collapse(3)
+    for (int bi = 0; bi < nBricks(0); ++bi) {
+        for (int bj = 0; bj < nBricks(1); ++bj) {
+            for (int bk = 0; bk < nBricks(2); ++bk) {
+                blitz::TinyVector<int, 3> loInd, hiInd, ind;
+                int pxM, pxP, pyM, pyP, pzM, pzP;
+
+                brickLimits(core, blitz::TinyVector<int, 3>(bi, bj, bk), loInd, hiInd);
+
+                for (ind(0) = loInd(0); ind(0) <= hiInd(0); ++ind(0)) {
+                    const int iB = (ind(0) - lBound(0)) & bMask;
+                    for (ind(1) = loInd(1); ind(1) <= hiInd(1); ++ind(1)) {
+                        const int jB = (ind(1) - lBound(1)) & bMask;
+
+                        ind(2) = loInd(2);
+                        int p = index(ind);
+                        for (; ind(2) <= hiInd(2); ++ind(2), ++p) {
+                            src.neighbours(p, iB, 0, ind, pxM, pxP);
+                            src.neighbours(p, jB, 1, ind, pyM, pyP);
+                            src.neighbours(p, (ind(2) - lBound(2)) & bMask, 2, ind, pzM, pzP);
+
+                            data[p] = (cMx(ind(0))*src.data[pxM] + cPx(ind(0))*src.data[pxP] +
+                                       cMy(ind(1))*src.data[pyM] + cPy(ind(1))*src.data[pyP] +
+                                       cMz(ind(2))*src.data[pzM] + cPz(ind(2))*src.data[pzP] -
+                                       rhs.data[p]) / (cDx(ind(0)) + cDy(ind(1)) + cDz(ind(2)));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,165 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file brick.h
+ *
+ *  \brief Class declaration of brick - 3D data stored in contiguous cubic blocks
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef BRICK_H
+#define BRICK_H
+
+#include <vector>
+#include <algorithm>
+#include <blitz/array.h>
+
+#include "parser.h"
+
+class brick {
+    private:
+        /** Bricks are cubes of 2^bShift points along each direction, with indices inside a brick obtained using bMask */
+        static const int bShift = 3;
+        static const int bMask = (1 << bShift) - 1;
+
+        /** Number of bricks along each direction needed to cover the index range */
+        blitz::TinyVector<int, 3> nBricks;
+
+        /** Offsets between neighbouring points inside a brick along each direction */
+        blitz::TinyVector<int, 3> bStride;
+
+        std::vector<real> data;
+
+        /**
+         ********************************************************************************************************************************************
+         * \brief   Function to get the positions of the two neighbours of a point along a given direction
+         *
+         *          Neighbours inside the same brick are reached with a fixed stride.
+         *          Only when the point lies on a face of its brick is the full index computed again.
+         *
+         * \param   p is the position of the point in the data vector
+         * \param   l is the index of the point within its brick along the direction dim
+         * \param   dim is the direction along which the neighbours are needed
+         * \param   ind is the index of the point in the array
+         * \param   pM is the position of the left neighbour, which is written by the function
+         * \param   pP is the position of the right neighbour, which is written by the function
+         ********************************************************************************************************************************************
+         */
+        inline void neighbours(const int p, const int l, const int dim, const blitz::TinyVector<int, 3> ind, int &pM, int &pP) const {
+            blitz::TinyVector<int, 3> shift(0, 0, 0);
+            shift(dim) = 1;
+
+            pM = (l > 0)? p - bStride(dim): index(ind - shift);
+            pP = (l < bMask)? p + bStride(dim): index(ind + shift);
+        };
+
+        void brickLimits(const blitz::RectDomain<3> &region, const blitz::TinyVector<int, 3> bInd,
+                         blitz::TinyVector<int, 3> &loInd, blitz::TinyVector<int, 3> &hiInd) const;
+
+    public:
+        /** Edge length of the cubic bricks */
+        static const int bSize = 1 << bShift;
+
+        /** Number of points in each brick */
+        static const int bVolume = bSize*bSize*bSize;
+
+        /** Lower and upper limits of the index range covered by the brick layout, including pads */
+        blitz::TinyVector<int, 3> lBound, uBound;
+
+        brick(const blitz::TinyVector<int, 3> loBound, const blitz::TinyVector<int, 3> upBound);
+
+        /**
+         ********************************************************************************************************************************************
+         * \brief   Function to get the position of a point in the data vector from its index
+         *
+         *          The bricks are stored one after the other in row-major order, and points within a brick are also in row-major order.
+         *
+         * \param   ind is the index of the point, which must lie between lBound and uBound
+         *
+         * \return  The position of the point in the data vector
+         ********************************************************************************************************************************************
+         */
+        inline int index(const blitz::TinyVector<int, 3> ind) const {
+            const int iL = ind(0) - lBound(0);
+            const int jL = ind(1) - lBound(1);
+            const int kL = ind(2) - lBound(2);
+
+            return ((((iL >> bShift)*nBricks(1) + (jL >> bShift))*nBricks(2) + (kL >> bShift)) << (3*bShift)) +
+                   ((((iL & bMask) << bShift) + (jL & bMask)) << bShift) + (kL & bMask);
+        };
+
+        inline real &operator()(const int i, const int j, const int k) {
+            return data[index(blitz::TinyVector<int, 3>(i, j, k))];
+        };
+
+        inline real operator()(const int i, const int j, const int k) const {
+            return data[index(blitz::TinyVector<int, 3>(i, j, k))];
+        };
+
+        void fromArray(const blitz::Array<real, 3> &A, const blitz::RectDomain<3> &region);
+        void toArray(blitz::Array<real, 3> &A, const blitz::RectDomain<3> &region) const;
+
+        void readPads(const blitz::Array<real, 3> &A, const blitz::RectDomain<3> &core);
+        void writeFaces(blitz::Array<real, 3> &A, const blitz::RectDomain<3> &core) const;
+
+        void centralDiff(const brick &src, const blitz::RectDomain<3> &core, const int dim,
+                         const blitz::Array<real, 1> &c1, const blitz::Array<real, 1> &c2, const int nThreads);
+
+        void jacobiSweep(const brick &src, const brick &rhs, const blitz::RectDomain<3> &core,
+                         const blitz::Array<blitz::Array<real, 1>, 1> &cM,
+                         const blitz::Array<blitz::Array<real, 1>, 1> &cP,
+                         const blitz::Array<blitz::Array<real, 1>, 1> &cD, const int nThreads);
+
+        /** Exchange the data of two bricks with identical index ranges without copying */
+        inline void swap(brick &other) { data.swap(other.data); };
+
+        ~brick() { };
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class brick brick.h "lib/brick.h"
+ *  \brief Brick class to store 3D data as contiguous cubic blocks instead of a single row-major array
+ *
+ *  With the row-major storage of blitz arrays, the neighbours of a point along X and Y are a full plane or a full row away in memory.
+ *  The brick layout keeps all neighbours of points within a block of bSize x bSize x bSize points close together,
+ *  improving cache and TLB reuse of stencil operations on large sub-domains.
+ *  The class provides functions to copy data to and from blitz arrays, so that the MPI transfers and boundary conditions
+ *  already written for blitz arrays can be reused, along with stencil kernels that operate directly on the brick layout.
+ ********************************************************************************************************************************************
+ */
+
+#endif
@@ -48,10 +48,8 @@
  *
  *          The constructor assigns values to the two const parameters of the derivative class,
  *          namely <B>grid</B> and <B>F</B>.
- *          It resizes tmpArray, the blitz array used to hold temporary data while calculating
- *          derivatives, computes the factors to be used with blitz stencils, and assigns
- *          the appropriate references to grid derivatives for performing finite-difference
- *          operations on non-uniform grids.
+ *          It computes the factors to be used with the finite-difference stencils, and sets the
+ *          RectDomain objects over which the derivatives are computed.
  *
  * \param   gridData is a const reference to the global data in the grid class
  * \param   F is a reference to the blitz array on which finite-difference operations will be performed
@@ -59,26 +57,27 @@
  */
 
 derivative::derivative(const grid &gridData, const blitz::Array<real, 3> &F): gridData(gridData), F(F) {
-    // TEMPORARY ARRAY TO STORE DERIVATIVES WHEN CALCULATING 2ND ORDER DERIVATIVES
-    tmpArray.resize(F.shape());
-    tmpArray.reindexSelf(F.lbound());
-
-    core = gridData.coreDomain;
+    blitz::TinyVector<int, 3> lb, ub;
 
     // INVERSES OF hx, hy AND hz, WHICH ARE MULTIPLIED TO FINITE-DIFFERENCE STENCILS
     ihx = 1.0/gridData.dXi;         ihx2 = pow(ihx, 2.0);
     ihy = 1.0/gridData.dEt;         ihy2 = pow(ihy, 2.0);
     ihz = 1.0/gridData.dZt;         ihz2 = pow(ihz, 2.0);
 
-    // RANGES OF ARRAY INTO WHICH RESULTS FROM BLITZ STENCIL OPERATORS HAVE TO BE WRITTEN
-    fullRange = blitz::Range::all();
-    xRange = blitz::Range(0, core.ubound(0), 1);
-    yRange = blitz::Range(0, core.ubound(1), 1);
-    zRange = blitz::Range(0, core.ubound(2), 1);
+    // RANGES OF ARRAY INTO WHICH RESULTS FROM FINITE-DIFFERENCE STENCILS HAVE TO BE WRITTEN
+    lb = F.lbound();        lb(0) = 0;
+    ub = F.ubound();        ub(0) = gridData.coreDomain.ubound(0);
+    xCore = blitz::RectDomain<3>(lb, ub);
 
-    setWallRectDomains();
+    lb = F.lbound();        lb(1) = 0;
+    ub = F.ubound();        ub(1) = gridData.coreDomain.ubound(1);
+    yCore = blitz::RectDomain<3>(lb, ub);
 
-    tmpArray = 0.0;
+    lb = F.lbound();        lb(2) = 0;
+    ub = F.ubound();        ub(2) = gridData.coreDomain.ubound(2);
+    zCore = blitz::RectDomain<3>(lb, ub);
+
+    setWallRectDomains();
 
     xfr = (gridData.rankData.xRank == 0)? true: false;
     yfr = (gridData.rankData.yRank == 0)? true: false;
@@ -93,25 +92,23 @@ derivative::derivative(const grid &gridData, const blitz::Array<real, 3> &F): gr
  *
  *          This function must be called using an output array whose shape and size
  *          should be same as that of the field.
- *          It uses blitz stencils to calculate derivatives using central differencing.
+ *          It uses central differencing to calculate derivatives over the core along x,
+ *          and over the full extent of the array along y and z.
  *          
  * \param   outArray is the blitz array into which result will be written.
  ********************************************************************************************************************************************
  */
-void derivative::calcDerivative1_x(blitz::Array<real, 3> outArray) {
+void derivative::calcDerivative1_x(blitz::Array<sreal, 3> outArray) {
     if (gridData.inputParams.dScheme == 1) {
-        outArray(xRange, fullRange, fullRange) = central12n(F, 0);
+        firstDiff<0>(xCore, outArray, gridData.xi_x, ihx, false);
 
     } else if (gridData.inputParams.dScheme == 2) {
-        outArray(xRange, fullRange, fullRange) = central14n(F, 0);
+        firstDiff<0>(xCore, outArray, gridData.xi_x, ihx, true);
 
         // 2ND ORDER CENTRAL DIFFERENCE AT BOUNDARIES
-        if (xfr) outArray(x0Mid) = 0.5*(F(x0Rgt) - F(x0Lft));
-        if (xlr) outArray(x1Mid) = 0.5*(F(x1Rgt) - F(x1Lft));
+        if (xfr) firstDiff<0>(x0Wall, outArray, gridData.xi_x, ihx, false);
+        if (xlr) firstDiff<0>(x1Wall, outArray, gridData.xi_x, ihx, false);
     }
-
-    outArray *= ihx;
-    outArray = gridData.xi_x(i)*outArray(i, j, k);
 }
 
 
@@ -121,25 +118,23 @@ void derivative::calcDerivative1_x(blitz::Array<real, 3> outArray) {
  *
  *          This function must be called using an output array whose shape and size
  *          should be same as that of the field.
- *          It uses blitz stencils to calculate derivatives using central differencing.
+ *          It uses central differencing to calculate derivatives over the core along y,
+ *          and over the full extent of the array along x and z.
  *          
  * \param   outArray is the blitz array into which result will be written.
  ********************************************************************************************************************************************
  */
-void derivative::calcDerivative1_y(blitz::Array<real, 3> outArray) {
+void derivative::calcDerivative1_y(blitz::Array<sreal, 3> outArray) {
     if (gridData.inputParams.dScheme == 1) {
-        outArray(fullRange, yRange, fullRange) = central12n(F, 1);
+        firstDiff<1>(yCore, outArray, gridData.et_y, ihy, false);
 
     } else if (gridData.inputParams.dScheme == 2) {
-        outArray(fullRange, yRange, fullRange) = central14n(F, 1);
+        firstDiff<1>(yCore, outArray, gridData.et_y, ihy, true);
 
         // 2ND ORDER CENTRAL DIFFERENCE AT BOUNDARIES
-        if (yfr) outArray(y0Mid) = 0.5*(F(y0Rgt) - F(y0Lft));
-        if (ylr) outArray(y1Mid) = 0.5*(F(y1Rgt) - F(y1Lft));
+        if (yfr) firstDiff<1>(y0Wall, outArray, gridData.et_y, ihy, false);
+        if (ylr) firstDiff<1>(y1Wall, outArray, gridData.et_y, ihy, false);
     }
-
-    outArray *= ihy;
-    outArray = gridData.et_y(j)*outArray(i, j, k);
 }
 
 
@@ -149,25 +144,23 @@ void derivative::calcDerivative1_y(blitz::Array<real, 3> outArray) {
  *
  *          This function must be called using an output array whose shape and size
  *          should be same as that of the field.
- *          It uses blitz stencils to calculate derivatives using central differencing.
+ *          It uses central differencing to calculate derivatives over the core along z,
+ *          and over the full extent of the array along x and y.
  *          
  * \param   outArray is the blitz array into which result will be written.
  ********************************************************************************************************************************************
  */
-void derivative::calcDerivative1_z(blitz::Array<real, 3> outArray) {
+void derivative::calcDerivative1_z(blitz::Array<sreal, 3> outArray) {
     if (gridData.inputParams.dScheme == 1) {
-        outArray(fullRange, fullRange, zRange) = central12n(F, 2);
+        firstDiff<2>(zCore, outArray, gridData.zt_z, ihz, false);
 
     } else if (gridData.inputParams.dScheme == 2) {
-        outArray(fullRange, fullRange, zRange) = central14n(F, 2);
+        firstDiff<2>(zCore, outArray, gridData.zt_z, ihz, true);
 
         // 2ND ORDER CENTRAL DIFFERENCE AT BOUNDARIES
-        outArray(z0Mid) = 0.5*(F(z0Rgt) - F(z0Lft));
-        outArray(z1Mid) = 0.5*(F(z1Rgt) - F(z1Lft));
+        firstDiff<2>(z0Wall, outArray, gridData.zt_z, ihz, false);
+        firstDiff<2>(z1Wall, outArray, gridData.zt_z, ihz, false);
     }
-
-    outArray *= ihz;
-    outArray = gridData.zt_z(k)*outArray(i, j, k);
 }
 
 
@@ -177,35 +170,23 @@ void derivative::calcDerivative1_z(blitz::Array<real, 3> outArray) {
  *
  *          This function must be called using an output array whose shape and size
  *          should be same as that of the field.
- *          It uses blitz stencils to calculate derivatives using central differencing.
+ *          It uses central differencing to calculate derivatives over the core along x,
+ *          and over the full extent of the array along y and z.
  *          
  * \param   outArray is the blitz array into which result will be written.
  ********************************************************************************************************************************************
  */
-void derivative::calcDerivative2xx(blitz::Array<real, 3> outArray) {
+void derivative::calcDerivative2xx(blitz::Array<sreal, 3> outArray) {
     if (gridData.inputParams.dScheme == 1) {
-        tmpArray(xRange, fullRange, fullRange) = central12n(F, 0);
-        outArray(xRange, fullRange, fullRange) = central22n(F, 0);
+        secondDiff<0>(xCore, outArray, gridData.xixx, gridData.xix2, ihx, ihx2, false);
 
     } else if (gridData.inputParams.dScheme == 2) {
-        tmpArray(xRange, fullRange, fullRange) = central14n(F, 0);
-        outArray(xRange, fullRange, fullRange) = central24n(F, 0);
+        secondDiff<0>(xCore, outArray, gridData.xixx, gridData.xix2, ihx, ihx2, true);
 
         // 2ND ORDER CENTRAL DIFFERENCE AT BOUNDARIES
-        if (xfr) {
-            tmpArray(x0Mid) = 0.5*(F(x0Rgt) - F(x0Lft));
-            outArray(x0Mid) = F(x0Rgt) - 2.0*F(x0Mid) + F(x0Lft);
-        }
-        if (xlr) {
-            tmpArray(x1Mid) = 0.5*(F(x1Rgt) - F(x1Lft));
-            outArray(x1Mid) = F(x1Rgt) - 2.0*F(x1Mid) + F(x1Lft);
-        }
+        if (xfr) secondDiff<0>(x0Wall, outArray, gridData.xixx, gridData.xix2, ihx, ihx2, false);
+        if (xlr) secondDiff<0>(x1Wall, outArray, gridData.xixx, gridData.xix2, ihx, ihx2, false);
     }
-
-    tmpArray *= ihx;
-    outArray *= ihx2;
-
-    outArray = gridData.xixx(i)*tmpArray(i, j, k) + gridData.xix2(i)*outArray(i, j, k);
 }
 
 
@@ -215,35 +196,23 @@ void derivative::calcDerivative2xx(blitz::Array<real, 3> outArray) {
  *
  *          This function must be called using an output array whose shape and size
  *          should be same as that of the field.
- *          It uses blitz stencils to calculate derivatives using central differencing.
+ *          It uses central differencing to calculate derivatives over the core along y,
+ *          and over the full extent of the array along x and z.
  *          
  * \param   outArray is the blitz array into which result will be written.
  ********************************************************************************************************************************************
  */
-void derivative::calcDerivative2yy(blitz::Array<real, 3> outArray) {
+void derivative::calcDerivative2yy(blitz::Array<sreal, 3> outArray) {
     if (gridData.inputParams.dScheme == 1) {
-        tmpArray(fullRange, yRange, fullRange) = central12n(F, 1);
-        outArray(fullRange, yRange, fullRange) = central22n(F, 1);
+        secondDiff<1>(yCore, outArray, gridData.etyy, gridData.ety2, ihy, ihy2, false);
 
     } else if (gridData.inputParams.dScheme == 2) {
-        tmpArray(fullRange, yRange, fullRange) = central14n(F, 1);
-        outArray(fullRange, yRange, fullRange) = central24n(F, 1);
+        secondDiff<1>(yCore, outArray, gridData.etyy, gridData.ety2, ihy, ihy2, true);
 
         // 2ND ORDER CENTRAL DIFFERENCE AT BOUNDARIES
-        if (yfr) {
-            tmpArray(y0Mid) = 0.5*(F(y0Rgt) - F(y0Lft));
-            outArray(y0Mid) = F(y0Rgt) - 2.0*F(y0Mid) + F(y0Lft);
-        }
-        if (ylr) {
-            tmpArray(y1Mid) = 0.5*(F(y1Rgt) - F(y1Lft));
-            outArray(y1Mid) = F(y1Rgt) - 2.0*F(y1Mid) + F(y1Lft);
-        }
+        if (yfr) secondDiff<1>(y0Wall, outArray, gridData.etyy, gridData.ety2, ihy, ihy2, false);
+        if (ylr) secondDiff<1>(y1Wall, outArray, gridData.etyy, gridData.ety2, ihy, ihy2, false);
     }
-
-    tmpArray *= ihy;
-    outArray *= ihy2;
-
-    outArray = gridData.etyy(j)*tmpArray(i, j, k) + gridData.ety2(j)*outArray(i, j, k);
 }
 
 
@@ -253,32 +222,134 @@ void derivative::calcDerivative2yy(blitz::Array<real, 3> outArray) {
  *
  *          This function must be called using an output array whose shape and size
  *          should be same as that of the field.
- *          It uses blitz stencils to calculate derivatives using central differencing.
+ *          It uses central differencing to calculate derivatives over the core along z,
+ *          and over the full extent of the array along x and y.
  *          
  * \param   outArray is the blitz array into which result will be written.
  ********************************************************************************************************************************************
  */
-void derivative::calcDerivative2zz(blitz::Array<real, 3> outArray) {
+void derivative::calcDerivative2zz(blitz::Array<sreal, 3> outArray) {
     if (gridData.inputParams.dScheme == 1) {
-        tmpArray(fullRange, fullRange, zRange) = central12n(F, 2);
-        outArray(fullRange, fullRange, zRange) = central22n(F, 2);
+        secondDiff<2>(zCore, outArray, gridData.ztzz, gridData.ztz2, ihz, ihz2, false);
 
     } else if (gridData.inputParams.dScheme == 2) {
-        tmpArray(fullRange, fullRange, zRange) = central14n(F, 2);
-        outArray(fullRange, fullRange, zRange) = central24n(F, 2);
+        secondDiff<2>(zCore, outArray, gridData.ztzz, gridData.ztz2, ihz, ihz2, true);
 
         // 2ND ORDER CENTRAL DIFFERENCE AT BOUNDARIES
-        tmpArray(z0Mid) = 0.5*(F(z0Rgt) - F(z0Lft));
-        outArray(z0Mid) = F(z0Rgt) - 2.0*F(z0Mid) + F(z0Lft);
+        secondDiff<2>(z0Wall, outArray, gridData.ztzz, gridData.ztz2, ihz, ihz2, false);
+        secondDiff<2>(z1Wall, outArray, gridData.ztzz, gridData.ztz2, ihz, ihz2, false);
+    }
+}
+
 
-        tmpArray(z1Mid) = 0.5*(F(z1Rgt) - F(z1Lft));
-        outArray(z1Mid) = F(z1Rgt) - 2.0*F(z1Mid) + F(z1Lft);
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the first derivative along a given direction over a specified region of the array
+ *
+ *          The finite-difference stencil is applied through views of the arrays, and the grid derivative for non-uniform
+ *          grids is multiplied in the same loop, so that the output array is written only once.
+ *          The direction of the derivative is a template parameter so that the index into the grid derivative array is
+ *          resolved at compile-time.
+ *          
+ * \param   region is the RectDomain object over which the derivative is computed
+ * \param   outArray is the blitz array into which result will be written
+ * \param   metric is the 1D array of first grid derivatives along the direction of the derivative
+ * \param   ih is the inverse of the grid spacing in the transformed plane along the direction of the derivative
+ * \param   fourth is the flag to use 4th order stencil instead of 2nd order stencil
+ ********************************************************************************************************************************************
+ */
+template <int dim>
+void derivative::firstDiff(const blitz::RectDomain<3> &region, blitz::Array<sreal, 3> &outArray,
+                           const blitz::Array<real, 1> &metric, const real ih, const bool fourth) {
+    const aview<const real, 3> f(F);
+    const aview<sreal, 3> d(outArray);
+    const aview<const real, 1> m(metric);
+
+    const int s1 = f.stride(dim);
+    const int s2 = 2*s1;
+
+    const int zLo = region.lbound(2);
+    const int zHi = region.ubound(2);
+
+#pragma omp parallel for num_threads(gridData.inputParams.nThreads)
+    for (int iX = region.lbound(0); iX <= region.ubound(0); iX++) {
+        for (int iY = region.lbound(1); iY <= region.ubound(1); iY++) {
+            const real *fRow = f.row(iX, iY);
+            sreal *dRow = d.row(iX, iY);
+
+            if (fourth) {
+                for (int iZ = zLo; iZ <= zHi; iZ++) {
+                    const real mFac = ih*m(dim == 0? iX: (dim == 1? iY: iZ));
+
+                    dRow[iZ] = mFac*(8.0*(fRow[iZ + s1] - fRow[iZ - s1]) - (fRow[iZ + s2] - fRow[iZ - s2]))/12.0;
+                }
+            } else {
+                for (int iZ = zLo; iZ <= zHi; iZ++) {
+                    const real mFac = ih*m(dim == 0? iX: (dim == 1? iY: iZ));
+
+                    dRow[iZ] = mFac*0.5*(fRow[iZ + s1] - fRow[iZ - s1]);
+                }
+            }
+        }
     }
+}
 
-    tmpArray *= ihz;
-    outArray *= ihz2;
 
-    outArray = gridData.ztzz(k)*tmpArray(i, j, k) + gridData.ztz2(k)*outArray(i, j, k);
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the second derivative along a given direction over a specified region of the array
+ *
+ *          On non-uniform grids, the second derivative has contributions from both the first and second derivatives
+ *          in the transformed plane.
+ *          Both are computed from the same stencil points in a single loop, so that no temporary array is needed.
+ *          
+ * \param   region is the RectDomain object over which the derivative is computed
+ * \param   outArray is the blitz array into which result will be written
+ * \param   mLin is the 1D array of grid derivatives multiplying the first derivative in the transformed plane
+ * \param   mSqr is the 1D array of grid derivatives multiplying the second derivative in the transformed plane
+ * \param   ih is the inverse of the grid spacing in the transformed plane along the direction of the derivative
+ * \param   ih2 is the square of ih
+ * \param   fourth is the flag to use 4th order stencil instead of 2nd order stencil
+ ********************************************************************************************************************************************
+ */
+template <int dim>
+void derivative::secondDiff(const blitz::RectDomain<3> &region, blitz::Array<sreal, 3> &outArray,
+                            const blitz::Array<real, 1> &mLin, const blitz::Array<real, 1> &mSqr,
+                            const real ih, const real ih2, const bool fourth) {
+    const aview<const real, 3> f(F);
+    const aview<sreal, 3> d(outArray);
+    const aview<const real, 1> m1(mLin);
+    const aview<const real, 1> m2(mSqr);
+
+    const int s1 = f.stride(dim);
+    const int s2 = 2*s1;
+
+    const int zLo = region.lbound(2);
+    const int zHi = region.ubound(2);
+
+#pragma omp parallel for num_threads(gridData.inputParams.nThreads)
+    for (int iX = region.lbound(0); iX <= region.ubound(0); iX++) {
+        for (int iY = region.lbound(1); iY <= region.ubound(1); iY++) {
+            const real *fRow = f.row(iX, iY);
+            sreal *dRow = d.row(iX, iY);
+
+            if (fourth) {
+                for (int iZ = zLo; iZ <= zHi; iZ++) {
+                    const int iM = dim == 0? iX: (dim == 1? iY: iZ);
+
+                    dRow[iZ] = m1(iM)*ih*(8.0*(fRow[iZ + s1] - fRow[iZ - s1]) - (fRow[iZ + s2] - fRow[iZ - s2]))/12.0 +
+                               m2(iM)*ih2*(16.0*(fRow[iZ + s1] + fRow[iZ - s1]) - (fRow[iZ + s2] + fRow[iZ - s2]) - 30.0*fRow[iZ])/12.0;
+                }
+            } else {
+                for (int iZ = zLo; iZ <= zHi; iZ++) {
+                    const int iM = dim == 0? iX: (dim == 1? iY: iZ);
+
+                    dRow[iZ] = m1(iM)*ih*0.5*(fRow[iZ + s1] - fRow[iZ - s1]) +
+                               m2(iM)*ih2*(fRow[iZ + s1] - 2.0*fRow[iZ] + fRow[iZ - s1]);
+                }
+            }
+        }
+    }
 }
 
 
@@ -289,7 +360,7 @@ void derivative::calcDerivative2zz(blitz::Array<real, 3> outArray) {
  *          When using 4th order stencil, derivatives at the boundaries need to be recomputed with second order schemes.
  *          This is to avoid spurious input from ghost points (because the BCs are applied only at the ghost points
  *          next to the boundary and not the ones beyond).
- *          These RectDomain objects can be used to compute these derivatives quickly after using the 4th order stencils.
+ *          These RectDomain objects span the planes at the boundaries, over which the derivatives are recomputed.
  *          
  ********************************************************************************************************************************************
  */
@@ -298,39 +369,27 @@ void derivative::setWallRectDomains() {
 
     lb = F.lbound();        lb(0) = 0;
     ub = F.ubound();        ub(0) = 0;
-    x0Mid = blitz::RectDomain<3>(lb, ub);
-    x0Lft = x0Mid;      x0Lft.lbound()(0) -= 1;      x0Lft.ubound()(0) -= 1;
-    x0Rgt = x0Mid;      x0Rgt.lbound()(0) += 1;      x0Rgt.ubound()(0) += 1;
+    x0Wall = blitz::RectDomain<3>(lb, ub);
 
-    lb = F.lbound();        lb(0) = core.ubound(0);
-    ub = F.ubound();                ub(0) = core.ubound(0);
-    x1Mid = blitz::RectDomain<3>(lb, ub);
-    x1Lft = x1Mid;      x1Lft.lbound()(0) -= 1;      x1Lft.ubound()(0) -= 1;
-    x1Rgt = x1Mid;      x1Rgt.lbound()(0) += 1;      x1Rgt.ubound()(0) += 1;
+    lb = F.lbound();        lb(0) = gridData.coreDomain.ubound(0);
+    ub = F.ubound();        ub(0) = gridData.coreDomain.ubound(0);
+    x1Wall = blitz::RectDomain<3>(lb, ub);
 
 
     lb = F.lbound();        lb(1) = 0;
     ub = F.ubound();        ub(1) = 0;
-    y0Mid = blitz::RectDomain<3>(lb, ub);
-    y0Lft = y0Mid;      y0Lft.lbound()(1) -= 1;      y0Lft.ubound()(1) -= 1;
-    y0Rgt = y0Mid;      y0Rgt.lbound()(1) += 1;      y0Rgt.ubound()(1) += 1;
+    y0Wall = blitz::RectDomain<3>(lb, ub);
 
-    lb = F.lbound();        lb(1) = core.ubound(1);
-    ub = F.ubound();        ub(1) = core.ubound(1);
-    y1Mid = blitz::RectDomain<3>(lb, ub);
-    y1Lft = y1Mid;      y1Lft.lbound()(1) -= 1;      y1Lft.ubound()(1) -= 1;
-    y1Rgt = y1Mid;      y1Rgt.lbound()(1) += 1;      y1Rgt.ubound()(1) += 1;
+    lb = F.lbound();        lb(1) = gridData.coreDomain.ubound(1);
+    ub = F.ubound();        ub(1) = gridData.coreDomain.ubound(1);
+    y1Wall = blitz::RectDomain<3>(lb, ub);
 
 
     lb = F.lbound();        lb(2) = 0;
     ub = F.ubound();        ub(2) = 0;
-    z0Mid = blitz::RectDomain<3>(lb, ub);
-    z0Lft = z0Mid;      z0Lft.lbound()(2) -= 1;      z0Lft.ubound()(2) -= 1;
-    z0Rgt = z0Mid;      z0Rgt.lbound()(2) += 1;      z0Rgt.ubound()(2) += 1;
-
-    lb = F.lbound();        lb(2) = core.ubound(2);
-    ub = F.ubound();        ub(2) = core.ubound(2);
-    z1Mid = blitz::RectDomain<3>(lb, ub);
-    z1Lft = z1Mid;      z1Lft.lbound()(2) -= 1;      z1Lft.ubound()(2) -= 1;
-    z1Rgt = z1Mid;      z1Rgt.lbound()(2) += 1;      z1Rgt.ubound()(2) += 1;
+    z0Wall = blitz::RectDomain<3>(lb, ub);
+
+    lb = F.lbound();        lb(2) = gridData.coreDomain.ubound(2);
+    ub = F.ubound();        ub(2) = gridData.coreDomain.ubound(2);
+    z1Wall = blitz::RectDomain<3>(lb, ub);
 }
@@ -48,6 +48,7 @@
 #include <blitz/array/stencilops.h>
 
 #include "grid.h"
+#include "aview.h"
 
 class derivative {
     private: 
@@ -61,38 +62,35 @@ class derivative {
         real ihx, ihy, ihz;
         real ihx2, ihy2, ihz2;
 
-        blitz::firstIndex i;
-        blitz::secondIndex j;
-        blitz::thirdIndex k;    
+        /** RectDomain objects over which derivatives are computed - the core along the direction of derivative and the full extent along the others */
+        blitz::RectDomain<3> xCore, yCore, zCore;
 
-        blitz::RectDomain<3> core;
+        /** RectDomain objects for the planes at the walls, where 2nd order derivatives are used with the 4th order scheme */
+        blitz::RectDomain<3> x0Wall, x1Wall;
+        blitz::RectDomain<3> y0Wall, y1Wall;
+        blitz::RectDomain<3> z0Wall, z1Wall;
 
-        blitz::RectDomain<3> x0Lft, x0Mid, x0Rgt;
-        blitz::RectDomain<3> x1Lft, x1Mid, x1Rgt;
-
-        blitz::RectDomain<3> y0Lft, y0Mid, y0Rgt;
-        blitz::RectDomain<3> y1Lft, y1Mid, y1Rgt;
-
-        blitz::RectDomain<3> z0Lft, z0Mid, z0Rgt;
-        blitz::RectDomain<3> z1Lft, z1Mid, z1Rgt;
-
-        blitz::Range fullRange;
-        blitz::Range xRange, yRange, zRange;
+        void setWallRectDomains();
 
-        blitz::Array<real, 3> tmpArray;
+        template <int dim>
+        void firstDiff(const blitz::RectDomain<3> &region, blitz::Array<sreal, 3> &outArray,
+                       const blitz::Array<real, 1> &metric, const real ih, const bool fourth);
 
-        void setWallRectDomains();
+        template <int dim>
+        void secondDiff(const blitz::RectDomain<3> &region, blitz::Array<sreal, 3> &outArray,
+                        const blitz::Array<real, 1> &mLin, const blitz::Array<real, 1> &mSqr,
+                        const real ih, const real ih2, const bool fourth);
 
     public:
         derivative(const grid &gridData, const blitz::Array<real, 3> &F);
 
-        void calcDerivative1_x(blitz::Array<real, 3> outArray);
-        void calcDerivative1_y(blitz::Array<real, 3> outArray);
-        void calcDerivative1_z(blitz::Array<real, 3> outArray);
+        void calcDerivative1_x(blitz::Array<sreal, 3> outArray);
+        void calcDerivative1_y(blitz::Array<sreal, 3> outArray);
+        void calcDerivative1_z(blitz::Array<sreal, 3> outArray);
 
-        void calcDerivative2xx(blitz::Array<real, 3> outArray);
-        void calcDerivative2yy(blitz::Array<real, 3> outArray);
-        void calcDerivative2zz(blitz::Array<real, 3> outArray);
+        void calcDerivative2xx(blitz::Array<sreal, 3> outArray);
+        void calcDerivative2yy(blitz::Array<sreal, 3> outArray);
+        void calcDerivative2zz(blitz::Array<sreal, 3> outArray);
 };
 
 /**
@@ -69,17 +69,19 @@ field::field(const grid &gridData, std::string fieldName): gridData(gridData)
     fSize = gridData.fullSize;
     flBound = gridData.fullDomain.lbound();
 
-    F.resize(fSize);
-    F.reindexSelf(flBound);
+    grid::allocPadded(F, fSize, flBound, gridData.allocPads);
 
-    mpiHandle = new mpidata(F, gridData.rankData);
+    mpiHandle = new mpidata(F, gridData.rankData, "Halo " + fieldName);
+
+    maxSite = gridData.rankData.registerSite("Reduce field::fieldMax");
 
     core = gridData.coreDomain;
     cuBound = core.ubound();
 
     setWallSlices();
 
-    mpiHandle->createSubarrays(fSize, cuBound + 1, gridData.padWidths);
+    // THE SUB-ARRAYS ARE DEFINED WITHIN THE PADDED STORAGE OF THE ARRAY
+    mpiHandle->createSubarrays(fSize + gridData.allocPads, cuBound + 1, gridData.padWidths);
 
     F = 0.0;
 }
@@ -162,6 +164,29 @@ void field::syncData() {
 }
 
 
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to start the synchronisation of data across all processors
+ *
+ *          This function calls the \ref mpidata#syncStart "syncStart" function of mpidata class.
+ *          The field must not be modified, and its pads must not be read, till \ref syncFinish is called.
+ ********************************************************************************************************************************************
+ */
+void field::syncStart() {
+    mpiHandle->syncStart();
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to wait for the synchronisation started by \ref syncStart to complete
+ ********************************************************************************************************************************************
+ */
+void field::syncFinish() {
+    mpiHandle->syncFinish();
+}
+
+
 /**
  ********************************************************************************************************************************************
  * \brief   Function to extract the maximum value from the field
@@ -186,7 +211,7 @@ real field::fieldMax() {
      * Check Ref. [2] in README for explanation.                                                                   *
      ***************************************************************************************************************/
 
-    MPI_Allreduce(&localMax, &globalMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+    gridData.rankData.allReduce(&localMax, &globalMax, 1, MPI_MAX, maxSite);
 
     return globalMax;
 }
@@ -54,6 +54,9 @@ class field {
 
         blitz::RectDomain<3> core;
 
+        /** Counter of the profiler under which the global reduction of the field is recorded. It is NULL when profiling is disabled */
+        commprof::counter *maxSite;
+
     public:
         /** The field data is stored in this Blitz array */
         blitz::Array<real, 3> F;
@@ -71,6 +74,8 @@ class field {
         field(const grid &gridData, std::string fieldName);
 
         void syncData();
+        void syncStart();
+        void syncFinish();
 
         real fieldMax();
 
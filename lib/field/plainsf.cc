@@ -60,19 +60,21 @@ plainsf::plainsf(const grid &gridData): gridData(gridData) {
     blitz::TinyVector<int, 3> dSize = gridData.fullDomain.ubound() - gridData.fullDomain.lbound() + 1;
     blitz::TinyVector<int, 3> dlBnd = gridData.fullDomain.lbound();
 
-    F.resize(dSize);
-    F.reindexSelf(dlBnd);
+    grid::allocPadded(F, dSize, dlBnd, gridData.allocPads);
     F = 0.0;
 
     derS = new derivative(gridData, F);
 
-    derivTemp.resize(dSize);
-    derivTemp.reindexSelf(dlBnd);
+    grid::allocPadded(derivTemp, dSize, dlBnd, gridData.allocPads);
 
     core = gridData.coreDomain;
 
-    mpiHandle = new mpidata(F, gridData.rankData);
-    mpiHandle->createSubarrays(dSize, core.ubound() + 1, gridData.padWidths);
+    mpiHandle = new mpidata(F, gridData.rankData, "Halo plainsf");
+    mpiHandle->createSubarrays(dSize + gridData.allocPads, core.ubound() + 1, gridData.padWidths);
+
+    maxSite = gridData.rankData.registerSite("Reduce plainsf::fxMax");
+    absSite = gridData.rankData.registerSite("Reduce plainsf::fxMaxAbs");
+    meanSite = gridData.rankData.registerSite("Reduce plainsf::fxMean");
 }
 
 /**
@@ -50,13 +50,16 @@ class plainsf {
     private:
         const grid &gridData;
 
-        blitz::Array<real, 3> derivTemp;
+        blitz::Array<sreal, 3> derivTemp;
 
         blitz::RectDomain<3> core;
 
         /** derS is an instance of the derivative class used to compute derivatives */
         derivative *derS;
 
+        /** Counters of the profiler under which the global reductions of the field are recorded. They are NULL when profiling is disabled */
+        commprof::counter *maxSite, *absSite, *meanSite;
+
     public:
         blitz::Array<real, 3> F;
 
@@ -92,6 +95,28 @@ class plainsf {
             mpiHandle->syncData();
         }
 
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to start the synchronisation of data across all processors
+ *
+ *          When the progress thread is used, the data-transfer proceeds while the caller performs other computations,
+ *          till \ref syncFinish is called.
+ *          The field must not be modified, and its pads must not be read, till then.
+ ********************************************************************************************************************************************
+ */
+        inline void syncStart() {
+            mpiHandle->syncStart();
+        }
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to wait for the synchronisation started by \ref syncStart to complete
+ ********************************************************************************************************************************************
+ */
+        inline void syncFinish() {
+            mpiHandle->syncFinish();
+        }
+
 /**
  ********************************************************************************************************************************************
  * \brief   Function to extract the maximum value from the plain scalar field
@@ -108,7 +133,7 @@ class plainsf {
 
             localMax = blitz::max(F(gridData.coreDomain));
 
-            MPI_Allreduce(&localMax, &globalMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+            gridData.rankData.allReduce(&localMax, &globalMax, 1, MPI_MAX, maxSite);
 
             return globalMax;
         }
@@ -130,7 +155,7 @@ class plainsf {
 
             localMax = blitz::max(blitz::abs(F(gridData.coreDomain)));
 
-            MPI_Allreduce(&localMax, &globalMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+            gridData.rankData.allReduce(&localMax, &globalMax, 1, MPI_MAX, absSite);
 
             return globalMax;
         }
@@ -151,7 +176,7 @@ class plainsf {
 
             localMean = blitz::mean(F(gridData.coreDomain));
 
-            MPI_Allreduce(&localMean, &globalSum, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+            gridData.rankData.allReduce(&localMean, &globalSum, 1, MPI_SUM, meanSite);
 
             return globalSum/gridData.rankData.nProc;
         }
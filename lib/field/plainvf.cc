@@ -57,26 +57,27 @@ plainvf::plainvf(const grid &gridData): gridData(gridData) {
     blitz::TinyVector<int, 3> dlBnd = gridData.fullDomain.lbound();
     blitz::RectDomain<3> core = gridData.coreDomain;
 
-    Vx.resize(dSize);
-    Vx.reindexSelf(dlBnd);
+    grid::allocPadded(Vx, dSize, dlBnd, gridData.allocPads);
     Vx = 0.0;
 
-    mpiVxData = new mpidata(Vx, gridData.rankData);
-    mpiVxData->createSubarrays(dSize, core.ubound() + 1, gridData.padWidths);
+    mpiVxData = new mpidata(Vx, gridData.rankData, "Halo plainvf Vx");
+    mpiVxData->createSubarrays(dSize + gridData.allocPads, core.ubound() + 1, gridData.padWidths);
 
-    Vy.resize(dSize);
-    Vy.reindexSelf(dlBnd);
+    grid::allocPadded(Vy, dSize, dlBnd, gridData.allocPads);
     Vy = 0.0;
 
-    mpiVyData = new mpidata(Vy, gridData.rankData);
-    mpiVyData->createSubarrays(dSize, core.ubound() + 1, gridData.padWidths);
+    mpiVyData = new mpidata(Vy, gridData.rankData, "Halo plainvf Vy");
+    mpiVyData->createSubarrays(dSize + gridData.allocPads, core.ubound() + 1, gridData.padWidths);
 
-    Vz.resize(dSize);
-    Vz.reindexSelf(dlBnd);
+    grid::allocPadded(Vz, dSize, dlBnd, gridData.allocPads);
     Vz = 0.0;
 
-    mpiVzData = new mpidata(Vz, gridData.rankData);
-    mpiVzData->createSubarrays(dSize, core.ubound() + 1, gridData.padWidths);
+    mpiVzData = new mpidata(Vz, gridData.rankData, "Halo plainvf Vz");
+    mpiVzData->createSubarrays(dSize + gridData.allocPads, core.ubound() + 1, gridData.padWidths);
+
+    vxSite = gridData.rankData.registerSite("Reduce plainvf::vxMax");
+    vySite = gridData.rankData.registerSite("Reduce plainvf::vyMax");
+    vzSite = gridData.rankData.registerSite("Reduce plainvf::vzMax");
 }
 
 /**
@@ -49,6 +49,9 @@ class plainvf {
     private:
         const grid &gridData;
 
+        /** Counters of the profiler under which the global reductions of the components are recorded. They are NULL when profiling is disabled */
+        commprof::counter *vxSite, *vySite, *vzSite;
+
     public:
         blitz::Array<real, 3> Vx, Vy, Vz;
 
@@ -75,13 +78,18 @@ class plainvf {
  * \brief   Function to synchronise data across all processors when performing parallel computations
  *
  *          Each of the individual field components have to send and receive data across its MPI decomposed sub-domains.
- *          This function calls the \ref mpidata#syncData "syncData" function for each component to update the sub-domain boundary pads.
+ *          This function starts the synchronisation of all the components before waiting for any of them to complete,
+ *          so that the progress thread, when used, performs the transfers one after the other without waiting for the caller.
  ********************************************************************************************************************************************
  */
         inline void syncData() {
-            mpiVxData->syncData();
-            mpiVyData->syncData();
-            mpiVzData->syncData();
+            mpiVxData->syncStart();
+            mpiVyData->syncStart();
+            mpiVzData->syncStart();
+
+            mpiVxData->syncFinish();
+            mpiVyData->syncFinish();
+            mpiVzData->syncFinish();
         }
 
 /**
@@ -100,7 +108,7 @@ class plainvf {
 
             localMax = blitz::max(Vx(gridData.coreDomain));
 
-            MPI_Allreduce(&localMax, &globalMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+            gridData.rankData.allReduce(&localMax, &globalMax, 1, MPI_MAX, vxSite);
 
             return globalMax;
         }
@@ -121,7 +129,7 @@ class plainvf {
 
             localMax = blitz::max(Vy(gridData.coreDomain));
 
-            MPI_Allreduce(&localMax, &globalMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+            gridData.rankData.allReduce(&localMax, &globalMax, 1, MPI_MAX, vySite);
 
             return globalMax;
         }
@@ -142,7 +150,7 @@ class plainvf {
 
             localMax = blitz::max(Vz(gridData.coreDomain));
 
-            MPI_Allreduce(&localMax, &globalMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+            gridData.rankData.allReduce(&localMax, &globalMax, 1, MPI_MAX, vzSite);
 
             return globalMax;
         }
@@ -0,0 +1,330 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file semilag.cc
+ *
+ *  \brief Definitions for functions of class semilag
+ *  \sa semilag.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include "semilag.h"
+#include "vfield.h"
+#include "sfield.h"
+#include "plainvf.h"
+#include "plainsf.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the semilag class
+ *
+ *          The constructor sets the limits of indices within which the departure points may lie in each sub-domain.
+ *          Pads shared with neighbouring sub-domains are filled to their full width by data transfer, and may hence
+ *          contain departure points.
+ *          At non-periodic walls, only the first layer of pads holds valid data, which is set by the boundary conditions.
+ *          The domain is not decomposed along Z, and pads along Z beyond the first layer are not updated even for periodic
+ *          boundaries, so that the departure points are always limited to the first layer of pads along Z.
+ *          Along periodic directions which are not decomposed, including Z, the departure points are instead wrapped back
+ *          into the domain, where they lie between the first layers of pads on either side.
+ *
+ * \param   gridData is a const reference to the global data in the grid class
+ ********************************************************************************************************************************************
+ */
+semilag::semilag(const grid &gridData): gridData(gridData), xPos(gridData.x), yPos(gridData.y), zPos(gridData.z) {
+    core = gridData.coreDomain;
+
+    tau = 0.0;
+
+    loLim = -1, -1, -1;
+    upLim = core.ubound() + 1;
+
+    if (gridData.inputParams.xPer or gridData.rankData.xRank > 0) loLim(0) = -gridData.padWidths(0);
+    if (gridData.inputParams.xPer or gridData.rankData.xRank < gridData.rankData.npX - 1) upLim(0) = core.ubound(0) + gridData.padWidths(0);
+
+#ifdef PLANAR
+    loLim(1) = upLim(1) = 0;
+#else
+    if (gridData.inputParams.yPer or gridData.rankData.yRank > 0) loLim(1) = -gridData.padWidths(1);
+    if (gridData.inputParams.yPer or gridData.rankData.yRank < gridData.rankData.npY - 1) upLim(1) = core.ubound(1) + gridData.padWidths(1);
+#endif
+
+    // ALONG PERIODIC DIRECTIONS HELD ENTIRELY BY THE SUB-DOMAIN, DEPARTURE POINTS ARE WRAPPED BACK INTO THE DOMAIN INSTEAD OF BEING CLAMPED
+    wrapLen = 0.0, 0.0, 0.0;
+    if (gridData.inputParams.xPer and gridData.rankData.npX == 1) wrapLen(0) = gridData.xLen;
+#ifndef PLANAR
+    if (gridData.inputParams.yPer and gridData.rankData.npY == 1) wrapLen(1) = gridData.yLen;
+#endif
+    if (gridData.inputParams.zPer) wrapLen(2) = gridData.zLen;
+
+    depX.resize(core.ubound() - core.lbound() + 1);
+    depX.reindexSelf(core.lbound());
+
+    depY.resize(core.ubound() - core.lbound() + 1);
+    depY.reindexSelf(core.lbound());
+
+    depZ.resize(core.ubound() - core.lbound() + 1);
+    depZ.reindexSelf(core.lbound());
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to trace the grid nodes of the core back to their departure points
+ *
+ *          The departure points are found with the second-order mid-point rule.
+ *          The position of the fluid parcel at the middle of the interval is first estimated with the velocity at the
+ *          arrival point, and the parcel is then traced back over the full interval with the velocity interpolated at this
+ *          mid-point.
+ *          Along periodic directions held entirely by the sub-domain, the points are wrapped back into the domain.
+ *          Along other directions, departure points lying beyond the valid data of the sub-domain are clamped to its limits.
+ *          The pads along X and Y are sized by the grid class from the Courant number, so that this happens only at walls,
+ *          or when the Courant number specified in the YAML file is exceeded.
+ *          The pads of the velocity field must be updated before calling this function.
+ *
+ * \param   V is a const reference to the velocity field along which the grid nodes are traced back
+ * \param   dt is the interval over which the grid nodes are traced back
+ ********************************************************************************************************************************************
+ */
+void semilag::trace(const vfield &V, const real dt) {
+    const aview<const real, 3> U(V.Vx.F);
+#ifndef PLANAR
+    const aview<const real, 3> Vy(V.Vy.F);
+#endif
+    const aview<const real, 3> W(V.Vz.F);
+
+    const aview<real, 3> dX(depX), dY(depY), dZ(depZ);
+
+    tau = dt;
+
+#pragma omp parallel for num_threads(gridData.inputParams.nThreads)
+    for (int iX = core.lbound(0); iX <= core.ubound(0); iX++) {
+        stencil sx, sy, sz;
+
+        // ALONG Y IN 2D RUNS, THE STENCIL REDUCES TO THE SINGLE PLANE OF DATA
+        sy.base = 0;    sy.np = 1;      sy.w[0] = 1.0;
+
+        for (int iY = core.lbound(1); iY <= core.ubound(1); iY++) {
+            for (int iZ = core.lbound(2); iZ <= core.ubound(2); iZ++) {
+                // POSITION OF THE FLUID PARCEL AT THE MIDDLE OF THE INTERVAL, ESTIMATED WITH THE VELOCITY AT THE ARRIVAL POINT
+                setStencil(xPos, loLim(0), upLim(0), locate(xPos, loLim(0), upLim(0), iX, wrap(0, xPos(iX) - 0.5*tau*U(iX, iY, iZ))), sx);
+#ifndef PLANAR
+                setStencil(yPos, loLim(1), upLim(1), locate(yPos, loLim(1), upLim(1), iY, wrap(1, yPos(iY) - 0.5*tau*Vy(iX, iY, iZ))), sy);
+#endif
+                setStencil(zPos, loLim(2), upLim(2), locate(zPos, loLim(2), upLim(2), iZ, wrap(2, zPos(iZ) - 0.5*tau*W(iX, iY, iZ))), sz);
+
+                // DEPARTURE POINT, TRACED BACK OVER THE FULL INTERVAL WITH THE VELOCITY AT THE MID-POINT
+                dX(iX, iY, iZ) = locate(xPos, loLim(0), upLim(0), iX, wrap(0, xPos(iX) - tau*interpolate(U, sx, sy, sz)));
+#ifdef PLANAR
+                dY(iX, iY, iZ) = real(iY);
+#else
+                dY(iX, iY, iZ) = locate(yPos, loLim(1), upLim(1), iY, wrap(1, yPos(iY) - tau*interpolate(Vy, sx, sy, sz)));
+#endif
+                dZ(iX, iY, iZ) = locate(zPos, loLim(2), upLim(2), iZ, wrap(2, zPos(iZ) - tau*interpolate(W, sx, sy, sz)));
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the advection terms of a vector field with the semi-Lagrangian scheme
+ *
+ *          The function subtracts the tendency \f$ (\mathbf{f}(\mathbf{x}) - \mathbf{f}(\mathbf{x}_d))/\tau \f$ from the
+ *          output, where \f$ \mathbf{x}_d \f$ are the departure points computed in the last call to \ref trace.
+ *          It thus replaces the term \f$ -(\mathbf{u}.\nabla)\mathbf{f} \f$ computed by \ref vfield#computeNLin "computeNLin".
+ *
+ * \param   V is a const reference to the vector field to be advected, with its pads updated
+ * \param   H is a reference to the plain vector field (plainvf) from which the advection terms are subtracted
+ ********************************************************************************************************************************************
+ */
+void semilag::advect(const vfield &V, plainvf &H) const {
+    advectField(V.Vx.F, H.Vx);
+#ifndef PLANAR
+    advectField(V.Vy.F, H.Vy);
+#endif
+    advectField(V.Vz.F, H.Vz);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the advection term of a scalar field with the semi-Lagrangian scheme
+ *
+ *          The function replaces the term \f$ -(\mathbf{u}.\nabla)f \f$ computed by \ref sfield#computeNLin "computeNLin",
+ *          using the departure points computed in the last call to \ref trace.
+ *
+ * \param   T is a const reference to the scalar field to be advected, with its pads updated
+ * \param   H is a reference to the plain scalar field (plainsf) from which the advection term is subtracted
+ ********************************************************************************************************************************************
+ */
+void semilag::advect(const sfield &T, plainsf &H) const {
+    advectField(T.F.F, H.F);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to interpolate a field at the departure points and subtract the resulting tendency from the output
+ *
+ * \param   F is a const reference to the blitz array of the field to be advected
+ * \param   H is a reference to the blitz array from which the tendency is subtracted
+ ********************************************************************************************************************************************
+ */
+void semilag::advectField(const blitz::Array<real, 3> &F, blitz::Array<real, 3> &H) const {
+    const aview<const real, 3> Fv(F);
+    const aview<real, 3> Hv(H);
+    const aview<const real, 3> dX(depX), dY(depY), dZ(depZ);
+
+    const real iTau = 1.0/tau;
+
+#pragma omp parallel for num_threads(gridData.inputParams.nThreads)
+    for (int iX = core.lbound(0); iX <= core.ubound(0); iX++) {
+        stencil sx, sy, sz;
+
+        sy.base = 0;    sy.np = 1;      sy.w[0] = 1.0;
+
+        for (int iY = core.lbound(1); iY <= core.ubound(1); iY++) {
+            for (int iZ = core.lbound(2); iZ <= core.ubound(2); iZ++) {
+                setStencil(xPos, loLim(0), upLim(0), dX(iX, iY, iZ), sx);
+#ifndef PLANAR
+                setStencil(yPos, loLim(1), upLim(1), dY(iX, iY, iZ), sy);
+#endif
+                setStencil(zPos, loLim(2), upLim(2), dZ(iX, iY, iZ), sz);
+
+                Hv(iX, iY, iZ) -= (Fv(iX, iY, iZ) - interpolate(Fv, sx, sy, sz))*iTau;
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to find the fractional index of a point along one direction of the local grid
+ *
+ *          The search starts from the index of the arrival point, and walks outwards along the grid, so that its cost
+ *          is proportional to the Courant number rather than to the size of the grid.
+ *          Points lying beyond the limits are clamped to them.
+ *
+ * \param   X is the view of the local grid coordinates along the direction
+ * \param   lo is the lowest index of the grid with valid data
+ * \param   hi is the highest index of the grid with valid data
+ * \param   i is the index of the arrival point
+ * \param   xd is the coordinate of the point to be located
+ *
+ * \return  The index m of the interval \f$ [x_m, x_{m+1}) \f$ containing the point, plus the fractional distance of the point within it
+ ********************************************************************************************************************************************
+ */
+real semilag::locate(const aview<const real, 1> &X, const int lo, const int hi, const int i, const real xd) {
+    if (xd <= X(lo)) return real(lo);
+    if (xd >= X(hi)) return real(hi);
+
+    int m = std::min(std::max(i, lo), hi - 1);
+    while (X(m + 1) <= xd) m++;
+    while (X(m) > xd) m--;
+
+    return m + (xd - X(m))/(X(m + 1) - X(m));
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the weights of the 1D interpolation stencil at a point along one direction
+ *
+ *          Cubic Lagrange polynomials are used on the 4 nodes surrounding the point, with the weights computed from the
+ *          actual coordinates of the nodes so that the interpolation remains third-order accurate on stretched grids.
+ *          Next to the limits of valid data, where the 4 nodes are not available, linear interpolation is used.
+ *
+ * \param   X is the view of the local grid coordinates along the direction
+ * \param   lo is the lowest index of the grid with valid data
+ * \param   hi is the highest index of the grid with valid data
+ * \param   s is the fractional index of the point, as returned by \ref locate
+ * \param   st is a reference to the stencil into which the indices and weights are written
+ ********************************************************************************************************************************************
+ */
+void semilag::setStencil(const aview<const real, 1> &X, const int lo, const int hi, const real s, stencil &st) {
+    int m = std::min(int(std::floor(s)), hi - 1);
+    real xd = X(m) + (s - m)*(X(m + 1) - X(m));
+
+    if ((m - 1 >= lo) and (m + 2 <= hi)) {
+        st.base = m - 1;
+        st.np = 4;
+        for (int a = 0; a < 4; a++) {
+            st.w[a] = 1.0;
+            for (int b = 0; b < 4; b++) {
+                if (b != a) st.w[a] *= (xd - X(st.base + b))/(X(st.base + a) - X(st.base + b));
+            }
+        }
+    } else {
+        st.base = m;
+        st.np = 2;
+        st.w[1] = s - m;
+        st.w[0] = 1.0 - st.w[1];
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to interpolate a field with the tensor product of the 1D stencils along the 3 directions
+ *
+ * \param   F is the view of the field to be interpolated
+ * \param   sx is the stencil along X
+ * \param   sy is the stencil along Y
+ * \param   sz is the stencil along Z
+ *
+ * \return  The interpolated value of the field
+ ********************************************************************************************************************************************
+ */
+inline real semilag::interpolate(const aview<const real, 3> &F, const stencil &sx, const stencil &sy, const stencil &sz) {
+    real fVal = 0.0;
+
+    for (int a = 0; a < sx.np; a++) {
+        for (int b = 0; b < sy.np; b++) {
+            const real wXY = sx.w[a]*sy.w[b];
+            const real *fRow = F.row(sx.base + a, sy.base + b);
+
+            for (int c = 0; c < sz.np; c++) {
+                fVal += wXY*sz.w[c]*fRow[sz.base + c];
+            }
+        }
+    }
+
+    return fVal;
+}
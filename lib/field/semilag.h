@@ -0,0 +1,122 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file semilag.h
+ *
+ *  \brief Class declaration of semilag
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef SEMILAG_H
+#define SEMILAG_H
+
+#include <cmath>
+#include <blitz/array.h>
+
+#include "grid.h"
+#include "aview.h"
+
+// Forward declarations of relevant classes
+class vfield;
+class sfield;
+class plainvf;
+class plainsf;
+
+class semilag {
+    private:
+        const grid &gridData;
+
+        blitz::RectDomain<3> core;
+
+        /** Interval over which the departure points were traced back in the last call to \ref trace */
+        real tau;
+
+        /** Lower and upper limits of the indices along each direction, within which the data of fields in the sub-domain are valid */
+        blitz::TinyVector<int, 3> loLim, upLim;
+
+        /** Length of the domain along periodic directions which are not decomposed, across which departure points are wrapped, and 0 otherwise */
+        blitz::TinyVector<real, 3> wrapLen;
+
+        /** Views of the local grid coordinates along X, Y and Z, including the pads */
+        const aview<const real, 1> xPos, yPos, zPos;
+
+        /** Departure points of the grid nodes in the core, stored as fractional indices of the local grid along X, Y and Z */
+        blitz::Array<real, 3> depX, depY, depZ;
+
+        /** Indices of the first node and weights of the nodes of the 1D interpolation stencil along one direction */
+        struct stencil {
+            int base, np;
+            real w[4];
+        };
+
+        inline real wrap(const int dim, const real xd) const {
+            return (wrapLen(dim) > 0.0)? xd - wrapLen(dim)*std::floor(xd/wrapLen(dim)): xd;
+        };
+
+        static real locate(const aview<const real, 1> &X, const int lo, const int hi, const int i, const real xd);
+
+        static void setStencil(const aview<const real, 1> &X, const int lo, const int hi, const real s, stencil &st);
+
+        static inline real interpolate(const aview<const real, 3> &F, const stencil &sx, const stencil &sy, const stencil &sz);
+
+        void advectField(const blitz::Array<real, 3> &F, blitz::Array<real, 3> &H) const;
+
+    public:
+        semilag(const grid &gridData);
+
+        void trace(const vfield &V, const real dt);
+
+        void advect(const vfield &V, plainvf &H) const;
+        void advect(const sfield &T, plainsf &H) const;
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class semilag semilag.h "lib/semilag.h"
+ *  \brief Semi-Lagrangian scheme to compute the advection terms of vector and scalar fields
+ *
+ *  Instead of the finite-difference derivatives of the non-linear terms computed by the vfield and sfield classes,
+ *  the semi-Lagrangian scheme traces every grid node back along the velocity field to the point from which the fluid
+ *  parcel departed at the start of the time-step.
+ *  The advected field is interpolated at these departure points with cubic Lagrange polynomials on the stretched grid.
+ *  Since the departure points are found by interpolation rather than by a stencil of fixed size, the scheme remains stable
+ *  for Courant numbers larger than 1, provided the pads of the sub-domains are deep enough to contain the departure points.
+ *  The change in the field over the time-step is returned as a tendency, so that the scheme plugs into the RHS of
+ *  the existing time-integration schemes in place of the finite-difference advection terms.
+ ********************************************************************************************************************************************
+ */
+
+#endif
@@ -63,10 +63,12 @@ sfield::sfield(const grid &gridData, std::string fieldName):
 {
     this->fieldName = fieldName;
 
-    derivTemp.resize(F.fSize);
-    derivTemp.reindexSelf(F.flBound);
+    grid::allocPadded(derivTemp, F.fSize, F.flBound, gridData.allocPads);
 
     core = gridData.coreDomain;
+
+    // THE BCS ARE SET BY THE SOLVER, WHICH MAY REPLACE THEM LATER. THEY START AS NULL SO THAT A REPLACED BC CAN ALWAYS BE DELETED
+    tLft = tRgt = tFrn = tBak = tTop = tBot = NULL;
 }
 
 /**
@@ -185,6 +187,31 @@ void sfield::imposeBCs() {
     tBot->imposeBC();
 };
 
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to advance the boundary conditions of the scalar field over a time step
+ *
+ *          The function calls the advanceBC() of each boundary class object assigned to each wall.
+ *          It must be called at the start of each time step, or each sub-step of multi-stage schemes.
+ *
+ * \param   stepSize is the time interval over which the BCs will be advanced in the current time step or sub-step
+ ********************************************************************************************************************************************
+ */
+void sfield::advanceBCs(const real stepSize) {
+    if (not gridData.inputParams.xPer) {
+        tLft->advanceBC(stepSize);
+        tRgt->advanceBC(stepSize);
+    }
+#ifndef PLANAR
+    if (not gridData.inputParams.yPer) {
+        tFrn->advanceBC(stepSize);
+        tBak->advanceBC(stepSize);
+    }
+#endif
+    tTop->advanceBC(stepSize);
+    tBot->advanceBC(stepSize);
+};
+
 /**
  ********************************************************************************************************************************************
  * \brief   Overloaded operator to add a given plain scalar field
@@ -57,7 +57,7 @@ class sfield {
     private:
         const grid &gridData;
 
-        blitz::Array<real, 3> derivTemp;
+        blitz::Array<sreal, 3> derivTemp;
 
         blitz::RectDomain<3> core;
 
@@ -88,6 +88,7 @@ class sfield {
         void syncData();
 
         void imposeBCs();
+        void advanceBCs(const real stepSize);
 
         sfield& operator += (plainsf &a);
         sfield& operator -= (plainsf &a);
@@ -0,0 +1,299 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file subblock.cc
+ *
+ *  \brief Definitions for functions of class subblock - 3D data of a sub-domain split into smaller blocks with their own halos
+ *  \sa subblock.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include <algorithm>
+#include "subblock.h"
+#include "aview.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to copy the data within a region from one array to another
+ *
+ *          Views are used instead of blitz expressions on sub-arrays, since creating sub-arrays of the same array from many
+ *          threads at once is not safe with blitz.
+ *
+ * \param   src is the view of the array from which the data is read
+ * \param   dst is the view of the array into which the data is written
+ * \param   region is the RectDomain object specifying the points to be copied, which must lie within both arrays
+ ********************************************************************************************************************************************
+ */
+static inline void copyRegion(const aview<const real, 3> &src, const aview<real, 3> &dst, const blitz::RectDomain<3> &region) {
+    for (int i = region.lbound(0); i <= region.ubound(0); ++i) {
+        for (int j = region.lbound(1); j <= region.ubound(1); ++j) {
+            const real *sRow = src.row(i, j);
+            real *dRow = dst.row(i, j);
+
+            for (int k = region.lbound(2); k <= region.ubound(2); ++k) dRow[k] = sRow[k];
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the subblock class
+ *
+ *          The core of the sub-domain is split into blocks of bSize points along each direction.
+ *          The last block along each direction is smaller when the number of core points is not a multiple of bSize.
+ *          The faces of each block are numbered from 0 to 5 as -X, +X, -Y, +Y, -Z and +Z.
+ *
+ * \param   core is the RectDomain object specifying the core points of the sub-domain
+ * \param   bSize is the number of points of each block along each direction
+ ********************************************************************************************************************************************
+ */
+subblock::subblock(const blitz::RectDomain<3> &core, const int bSize) {
+    int nDiv[3];
+
+    for (int dim = 0; dim < 3; ++dim) nDiv[dim] = (core.ubound(dim) - core.lbound(dim) + bSize)/bSize;
+
+    nBlocks = nDiv[0]*nDiv[1]*nDiv[2];
+
+    for (int bi = 0; bi < nDiv[0]; ++bi) {
+        for (int bj = 0; bj < nDiv[1]; ++bj) {
+            for (int bk = 0; bk < nDiv[2]; ++bk) {
+                const int bInd[3] = {bi, bj, bk};
+                blitz::TinyVector<int, 3> loInd, hiInd, bNum;
+
+                for (int dim = 0; dim < 3; ++dim) {
+                    loInd(dim) = core.lbound(dim) + bInd[dim]*bSize;
+                    hiInd(dim) = std::min(loInd(dim) + bSize - 1, core.ubound(dim));
+                }
+
+                bCore.push_back(blitz::RectDomain<3>(loInd, hiInd));
+
+                blitz::TinyVector<int, 6> nbrs;
+                nbrs = ((bi > 0)? ((bi - 1)*nDiv[1] + bj)*nDiv[2] + bk: -1),
+                       ((bi < nDiv[0] - 1)? ((bi + 1)*nDiv[1] + bj)*nDiv[2] + bk: -1),
+                       ((bj > 0)? (bi*nDiv[1] + bj - 1)*nDiv[2] + bk: -1),
+                       ((bj < nDiv[1] - 1)? (bi*nDiv[1] + bj + 1)*nDiv[2] + bk: -1),
+                       ((bk > 0)? (bi*nDiv[1] + bj)*nDiv[2] + bk - 1: -1),
+                       ((bk < nDiv[2] - 1)? (bi*nDiv[1] + bj)*nDiv[2] + bk + 1: -1);
+                bNbrs.push_back(nbrs);
+
+                // EACH BLOCK HAS ONE HALO POINT ON EITHER SIDE ALONG EACH DIRECTION
+                for (int dim = 0; dim < 3; ++dim) bNum(dim) = hiInd(dim) - loInd(dim) + 3;
+
+                data.push_back(blitz::Array<real, 3>(bNum));
+                data.back().reindexSelf(blitz::TinyVector<int, 3>(loInd(0) - 1, loInd(1) - 1, loInd(2) - 1));
+                data.back() = 0.0;
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to get the plane of points adjacent to a given face of a block
+ *
+ *          The plane spans only the core points of the block along the two directions parallel to the face,
+ *          since the 7-point stencils used with the blocks do not need the edges and corners of the halo.
+ *
+ * \param   b is the index of the block
+ * \param   face is the number of the face, from 0 to 5
+ * \param   offset is 0 for the plane of halo points outside the face, and 1 for the plane of core points on the face
+ *
+ * \return  The RectDomain object specifying the plane of points
+ ********************************************************************************************************************************************
+ */
+blitz::RectDomain<3> subblock::facePlane(const int b, const int face, const int offset) const {
+    blitz::TinyVector<int, 3> loInd, hiInd;
+
+    const int dim = face/2;
+    const int pInd = (face % 2)? bCore[b].ubound(dim) + 1 - offset: bCore[b].lbound(dim) - 1 + offset;
+
+    loInd = bCore[b].lbound();
+    hiInd = bCore[b].ubound();
+
+    loInd(dim) = pInd;
+    hiInd(dim) = pInd;
+
+    return blitz::RectDomain<3>(loInd, hiInd);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to copy the data of a blitz array into the blocks
+ *
+ *          The core and halo points of all the blocks are copied, so that the array must hold valid data in its pads.
+ *
+ * \param   A is a const reference to the blitz array spanning the sub-domain along with one layer of pads
+ ********************************************************************************************************************************************
+ */
+void subblock::fromArray(const blitz::Array<real, 3> &A) {
+    const aview<const real, 3> src(A);
+
+    for (int b = 0; b < nBlocks; ++b) {
+        copyRegion(src, aview<real, 3>(data[b]), data[b].domain());
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to copy the core points of all the blocks into a blitz array
+ *
+ * \param   A is a reference to the blitz array spanning the sub-domain, into which the data is copied
+ ********************************************************************************************************************************************
+ */
+void subblock::toArray(blitz::Array<real, 3> &A) const {
+    const aview<real, 3> dst(A);
+
+    for (int b = 0; b < nBlocks; ++b) {
+        copyRegion(aview<const real, 3>(data[b]), dst, bCore[b]);
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to update the halos of blocks across the faces they share with other blocks of the sub-domain
+ *
+ *          The halo of each block is copied from the core of its neighbour.
+ *          Since every block writes only into its own halo, the blocks are updated by the threads independently.
+ *
+ * \param   nThreads is the number of OpenMP threads used to copy the halos
+ ********************************************************************************************************************************************
+ */
+void subblock::syncHalos(const int nThreads) {
+#pragma omp parallel for num_threads(nThreads) schedule(dynamic)
+    for (int b = 0; b < nBlocks; ++b) {
+        const aview<real, 3> dst(data[b]);
+
+        for (int face = 0; face < 6; ++face) {
+            const int n = bNbrs[b](face);
+
+            if (n >= 0) copyRegion(aview<const real, 3>(data[n]), dst, facePlane(b, face, 0));
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to update the halos of blocks across the faces lying on the sub-domain boundary
+ *
+ *          The halos are read from the pads of the blitz array, which must have been updated by MPI transfer and boundary conditions.
+ *
+ * \param   A is a const reference to the blitz array spanning the sub-domain along with one layer of pads
+ ********************************************************************************************************************************************
+ */
+void subblock::readPads(const blitz::Array<real, 3> &A) {
+    const aview<const real, 3> src(A);
+
+    for (int b = 0; b < nBlocks; ++b) {
+        for (int face = 0; face < 6; ++face) {
+            if (bNbrs[b](face) < 0) copyRegion(src, aview<real, 3>(data[b]), facePlane(b, face, 0));
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to copy the core points of blocks on the faces lying on the sub-domain boundary into a blitz array
+ *
+ *          Only these points are needed by the MPI transfers and boundary conditions which update the pads of the array.
+ *
+ * \param   A is a reference to the blitz array spanning the sub-domain, into which the data is copied
+ ********************************************************************************************************************************************
+ */
+void subblock::writeFaces(blitz::Array<real, 3> &A) const {
+    const aview<real, 3> dst(A);
+
+    for (int b = 0; b < nBlocks; ++b) {
+        for (int face = 0; face < 6; ++face) {
+            if (bNbrs[b](face) < 0) copyRegion(aview<const real, 3>(data[b]), dst, facePlane(b, face, 1));
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to perform one Jacobi iteration of the Laplacian on all the blocks
+ *
+ *          Each block is updated as an independent task using only its own core and halo, and the tasks are shared
+ *          dynamically among the threads.
+ *          The coefficients are the same as used by brick::jacobiSweep, and the halos of src must be up-to-date.
+ *
+ * \param   src is a const reference to the blocks holding data from the previous iteration
+ * \param   rhs is a const reference to the blocks holding the right-hand side
+ * \param   cM is the array of coefficients of the left neighbour along each direction
+ * \param   cP is the array of coefficients of the right neighbour along each direction
+ * \param   cD is the array of diagonal coefficients along each direction
+ * \param   nThreads is the number of OpenMP threads used by the kernel
+ ********************************************************************************************************************************************
+ */
+void subblock::jacobiSweep(const subblock &src, const subblock &rhs,
+                           const blitz::Array<blitz::Array<real, 1>, 1> &cM,
+                           const blitz::Array<blitz::Array<real, 1>, 1> &cP,
+                           const blitz::Array<blitz::Array<real, 1>, 1> &cD, const int nThreads) {
+    const aview<const real, 1> cMx(cM(0)), cMy(cM(1)), cMz(cM(2));
+    const aview<const real, 1> cPx(cP(0)), cPy(cP(1)), cPz(cP(2));
+    const aview<const real, 1> cDx(cD(0)), cDy(cD(1)), cDz(cD(2));
+
+#pragma omp parallel for num_threads(nThreads) schedule(dynamic)
+    for (int b = 0; b < nBlocks; ++b) {
+        const aview<const real, 3> L(src.data[b]), R(rhs.data[b]);
+        const aview<real, 3> T(data[b]);
+
+        const int sX = L.stride(0), sY = L.stride(1);
+        const blitz::RectDomain<3> &bc = bCore[b];
+
+        for (int i = bc.lbound(0); i <= bc.ubound(0); ++i) {
+            for (int j = bc.lbound(1); j <= bc.ubound(1); ++j) {
+                const real *lRow = L.row(i, j);
+                const real *rRow = R.row(i, j);
+                real *tRow = T.row(i, j);
+
+                for (int k = bc.lbound(2); k <= bc.ubound(2); ++k) {
+                    tRow[k] = (cMx(i)*lRow[k - sX] + cPx(i)*lRow[k + sX] +
+                               cMy(j)*lRow[k - sY] + cPy(j)*lRow[k + sY] +
+                               cMz(k)*lRow[k - 1] + cPz(k)*lRow[k + 1] -
+                               rRow[k]) / (cDx(i) + cDy(j) + cDz(k));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file subblock.h
+ *
+ *  \brief Class declaration of subblock - 3D data of a sub-domain split into smaller blocks with their own halos
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef SUBBLOCK_H
+#define SUBBLOCK_H
+
+#include <vector>
+#include <blitz/array.h>
+
+#include "parser.h"
+
+class subblock {
+    private:
+        /** Core points of each block, given in the indices of the sub-domain */
+        std::vector<blitz::RectDomain<3> > bCore;
+
+        /** Index of the neighbouring block across each of the 6 faces of each block, or -1 if the face lies on the sub-domain boundary */
+        std::vector<blitz::TinyVector<int, 6> > bNbrs;
+
+        /** Data of each block over its core and a halo of one point on each side */
+        std::vector<blitz::Array<real, 3> > data;
+
+        blitz::RectDomain<3> facePlane(const int b, const int face, const int offset) const;
+
+    public:
+        /** Number of blocks into which the sub-domain is split */
+        int nBlocks;
+
+        subblock(const blitz::RectDomain<3> &core, const int bSize);
+
+        void fromArray(const blitz::Array<real, 3> &A);
+        void toArray(blitz::Array<real, 3> &A) const;
+
+        void syncHalos(const int nThreads);
+        void readPads(const blitz::Array<real, 3> &A);
+        void writeFaces(blitz::Array<real, 3> &A) const;
+
+        void jacobiSweep(const subblock &src, const subblock &rhs,
+                         const blitz::Array<blitz::Array<real, 1>, 1> &cM,
+                         const blitz::Array<blitz::Array<real, 1>, 1> &cP,
+                         const blitz::Array<blitz::Array<real, 1>, 1> &cD, const int nThreads);
+
+        /** Exchange the data of two sets of blocks created from the same core without copying */
+        inline void swap(subblock &other) { data.swap(other.data); };
+
+        ~subblock() { };
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class subblock subblock.h "lib/subblock.h"
+ *  \brief Subblock class to split the data of a sub-domain into smaller blocks, each with its own halo of one point
+ *
+ *  Each MPI sub-domain is over-decomposed into blocks of bSize x bSize x bSize points that fit in cache, and stencil kernels
+ *  update the blocks as independent tasks shared among the OpenMP threads.
+ *  The halos of blocks which share a face are exchanged through memory copies within the sub-domain.
+ *  Only the faces of blocks lying on the sub-domain boundary are copied to and from a blitz array, so that the MPI transfers
+ *  and boundary conditions already written for blitz arrays are needed only for these blocks.
+ ********************************************************************************************************************************************
+ */
+
+#endif
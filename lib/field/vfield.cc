@@ -64,10 +64,16 @@ vfield::vfield(const grid &gridData, std::string fieldName):
 {
     this->fieldName = fieldName;
 
-    derivTemp.resize(Vx.fSize);
-    derivTemp.reindexSelf(Vx.flBound);
+    grid::allocPadded(derivTemp, Vx.fSize, Vx.flBound, gridData.allocPads);
 
     core = gridData.coreDomain;
+
+    tStpSite = gridData.rankData.registerSite("Reduce vfield::computeTStp");
+
+    // THE BCS ARE SET BY THE SOLVER, WHICH MAY REPLACE THEM LATER. THEY START AS NULL SO THAT A REPLACED BC CAN ALWAYS BE DELETED
+    uLft = uRgt = uFrn = uBak = uTop = uBot = NULL;
+    vLft = vRgt = vFrn = vBak = vTop = vBot = NULL;
+    wLft = wRgt = wFrn = wBak = wTop = wBot = NULL;
 }
 
 /**
@@ -210,7 +216,7 @@ void vfield::computeTStp(real &dt) {
                         (blitz::abs(Vz.F)/gridData.dZt));
 #endif
 
-    MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+    gridData.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, tStpSite);
 
     dt = gridData.inputParams.courantNumber/gloMax;
 }
@@ -252,13 +258,18 @@ void vfield::divergence(plainsf &divV) {
  *
  *          Each of the individual field components have their own subroutine, \ref field#syncData "syncData" to send and
  *          receive data across its MPI decomposed sub-domains.
- *          This function calls the \ref field#syncData "syncData" function of its components to update the sub-domain boundary pads.
+ *          This function starts the synchronisation of all its components before waiting for any of them to complete,
+ *          so that the progress thread, when used, performs the transfers one after the other without waiting for the caller.
  ********************************************************************************************************************************************
  */
 void vfield::syncData() {
-    Vx.syncData();
-    Vy.syncData();
-    Vz.syncData();
+    Vx.syncStart();
+    Vy.syncStart();
+    Vz.syncStart();
+
+    Vx.syncFinish();
+    Vy.syncFinish();
+    Vz.syncFinish();
 }
 
 /**
@@ -365,6 +376,48 @@ void vfield::imposeBCs() {
     imposeVzBC();
 }
 
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to advance the boundary conditions of all the components of the vfield over a time step
+ *
+ *          The function calls the advanceBC() of each boundary class object assigned to each wall.
+ *          It must be called at the start of each time step, or each sub-step of multi-stage schemes.
+ *          Only the BCs which are integrated in time, like the convective outflow BC, are affected by this call.
+ *
+ * \param   stepSize is the time interval over which the BCs will be advanced in the current time step or sub-step
+ ********************************************************************************************************************************************
+ */
+void vfield::advanceBCs(const real stepSize) {
+    if (not gridData.inputParams.xPer) {
+        uLft->advanceBC(stepSize);
+        uRgt->advanceBC(stepSize);
+        wLft->advanceBC(stepSize);
+        wRgt->advanceBC(stepSize);
+#ifndef PLANAR
+        vLft->advanceBC(stepSize);
+        vRgt->advanceBC(stepSize);
+#endif
+    }
+#ifndef PLANAR
+    if (not gridData.inputParams.yPer) {
+        uFrn->advanceBC(stepSize);
+        uBak->advanceBC(stepSize);
+        vFrn->advanceBC(stepSize);
+        vBak->advanceBC(stepSize);
+        wFrn->advanceBC(stepSize);
+        wBak->advanceBC(stepSize);
+    }
+#endif
+    uTop->advanceBC(stepSize);
+    uBot->advanceBC(stepSize);
+#ifndef PLANAR
+    vTop->advanceBC(stepSize);
+    vBot->advanceBC(stepSize);
+#endif
+    wTop->advanceBC(stepSize);
+    wBot->advanceBC(stepSize);
+}
+
 /**
  ********************************************************************************************************************************************
  * \brief   Overloaded operator to add a given plain vector field
@@ -57,10 +57,13 @@ class vfield {
     private:
         const grid &gridData;
 
-        blitz::Array<real, 3> derivTemp;
+        blitz::Array<sreal, 3> derivTemp;
 
         blitz::RectDomain<3> core;
 
+        /** Counter of the profiler under which the reduction for the time-step is recorded. It is NULL when profiling is disabled */
+        commprof::counter *tStpSite;
+
     public:
         field Vx, Vy, Vz;
 
@@ -98,6 +101,7 @@ class vfield {
         void imposeVzBC();
 
         void imposeBCs();
+        void advanceBCs(const real stepSize);
 
         vfield& operator += (plainvf &a);
         vfield& operator -= (plainvf &a);
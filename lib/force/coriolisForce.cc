@@ -44,10 +44,15 @@
 
 coriolisForce::coriolisForce(const grid &mesh, const vfield &U): force(mesh, U) {
     Fr = 1.0/mesh.inputParams.Ro;
+
+    //WHEN THE CORIOLIS TERM IS INTEGRATED EXACTLY, THE TIME-STEP ROTATES THE VELOCITY AND THE TERM IS NOT ADDED TO THE RHS
+    if (mesh.inputParams.exactCoriolis) rotRate = Fr;
 }
 
 
 void coriolisForce::addForcing(plainvf &Hv) {
+    if (mesh.inputParams.exactCoriolis) return;
+
     //ADD THE ROTATING TERM TO THE Vx COMPONENT OF Hv
     Hv.Vx += Fr*V.Vy.F;
 
@@ -48,12 +48,15 @@
  *
  *          The empty constructor merely initializes the local reference to the global mesh variable and vector field for velocity.
  *          The velocity vector field is used for its interpolation slices to be used in calculating forcing terms.
+ *          The rate of rotation is set to zero, and is changed only by the derived classes that add the Coriolis term.
  *
  * \param   mesh is a const reference to the global data contained in the grid class
  * \param   U is a reference to the velocity vector field
  ********************************************************************************************************************************************
  */
-force::force(const grid &mesh, const vfield &U): mesh(mesh), V(U) { }
+force::force(const grid &mesh, const vfield &U): mesh(mesh), V(U) {
+    rotRate = 0.0;
+}
 
 
 /**
@@ -49,6 +49,9 @@ class force {
     public:
         force(const grid &mesh, const vfield &U);
 
+        /** Angular rate at which the horizontal velocity is rotated when the Coriolis term is integrated exactly by the time-step. Zero otherwise */
+        real rotRate;
+
         virtual void addForcing(plainvf &Hv);
         virtual void addForcing(plainsf &Ht);
 
@@ -61,6 +61,9 @@ rotatingConv::rotatingConv(const grid &mesh, const vfield &U, const sfield &T):
             Fr = sqrt(mesh.inputParams.Ta*mesh.inputParams.Pr/mesh.inputParams.Ra); 
             break;
     }
+
+    //WHEN THE CORIOLIS TERM IS INTEGRATED EXACTLY, THE TIME-STEP ROTATES THE VELOCITY AND ONLY BUOYANCY IS ADDED TO THE RHS
+    if (mesh.inputParams.exactCoriolis) rotRate = Fr;
 }
 
 
@@ -68,6 +71,8 @@ void rotatingConv::addForcing(plainvf &Hv) {
     //ADD THE BUOYANCY TERM TO THE Vz COMPONENT OF Hv
     Hv.Vz += Fb*T.F.F;
 
+    if (mesh.inputParams.exactCoriolis) return;
+
     //ADD THE ROTATING TERM TO THE Vx COMPONENT OF Hv
     Hv.Vx += Fr*V.Vy.F;
 
@@ -40,6 +40,8 @@
  ********************************************************************************************************************************************
  */
 
+#include <algorithm>
+
 #include "grid.h"
 
 /**
@@ -52,11 +54,17 @@
  *          Appropriate stretching functions are chosen according to user preferences and their corresponding grid
  *          transformation derivatives are also computed and stored.
  *
+ *          A grid refined by an integer factor with respect to the one specified in the YAML file can also be created, for
+ *          fields that need a finer grid than the velocity and pressure.
+ *          Since the factor is a power of 2, each sub-domain of the refined grid covers the same region as the corresponding
+ *          sub-domain of the original grid.
+ *
  * \param   solParam is a const reference to the global data contained in the parser class
  * \param   parallelData is a reference to the global data contained in the parallel class
+ * \param   refFactor is the factor by which the grid specified in the YAML file is refined along each direction
  ********************************************************************************************************************************************
  */
-grid::grid(const parser &solParam, parallel &parallelData): inputParams(solParam),
+grid::grid(const parser &solParam, parallel &parallelData, const int refFactor): inputParams(solParam),
     rankData(parallelData), xLen(inputParams.Lx), yLen(inputParams.Ly), zLen(inputParams.Lz)
 {
     // Flag to enable printing to I/O only by 0 rank
@@ -76,10 +84,30 @@ grid::grid(const parser &solParam, parallel &parallelData): inputParams(solParam
         exit(0);
     }
 
+    /** With semi-Lagrangian advection, the pads along X and Y must be deep enough to hold the departure points of the core nodes,
+     *  and the nodes of the cubic interpolation stencil around them. Along Z, departure points are limited to the first layer of pads. */
+    if (inputParams.aScheme == 2) {
+        int slPads = int(ceil(inputParams.courantNumber*refFactor)) + 2;
+
+        padWidths(0) = std::max(padWidths(0), slPads);
+        padWidths(1) = std::max(padWidths(1), slPads);
+    }
+
     // THE ARRAY sizeArray HAS ELEMENTS [1, 3, 5, 9, 17, 33 ..... ] - STAGGERED GRID SIZE
     makeSizeArray();
 
     sizeIndex = inputParams.xInd, inputParams.yInd, inputParams.zInd;
+
+    // THE INDICES INTO sizeArray ARE INCREASED BY log2(refFactor) FOR A REFINED GRID
+    for (int i = 1; i < refFactor; i *= 2) {
+#ifdef PLANAR
+        sizeIndex(0) += 1;
+        sizeIndex(2) += 1;
+#else
+        sizeIndex += 1;
+#endif
+    }
+
     globalSize = sizeArray(sizeIndex(0)), sizeArray(sizeIndex(1)), sizeArray(sizeIndex(2));
 #ifdef PLANAR
     totalPoints = globalSize(0)*globalSize(2);
@@ -219,6 +247,13 @@ void grid::computeGlobalLimits() {
     coreSize = localNx, localNy, localNz;
     fullSize = coreSize + 2*padWidths;
 
+    // EXTRA POINTS IN THE STORAGE OF 3D ARRAYS ALONG THE INNER DIMENSIONS TO AVOID CACHE CONFLICTS
+#ifdef PLANAR
+    allocPads = 0, 0, inputParams.allocPad;
+#else
+    allocPads = 0, inputParams.allocPad, inputParams.allocPad;
+#endif
+
     // SUB-ARRAY STARTS AND ENDS FOR *STAGGERED* GRID
     subarrayStarts = xiSt, etSt, ztSt;
     subarrayEnds = xiEn, etEn, ztEn;
@@ -520,9 +555,9 @@ void grid::mgGridMetrics() {
 
     for (int vLev=0; vLev<numLevels; vLev++) {
         // FIRST SET THE RANGES TO RESIZE ARRAYS
-        xRange = blitz::Range(-1, int(std::pow(2, inputParams.xInd - vLev)));
-        yRange = blitz::Range(-1, int(std::pow(2, inputParams.yInd - vLev)));
-        zRange = blitz::Range(-1, int(std::pow(2, inputParams.zInd - vLev)));
+        xRange = blitz::Range(-1, int(std::pow(2, sizeIndex(0) - vLev)));
+        yRange = blitz::Range(-1, int(std::pow(2, sizeIndex(1) - vLev)));
+        zRange = blitz::Range(-1, int(std::pow(2, sizeIndex(2) - vLev)));
 
         // START INDEX FOR LEVEL
         int ls = 15*vLev;
@@ -98,6 +98,9 @@ class grid {
         /** The sizes of the pad widths along the three directions - padX, padY, padZ */
         blitz::TinyVector<int, 3> padWidths;
 
+        /** The number of extra points appended along each direction to the storage of 3D arrays, beyond their pads */
+        blitz::TinyVector<int, 3> allocPads;
+
         /** The size of the entire computational domain excluding the pads at the boundary of full domain - globalNx, globalNy, globalNz */
         blitz::TinyVector<int, 3> globalSize;
 
@@ -165,7 +168,7 @@ class grid {
 
         /*****************************************************************************************************************************************************/
 
-        grid(const parser &solParam, parallel &parallelData);
+        grid(const parser &solParam, parallel &parallelData, const int refFactor = 1);
 
         /**
         ********************************************************************************************************************************************
@@ -189,6 +192,37 @@ class grid {
             return core;
         }
 
+        /**
+        ********************************************************************************************************************************************
+        * \brief   Function to allocate a 3D blitz array whose storage is larger than its extent along the inner dimensions
+        *
+        *          When the sizes of arrays are powers of 2, points that are one row or one plane apart map to the same cache sets,
+        *          and stencil operations suffer from cache conflicts.
+        *          Here the storage is allocated with extra points along each direction, and the array is made to reference the
+        *          part of it with the required size and lower bounds.
+        *          The array retains its indexing, but its strides along X and Y include the extra points.
+        *          The extra points lie at the end of each row and plane, so that the first element of the array is also the
+        *          first element of the storage.
+        *          As a result, MPI and HDF5 datatypes that describe the array need only use the size of the storage.
+        *
+        * \param   A is the blitz array to be allocated
+        * \param   aSize is the size of the array
+        * \param   aLBound is the lower bound of the indices of the array
+        * \param   aPads is the number of extra points in the storage along each direction
+        ********************************************************************************************************************************************
+        */
+        template <typename T>
+        static void allocPadded(blitz::Array<T, 3> &A, const blitz::TinyVector<int, 3> aSize,
+                                const blitz::TinyVector<int, 3> aLBound, const blitz::TinyVector<int, 3> aPads) {
+            blitz::TinyVector<int, 3> sSize;
+            sSize = aSize + aPads;
+
+            blitz::Array<T, 3> storage(sSize);
+
+            A.reference(storage(blitz::Range(0, aSize(0) - 1), blitz::Range(0, aSize(1) - 1), blitz::Range(0, aSize(2) - 1)));
+            A.reindexSelf(aLBound);
+        }
+
         /**
         ********************************************************************************************************************************************
         * \brief   Function to check if a given set of global indices lie within a rank
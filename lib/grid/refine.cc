@@ -0,0 +1,206 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file refine.cc
+ *
+ *  \brief Definitions for functions of class refine
+ *  \sa refine.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include <algorithm>
+
+#include "refine.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the refine class
+ *
+ *          The constructor checks that each sub-domain of the fine grid covers the same region as the corresponding
+ *          sub-domain of the coarse grid, and computes the interpolation and averaging weights along each direction.
+ *
+ * \param   coarseMesh is a const reference to the coarse grid
+ * \param   fineMesh is a const reference to the fine grid, whose sizes are integer multiples of the coarse grid
+ ********************************************************************************************************************************************
+ */
+refine::refine(const grid &coarseMesh, const grid &fineMesh): cMesh(coarseMesh), fMesh(fineMesh) {
+    for (int i = 0; i < 3; i++) {
+        rFactor(i) = fMesh.coreSize(i)/cMesh.coreSize(i);
+
+        if (rFactor(i)*cMesh.coreSize(i) != fMesh.coreSize(i) or rFactor(i)*cMesh.subarrayStarts(i) != fMesh.subarrayStarts(i)) {
+            if (cMesh.rankData.rank == 0) {
+                std::cout << "ERROR: Sub-domains of the refined grid are not aligned with those of the coarse grid. Aborting" << std::endl;
+            }
+            MPI_Finalize();
+            exit(0);
+        }
+    }
+
+    setWeights(0, cMesh.x, fMesh.x, fMesh.xi_x, xLow, xWgt, xFrc);
+    setWeights(1, cMesh.y, fMesh.y, fMesh.et_y, yLow, yWgt, yFrc);
+    setWeights(2, cMesh.z, fMesh.z, fMesh.zt_z, zLow, zWgt, zFrc);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the interpolation and averaging weights along a given direction
+ *
+ *          For each fine node in the core and in the first layer of pads, the coarse node on its lower side is located,
+ *          and the weight of this node for linear interpolation is computed from the physical coordinates.
+ *          Fine nodes lying between the first (or last) coarse node and the boundary of the sub-domain are interpolated
+ *          using the first layer of pads of the coarse data.
+ *          The fraction of its coarse cell covered by each fine cell is the ratio of the widths of the cells in physical
+ *          space, which is obtained from the grid metrics of the fine grid.
+ *
+ * \param   dim is an integer value that defines the direction along which the weights are computed: 0 -> X, 1 -> Y, 2 -> Z
+ * \param   xC is a const reference to the coordinates of the coarse grid along the direction
+ * \param   xF is a const reference to the coordinates of the fine grid along the direction
+ * \param   mF is a const reference to the derivative of the transformed coordinate of the fine grid along the direction
+ * \param   iLow is a reference to the array in which the indices of the lower coarse nodes are stored
+ * \param   wLow is a reference to the array in which the interpolation weights of the lower coarse nodes are stored
+ * \param   fFrc is a reference to the array in which the fractions of the coarse cells covered by the fine cells are stored
+ ********************************************************************************************************************************************
+ */
+void refine::setWeights(const int dim, const blitz::Array<real, 1> &xC, const blitz::Array<real, 1> &xF, const blitz::Array<real, 1> &mF,
+                        blitz::Array<int, 1> &iLow, blitz::Array<real, 1> &wLow, blitz::Array<real, 1> &fFrc) {
+    int r = rFactor(dim);
+    int nF = fMesh.coreSize(dim);
+
+    iLow.resize(blitz::Range(-1, nF));
+    wLow.resize(blitz::Range(-1, nF));
+    fFrc.resize(nF);
+
+    // THE FIRST LAYER OF PADS OF THE FINE GRID LIES WITHIN THE FIRST (OR LAST) CELL OF THE COARSE GRID, AND IS ALSO INTERPOLATED
+    for (int i = -1; i <= nF; i++) {
+        if (r == 1) {
+            iLow(i) = std::min(i, nF - 1);
+            wLow(i) = (i < nF)? 1.0: 0.0;
+            continue;
+        }
+
+        int iC = std::max(i, 0)/r;
+
+        iLow(i) = (xF(i) < xC(iC))? iC - 1: iC;
+        wLow(i) = (xC(iLow(i) + 1) - xF(i))/(xC(iLow(i) + 1) - xC(iLow(i)));
+    }
+
+    // THE WIDTH OF A CELL IN PHYSICAL SPACE IS PROPORTIONAL TO THE INVERSE OF THE METRIC, AS dXi IS UNIFORM
+    for (int iC = 0; iC < nF/r; iC++) {
+        real cWidth = 0.0;
+        for (int i = iC*r; i < (iC + 1)*r; i++) cWidth += 1.0/mF(i);
+        for (int i = iC*r; i < (iC + 1)*r; i++) fFrc(i) = 1.0/(mF(i)*cWidth);
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to interpolate data from the coarse grid to the core and first layer of pads of the fine grid
+ *
+ *          The data is interpolated linearly along each direction.
+ *          The first layer of pads of the coarse data, which holds either the data of neighbouring sub-domains or the
+ *          values set by boundary conditions, must be updated before calling this function.
+ *          The first layer of pads of the fine data is hence consistent with the boundary conditions of the coarse data.
+ *          Deeper pads of the fine data are not updated here.
+ *
+ * \param   cF is a const reference to the data on the coarse grid
+ * \param   fF is a reference to the array on the fine grid into which the interpolated data is written
+ ********************************************************************************************************************************************
+ */
+void refine::prolong(const blitz::Array<real, 3> &cF, blitz::Array<real, 3> &fF) const {
+    blitz::RectDomain<3> core = fMesh.coreDomain;
+
+#pragma omp parallel for num_threads(fMesh.inputParams.nThreads)
+    for (int iX = core.lbound(0) - 1; iX <= core.ubound(0) + 1; iX++) {
+        int i0 = xLow(iX);
+        real wx = xWgt(iX);
+
+        for (int iY = core.lbound(1) - 1; iY <= core.ubound(1) + 1; iY++) {
+            int j0 = yLow(iY);
+            real wy = yWgt(iY);
+
+            for (int iZ = core.lbound(2) - 1; iZ <= core.ubound(2) + 1; iZ++) {
+                int k0 = zLow(iZ);
+                real wz = zWgt(iZ);
+
+                real fLo = wy*(wz*cF(i0, j0, k0) + (1.0 - wz)*cF(i0, j0, k0 + 1)) +
+                           (1.0 - wy)*(wz*cF(i0, j0 + 1, k0) + (1.0 - wz)*cF(i0, j0 + 1, k0 + 1));
+                real fHi = wy*(wz*cF(i0 + 1, j0, k0) + (1.0 - wz)*cF(i0 + 1, j0, k0 + 1)) +
+                           (1.0 - wy)*(wz*cF(i0 + 1, j0 + 1, k0) + (1.0 - wz)*cF(i0 + 1, j0 + 1, k0 + 1));
+
+                fF(iX, iY, iZ) = wx*fLo + (1.0 - wx)*fHi;
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to restrict data from the fine grid to the core of the coarse grid
+ *
+ *          The value at each coarse node is the average of the data over the fine cells lying within the coarse cell,
+ *          weighted by the volumes of the fine cells.
+ *          Pads of the coarse data are not updated here.
+ *
+ * \param   fF is a const reference to the data on the fine grid
+ * \param   cF is a reference to the array on the coarse grid into which the averaged data is written
+ ********************************************************************************************************************************************
+ */
+void refine::coarsen(const blitz::Array<real, 3> &fF, blitz::Array<real, 3> &cF) const {
+    blitz::RectDomain<3> core = cMesh.coreDomain;
+
+#pragma omp parallel for num_threads(cMesh.inputParams.nThreads)
+    for (int iX = core.lbound(0); iX <= core.ubound(0); iX++) {
+        for (int iY = core.lbound(1); iY <= core.ubound(1); iY++) {
+            for (int iZ = core.lbound(2); iZ <= core.ubound(2); iZ++) {
+                real cSum = 0.0;
+
+                for (int i = iX*rFactor(0); i < (iX + 1)*rFactor(0); i++) {
+                    for (int j = iY*rFactor(1); j < (iY + 1)*rFactor(1); j++) {
+                        real wXY = xFrc(i)*yFrc(j);
+
+                        for (int k = iZ*rFactor(2); k < (iZ + 1)*rFactor(2); k++) {
+                            cSum += wXY*zFrc(k)*fF(i, j, k);
+                        }
+                    }
+                }
+
+                cF(iX, iY, iZ) = cSum;
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file refine.h
+ *
+ *  \brief Class declaration of refine
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef REFINE_H
+#define REFINE_H
+
+#include "grid.h"
+
+class refine {
+    private:
+        const grid &cMesh, &fMesh;
+
+        /** Factors by which the fine grid is refined with respect to the coarse grid along X, Y and Z */
+        blitz::TinyVector<int, 3> rFactor;
+
+        /** Index of the coarse node on the lower side of each fine node in the core and first layer of pads, along X, Y and Z */
+        blitz::Array<int, 1> xLow, yLow, zLow;
+
+        /** Weights of the coarse nodes on the lower side of each fine node, for linear interpolation along X, Y and Z */
+        blitz::Array<real, 1> xWgt, yWgt, zWgt;
+
+        /** Fraction of the width of its coarse cell covered by each fine cell in the core, along X, Y and Z */
+        blitz::Array<real, 1> xFrc, yFrc, zFrc;
+
+        void setWeights(const int dim, const blitz::Array<real, 1> &xC, const blitz::Array<real, 1> &xF, const blitz::Array<real, 1> &mF,
+                        blitz::Array<int, 1> &iLow, blitz::Array<real, 1> &wLow, blitz::Array<real, 1> &fFrc);
+
+    public:
+        refine(const grid &coarseMesh, const grid &fineMesh);
+
+        void prolong(const blitz::Array<real, 3> &cF, blitz::Array<real, 3> &fF) const;
+        void coarsen(const blitz::Array<real, 3> &fF, blitz::Array<real, 3> &cF) const;
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class refine refine.h "lib/grid/refine.h"
+ *  \brief Transfers data between a grid and its refined counterpart, when fields are solved on grids of different resolution
+ *
+ *  Both grids are decomposed into sub-domains covering the same regions, so that the transfers need no communication.
+ *  Data is interpolated from the coarse to the fine grid linearly in physical space along each direction, using the pads
+ *  of the coarse data next to the boundaries of the sub-domain.
+ *  Data is transferred from the fine to the coarse grid by averaging over the fine cells within each coarse cell,
+ *  weighted by their volumes, so that the integral of the field over the domain is conserved on stretched grids.
+ ********************************************************************************************************************************************
+ */
+
+#endif
@@ -0,0 +1,351 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file histogram.cc
+ *
+ *  \brief Definitions for functions of class histogram
+ *  \sa histogram.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include "histogram.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the histogram class for hydrodynamic runs
+ *
+ *          The PDFs of the velocity components and the viscous dissipation are computed.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   solverV is a const reference to the velocity vector field
+ * \param   mDiff is the momentum diffusion constant used by the solver
+ ********************************************************************************************************************************************
+ */
+histogram::histogram(const grid &mesh, const vfield &solverV, const real mDiff):
+                     nu(mDiff), kappa(0.0), mesh(mesh), V(solverV), T(NULL)
+{
+    varNames.push_back("Vx");
+#ifndef PLANAR
+    varNames.push_back("Vy");
+#endif
+    varNames.push_back("Vz");
+    varNames.push_back("Dissipation");
+
+    initHistogram();
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the histogram class for scalar runs
+ *
+ *          Along with the PDFs of the velocity components and the viscous dissipation, the PDFs of temperature and
+ *          the local vertical heat flux are also computed.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   solverV is a const reference to the velocity vector field
+ * \param   solverT is a const reference to the temperature scalar field
+ * \param   mDiff is the momentum diffusion constant used by the solver
+ * \param   tDiff is the thermal diffusion constant used by the solver
+ ********************************************************************************************************************************************
+ */
+histogram::histogram(const grid &mesh, const vfield &solverV, const sfield &solverT, const real mDiff, const real tDiff):
+                     nu(mDiff), kappa(tDiff), mesh(mesh), V(solverV), T(&solverT)
+{
+    varNames.push_back("Vx");
+#ifndef PLANAR
+    varNames.push_back("Vy");
+#endif
+    varNames.push_back("Vz");
+    varNames.push_back("Dissipation");
+    varNames.push_back("T");
+    varNames.push_back("Heat Flux");
+
+    initHistogram();
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to allocate the buffers for the histograms
+ *
+ *          The histograms of all the variables and height bands are stored contiguously in a single buffer,
+ *          so that they can be reduced across ranks together.
+ *
+ ********************************************************************************************************************************************
+ */
+void histogram::initHistogram() {
+    // Flag to enable printing to I/O only by 0 rank
+    pf = false;
+    if (mesh.rankData.rank == 0) pf = true;
+
+    numVars = varNames.size();
+    numBins = mesh.inputParams.pdfBins;
+    numBands = (mesh.inputParams.bandHeight > 0.0)? 2: 1;
+
+    binStride = numBins + 3;
+
+    binStart.resize(numVars);
+    binWidth.resize(numVars);
+
+    localBins.resize(numVars*numBands*binStride);
+    if (pf) globalBins.resize(numVars*numBands*binStride);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute all the variables at a given point
+ *
+ *          The derivatives are computed with second-order central differences on the non-uniform grid.
+ *          The dissipation is computed as the product of viscosity and the sum of squares of all velocity gradients.
+ *          The local heat flux is the sum of convective and conductive fluxes along the vertical direction.
+ *
+ * \param   iX is the local index of the point along the X direction
+ * \param   iY is the local index of the point along the Y direction
+ * \param   iZ is the local index of the point along the Z direction
+ * \param   values is a pointer to the array into which the values of the variables are written
+ ********************************************************************************************************************************************
+ */
+inline void histogram::pointValues(int iX, int iY, int iZ, real *values) const {
+    real xFac = mesh.xi_x(iX)/(2.0*mesh.dXi);
+    real zFac = mesh.zt_z(iZ)/(2.0*mesh.dZt);
+    real gradSum = 0.0;
+    int vIndex = 0;
+
+    const blitz::Array<real, 3> &Vx = V.Vx.F;
+    const blitz::Array<real, 3> &Vz = V.Vz.F;
+
+    values[vIndex++] = Vx(iX, iY, iZ);
+#ifdef PLANAR
+    values[vIndex++] = Vz(iX, iY, iZ);
+
+    gradSum += pow((Vx(iX + 1, iY, iZ) - Vx(iX - 1, iY, iZ))*xFac, 2.0);
+    gradSum += pow((Vx(iX, iY, iZ + 1) - Vx(iX, iY, iZ - 1))*zFac, 2.0);
+    gradSum += pow((Vz(iX + 1, iY, iZ) - Vz(iX - 1, iY, iZ))*xFac, 2.0);
+    gradSum += pow((Vz(iX, iY, iZ + 1) - Vz(iX, iY, iZ - 1))*zFac, 2.0);
+#else
+    real yFac = mesh.et_y(iY)/(2.0*mesh.dEt);
+
+    const blitz::Array<real, 3> &Vy = V.Vy.F;
+
+    values[vIndex++] = Vy(iX, iY, iZ);
+    values[vIndex++] = Vz(iX, iY, iZ);
+
+    gradSum += pow((Vx(iX + 1, iY, iZ) - Vx(iX - 1, iY, iZ))*xFac, 2.0);
+    gradSum += pow((Vx(iX, iY + 1, iZ) - Vx(iX, iY - 1, iZ))*yFac, 2.0);
+    gradSum += pow((Vx(iX, iY, iZ + 1) - Vx(iX, iY, iZ - 1))*zFac, 2.0);
+    gradSum += pow((Vy(iX + 1, iY, iZ) - Vy(iX - 1, iY, iZ))*xFac, 2.0);
+    gradSum += pow((Vy(iX, iY + 1, iZ) - Vy(iX, iY - 1, iZ))*yFac, 2.0);
+    gradSum += pow((Vy(iX, iY, iZ + 1) - Vy(iX, iY, iZ - 1))*zFac, 2.0);
+    gradSum += pow((Vz(iX + 1, iY, iZ) - Vz(iX - 1, iY, iZ))*xFac, 2.0);
+    gradSum += pow((Vz(iX, iY + 1, iZ) - Vz(iX, iY - 1, iZ))*yFac, 2.0);
+    gradSum += pow((Vz(iX, iY, iZ + 1) - Vz(iX, iY, iZ - 1))*zFac, 2.0);
+#endif
+    values[vIndex++] = nu*gradSum;
+
+    if (T != NULL) {
+        const blitz::Array<real, 3> &F = T->F.F;
+
+        values[vIndex++] = F(iX, iY, iZ);
+        values[vIndex++] = Vz(iX, iY, iZ)*F(iX, iY, iZ) - kappa*(F(iX, iY, iZ + 1) - F(iX, iY, iZ - 1))*zFac;
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute and write the PDFs at the current time
+ *
+ *          The limits of the histograms are first set from the global extrema of each variable.
+ *          After the histograms are accumulated by each rank, they are summed at the root rank with a single MPI_Reduce.
+ *          The root rank normalizes the histograms and writes the PDFs of all variables and bands into one file,
+ *          with the data of each variable and band in a separate block.
+ *
+ * \param   time is a real value containing the time at which the PDFs are computed
+ ********************************************************************************************************************************************
+ */
+void histogram::writePDF(real time) {
+    findLimits();
+    fillBins();
+
+    MPI_Reduce(&localBins[0], pf? &globalBins[0]: NULL, localBins.size(), MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+
+    if (pf) {
+        std::ofstream ofFile;
+        std::ostringstream constFile;
+
+        constFile << "output/pdf_" << std::fixed << std::setfill('0') << std::setw(9) << std::setprecision(4) << time << ".dat";
+
+        ofFile.open(constFile.str().c_str(), std::fstream::out | std::fstream::trunc);
+        if (not ofFile.is_open()) {
+            std::cout << "WARNING: Unable to open file " << constFile.str() << " for writing PDFs. Skipping" << std::endl;
+            return;
+        }
+
+        ofFile << "# PDFs at time " << std::fixed << std::setprecision(4) << time << std::endl;
+        ofFile << std::scientific << std::setprecision(8);
+
+        for (int v=0; v < numVars; v++) {
+            for (int b=0; b < numBands; b++) {
+                const double *hist = &globalBins[(v*numBands + b)*binStride];
+                double totWeight = hist[numBins];
+                double varMean = totWeight > 0.0? hist[numBins + 1]/totWeight: 0.0;
+                double varStdv = totWeight > 0.0? sqrt(std::max(hist[numBins + 2]/totWeight - varMean*varMean, 0.0)): 0.0;
+
+                ofFile << std::endl << std::endl;
+                ofFile << "# Variable: " << varNames[v];
+                if (numBands == 1) ofFile << ", Band: Full domain";
+                else ofFile << ", Band: " << (b == 0? "Near-wall": "Bulk");
+                ofFile << ", Mean: " << varMean << ", Std. dev.: " << varStdv << std::endl;
+                ofFile << "#VARIABLES = Bin centre, PDF" << std::endl;
+
+                for (int n=0; n < numBins; n++) {
+                    ofFile << std::setw(20) << binStart[v] + (n + 0.5)*binWidth[v] <<
+                              std::setw(20) << (totWeight > 0.0? hist[n]/(totWeight*binWidth[v]): 0.0) << std::endl;
+                }
+            }
+        }
+
+        ofFile.close();
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to set the limits of the histograms from the global extrema of all variables
+ *
+ *          Each thread finds the extrema of all variables over its part of the sub-domain in one sweep.
+ *          The extrema are packed as maxima of the values and their negatives, so that a single MPI_Allreduce gives both limits.
+ *
+ ********************************************************************************************************************************************
+ */
+void histogram::findLimits() {
+    blitz::RectDomain<3> core = mesh.coreDomain;
+    std::vector<real> localExt(2*numVars, -std::numeric_limits<real>::max());
+    std::vector<real> globalExt(2*numVars);
+
+#pragma omp parallel num_threads(mesh.inputParams.nThreads)
+    {
+        std::vector<real> values(numVars);
+        std::vector<real> threadExt(2*numVars, -std::numeric_limits<real>::max());
+
+#pragma omp for
+        for (int iX = core.lbound(0); iX <= core.ubound(0); iX++) {
+            for (int iY = core.lbound(1); iY <= core.ubound(1); iY++) {
+                for (int iZ = core.lbound(2); iZ <= core.ubound(2); iZ++) {
+                    pointValues(iX, iY, iZ, &values[0]);
+
+                    for (int v=0; v < numVars; v++) {
+                        threadExt[v] = std::max(threadExt[v], values[v]);
+                        threadExt[numVars + v] = std::max(threadExt[numVars + v], -values[v]);
+                    }
+                }
+            }
+        }
+
+#pragma omp critical
+        for (int i=0; i < 2*numVars; i++) localExt[i] = std::max(localExt[i], threadExt[i]);
+    }
+
+    MPI_Allreduce(&localExt[0], &globalExt[0], 2*numVars, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+
+    for (int v=0; v < numVars; v++) {
+        real varMax = globalExt[v];
+        real varMin = -globalExt[numVars + v];
+
+        // A VARIABLE WITH THE SAME VALUE EVERYWHERE IS PLACED IN A UNIT-WIDTH RANGE AROUND THE VALUE
+        if (varMax - varMin <= std::numeric_limits<real>::epsilon()*std::max(std::abs(varMax), real(1.0))) {
+            varMin -= 0.5;
+            varMax += 0.5;
+        }
+
+        binStart[v] = varMin;
+        binWidth[v] = (varMax - varMin)/numBins;
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to accumulate the histograms of all variables over the sub-domain of the rank
+ *
+ *          All the variables are computed at each point in a single sweep, and added to the histogram of the band in which
+ *          the point lies, weighted by the volume of the cell so that the PDFs are correct on non-uniform grids.
+ *          Each thread accumulates into its own copy of the histograms, which are summed at the end of the sweep.
+ *
+ ********************************************************************************************************************************************
+ */
+void histogram::fillBins() {
+    blitz::RectDomain<3> core = mesh.coreDomain;
+
+    std::fill(localBins.begin(), localBins.end(), 0.0);
+
+#pragma omp parallel num_threads(mesh.inputParams.nThreads)
+    {
+        std::vector<real> values(numVars);
+        std::vector<double> threadBins(localBins.size(), 0.0);
+
+#pragma omp for
+        for (int iX = core.lbound(0); iX <= core.ubound(0); iX++) {
+            for (int iY = core.lbound(1); iY <= core.ubound(1); iY++) {
+                for (int iZ = core.lbound(2); iZ <= core.ubound(2); iZ++) {
+#ifdef PLANAR
+                    double cellVol = (mesh.dXi/mesh.xi_x(iX))*(mesh.dZt/mesh.zt_z(iZ));
+#else
+                    double cellVol = (mesh.dXi/mesh.xi_x(iX))*(mesh.dEt/mesh.et_y(iY))*(mesh.dZt/mesh.zt_z(iZ));
+#endif
+                    int bOffset = bandIndex(iZ)*binStride;
+
+                    pointValues(iX, iY, iZ, &values[0]);
+
+                    for (int v=0; v < numVars; v++) {
+                        double *hist = &threadBins[v*numBands*binStride + bOffset];
+                        int binIndex = std::min(std::max(int((values[v] - binStart[v])/binWidth[v]), 0), numBins - 1);
+
+                        hist[binIndex] += cellVol;
+                        hist[numBins] += cellVol;
+                        hist[numBins + 1] += cellVol*values[v];
+                        hist[numBins + 2] += cellVol*values[v]*values[v];
+                    }
+                }
+            }
+        }
+
+#pragma omp critical
+        for (unsigned int i=0; i < localBins.size(); i++) localBins[i] += threadBins[i];
+    }
+}
@@ -0,0 +1,135 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file histogram.h
+ *
+ *  \brief Class declaration of histogram
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+
+#include "sfield.h"
+#include "vfield.h"
+
+class histogram {
+    public:
+        histogram(const grid &mesh, const vfield &solverV, const real mDiff);
+        histogram(const grid &mesh, const vfield &solverV, const sfield &solverT, const real mDiff, const real tDiff);
+
+        void writePDF(real time);
+
+        ~histogram() { };
+
+    private:
+        // Print flag - basically flag to ease printing to I/O. It is true for root rank (0)
+        bool pf;
+
+        /** Number of variables, height bands and bins of each histogram */
+        int numVars, numBands, numBins;
+
+        /** Number of values stored for each histogram - the bins followed by total weight, first and second moments */
+        int binStride;
+
+        /** Momentum and thermal diffusion constants used to compute the dissipation and heat flux */
+        real nu, kappa;
+
+        const grid &mesh;
+
+        const vfield &V;
+
+        /** Pointer to the temperature field, which is NULL for hydrodynamic runs */
+        const sfield *T;
+
+        std::vector<std::string> varNames;
+
+        /** Lower limit and bin width of the histogram of each variable */
+        std::vector<real> binStart, binWidth;
+
+        /** Histograms accumulated by the rank, and the histograms reduced at the root rank */
+        std::vector<double> localBins, globalBins;
+
+        void initHistogram();
+        void findLimits();
+        void fillBins();
+
+        /**
+        ********************************************************************************************************************************************
+        * \brief   Function to find the height band in which a point lies
+        *
+        *          Band 0 consists of the layers adjacent to the bottom and top walls, and band 1 is the bulk.
+        *          When the PDFs are not conditioned on height, all points lie in band 0.
+        *
+        * \param   iZ is the local index of the point along the Z direction
+        *
+        * \return  The index of the band in which the point lies
+        ********************************************************************************************************************************************
+        */
+        inline int bandIndex(int iZ) const {
+            if (numBands == 1) return 0;
+
+            return ((mesh.z(iZ) < mesh.inputParams.bandHeight) or (mesh.z(iZ) > mesh.zLen - mesh.inputParams.bandHeight))? 0: 1;
+        };
+
+        inline void pointValues(int iX, int iY, int iZ, real *values) const;
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class histogram histogram.h "lib/io/histogram.h"
+ *  \brief Computes the PDFs of velocity, dissipation, temperature and local heat flux while the solver runs
+ *
+ *  All the variables are computed at each point of the sub-domain in a single sweep, and the histograms of all variables
+ *  are accumulated together by the OpenMP threads of each rank.
+ *  The histograms, along with the first two moments of each variable, are packed into a single buffer so that they are
+ *  merged at the root rank with one MPI_Reduce per output.
+ *  Optionally, the PDFs can be conditioned on height, with separate histograms for the near-wall layers and the bulk.
+ *  This avoids writing full 3D solution files only to compute the PDFs during post-processing.
+ ********************************************************************************************************************************************
+ */
+
+#endif
@@ -0,0 +1,210 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file iotune.cc
+ *
+ *  \brief Definitions for functions of class iotune
+ *  \sa iotune.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include "iotune.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the iotune class
+ *
+ *          The constructor creates the MPI_Info object with the MPI-IO hints set by the user.
+ *          Only the hints with non-zero values are set, so that the MPI-IO library uses its own defaults for the rest.
+ *
+ * \param   solParam is a const reference to the user-set parameters contained in the parser class
+ ********************************************************************************************************************************************
+ */
+iotune::iotune(const parser &solParam): inputParams(solParam) {
+    // STRIPE SIZE IS SPECIFIED IN MB BY THE USER
+    stripeBytes = hsize_t(inputParams.stripeSize)*1048576;
+
+    MPI_Info_create(&ioInfo);
+
+    // HINTS FOR COLLECTIVE BUFFERING. BUFFER SIZE IS SPECIFIED IN MB BY THE USER
+    setHint("cb_nodes", inputParams.cbNodes);
+    setHint("cb_buffer_size", inputParams.cbBufSize*1048576);
+
+    // HINTS FOR STRIPING OF NEWLY CREATED FILES ON PARALLEL FILE SYSTEMS LIKE LUSTRE
+    setHint("striping_factor", inputParams.stripeCount);
+    setHint("striping_unit", inputParams.stripeSize*1048576);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to add a single integer valued hint to the MPI_Info object
+ *
+ *          Hints with zero value are skipped, so that the defaults of the MPI-IO library are retained.
+ *
+ * \param   key is the name of the MPI-IO hint
+ * \param   value is the integer value of the hint
+ ********************************************************************************************************************************************
+ */
+void iotune::setHint(const char *key, const int value) {
+    std::ostringstream hintValue;
+
+    if (value > 0) {
+        hintValue << value;
+        MPI_Info_set(ioInfo, key, hintValue.str().c_str());
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to create the file access property list for opening files collectively
+ *
+ *          Apart from setting the MPI-IO driver with the hints, the alignment of datasets to the stripe size,
+ *          the size of metadata blocks and collective metadata operations are set here as specified by the user.
+ *          The calling function must close the property list after use.
+ *
+ * \return  The HDF5 identifier of the file access property list
+ ********************************************************************************************************************************************
+ */
+hid_t iotune::fileAccess() const {
+    hid_t plist_id;
+
+    plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(plist_id, MPI_COMM_WORLD, ioInfo);
+
+    // ALIGN ALL OBJECTS AT LEAST AS LARGE AS A STRIPE TO THE STRIPE BOUNDARIES
+    if (stripeBytes > 0) H5Pset_alignment(plist_id, stripeBytes, stripeBytes);
+
+    // METADATA BLOCK SIZE IS SPECIFIED IN KB BY THE USER
+    if (inputParams.metaBlockSize > 0) H5Pset_meta_block_size(plist_id, hsize_t(inputParams.metaBlockSize)*1024);
+
+#if H5_VERSION_GE(1, 10, 0)
+    if (inputParams.collMetadata) {
+        H5Pset_all_coll_metadata_ops(plist_id, true);
+        H5Pset_coll_metadata_write(plist_id, true);
+    }
+#endif
+
+    return plist_id;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to create the dataset creation property list for the field datasets
+ *
+ *          If early allocation is enabled, the space for the dataset is allocated in the file when it is created,
+ *          and the writing of fill values is disabled since the entire dataset is written immediately after.
+ *          The calling function must close the property list after use.
+ *
+ * \return  The HDF5 identifier of the dataset creation property list
+ ********************************************************************************************************************************************
+ */
+hid_t iotune::dataCreate() const {
+    hid_t plist_id;
+
+    plist_id = H5Pcreate(H5P_DATASET_CREATE);
+
+    if (inputParams.earlyAlloc) {
+        H5Pset_alloc_time(plist_id, H5D_ALLOC_TIME_EARLY);
+        H5Pset_fill_time(plist_id, H5D_FILL_TIME_NEVER);
+    }
+
+    return plist_id;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to create the data transfer property list for collective reads and writes
+ *
+ *          The calling function must close the property list after use.
+ *
+ * \return  The HDF5 identifier of the data transfer property list
+ ********************************************************************************************************************************************
+ */
+hid_t iotune::dataTransfer() const {
+    hid_t plist_id;
+
+    plist_id = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+
+    return plist_id;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to print the I/O tuning parameters to the standard output
+ *
+ *          The function must be called only by the root rank.
+ *          Parameters left to their defaults are reported as such.
+ *
+ ********************************************************************************************************************************************
+ */
+void iotune::printTuning() const {
+    std::cout << "Parallel I/O settings:" << std::endl;
+
+    if (inputParams.cbNodes > 0) std::cout << "\tCollective buffering nodes: " << inputParams.cbNodes << std::endl;
+    else std::cout << "\tCollective buffering nodes: MPI-IO default" << std::endl;
+
+    if (inputParams.cbBufSize > 0) std::cout << "\tCollective buffer size: " << inputParams.cbBufSize << " MB" << std::endl;
+    else std::cout << "\tCollective buffer size: MPI-IO default" << std::endl;
+
+    if (inputParams.stripeCount > 0) std::cout << "\tStripe count: " << inputParams.stripeCount << std::endl;
+    else std::cout << "\tStripe count: file system default" << std::endl;
+
+    if (inputParams.stripeSize > 0) std::cout << "\tStripe size and dataset alignment: " << inputParams.stripeSize << " MB" << std::endl;
+    else std::cout << "\tStripe size: file system default, datasets are not aligned" << std::endl;
+
+    if (inputParams.metaBlockSize > 0) std::cout << "\tMetadata block size: " << inputParams.metaBlockSize << " KB" << std::endl;
+    else std::cout << "\tMetadata block size: HDF5 default" << std::endl;
+
+#if H5_VERSION_GE(1, 10, 0)
+    std::cout << "\tCollective metadata operations: " << (inputParams.collMetadata? "enabled": "disabled") << std::endl;
+#else
+    std::cout << "\tCollective metadata operations: not supported by HDF5 version" << std::endl;
+#endif
+
+    std::cout << "\tEarly allocation of datasets: " << (inputParams.earlyAlloc? "enabled": "disabled") << std::endl;
+
+    std::cout << std::endl;
+}
+
+
+iotune::~iotune() {
+    MPI_Info_free(&ioInfo);
+}
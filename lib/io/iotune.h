@@ -0,0 +1,88 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file iotune.h
+ *
+ *  \brief Class declaration of iotune
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef IOTUNE_H
+#define IOTUNE_H
+
+#include <iostream>
+#include <sstream>
+
+#include "parser.h"
+#include "hdf5.h"
+#include "mpi.h"
+
+class iotune {
+    public:
+        iotune(const parser &solParam);
+
+        hid_t fileAccess() const;
+        hid_t dataCreate() const;
+        hid_t dataTransfer() const;
+
+        void printTuning() const;
+
+        ~iotune();
+
+    private:
+        const parser &inputParams;
+
+        /** MPI_Info object holding the MPI-IO hints passed to the MPI-IO driver of HDF5 */
+        MPI_Info ioInfo;
+
+        /** Stripe size in bytes, which is also used to align the datasets in the HDF5 file */
+        hsize_t stripeBytes;
+
+        void setHint(const char *key, const int value);
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class iotune iotune.h "lib/io/iotune.h"
+ *  \brief Class to set the MPI-IO hints and HDF5 properties used for parallel file I/O
+ *
+ *  The MPI-IO hints for collective buffering and file striping, along with the HDF5 properties for alignment, metadata and
+ *  dataset allocation are all set by the user in the parameters file.
+ *  The writer and reader classes obtain their property lists from this class instead of using the defaults.
+ ********************************************************************************************************************************************
+ */
+
+#endif
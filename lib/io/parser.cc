@@ -41,7 +41,10 @@
  */
 
 #include <iostream>
+#include <cstdlib>
+#include <algorithm>
 #include "parser.h"
+#include "planner.h"
 #include "mpi.h"
 
 parser::parser() {
@@ -50,6 +53,7 @@ parser::parser() {
 
     setGrids();
     setPeriodicity();
+    setSymmetry();
 
     if (readProbes) {
         parseProbes();
@@ -72,6 +76,8 @@ void parser::parseYAML() {
     inFile.open("input/parameters.yaml", std::ifstream::in);
 
 #ifdef YAML_LEGACY
+    std::string npString;
+
     YAML::Node yamlNode;
     YAML::Parser parser(inFile);
 
@@ -83,10 +89,16 @@ void parser::parseYAML() {
     yamlNode["Program"]["Initial Condition"] >> icType;
     yamlNode["Program"]["Mean Flow Velocity"] >> meanVelocity;
     yamlNode["Program"]["Perturbation Intensity"] >> rfIntensity;
+    yamlNode["Program"]["Inflow BC"] >> inflowBC;
+    yamlNode["Program"]["Recycling Plane"] >> recPlane;
+    yamlNode["Program"]["Outflow BC"] >> outflowBC;
     yamlNode["Program"]["Domain Type"] >> domainType;
+    yamlNode["Program"]["Symmetry Planes"] >> symmetryType;
     yamlNode["Program"]["RBC Type"] >> rbcType;
 
     yamlNode["Program"]["LES Model"] >> lesModel;
+    yamlNode["Program"]["Wall Model"] >> wmFlag;
+    yamlNode["Program"]["Wall Model Layer"] >> wmLayer;
 
     yamlNode["Program"]["Reynolds Number"] >> Re;
     yamlNode["Program"]["Rossby Number"] >> Ro;
@@ -102,6 +114,7 @@ void parser::parseYAML() {
     yamlNode["Program"]["Plate Radius"] >> patchRadius;
 
     yamlNode["Program"]["Force"] >> forceType;
+    yamlNode["Program"]["Exact Coriolis"] >> exactCoriolis;
     yamlNode["Program"]["Mean Pressure Gradient"] >> meanPGrad;
 
     /********** Mesh parameters **********/
@@ -116,18 +129,32 @@ void parser::parseYAML() {
     yamlNode["Mesh"]["Y Index"] >> yInd;
     yamlNode["Mesh"]["Z Index"] >> zInd;
 
+    yamlNode["Mesh"]["Scalar Refinement"] >> sRefine;
+
     /********** Parallelization parameters **********/
 
     yamlNode["Parallel"]["Number of OMP threads"] >> nThreads;
 
-    yamlNode["Parallel"]["X Number of Procs"] >> npX;
-    yamlNode["Parallel"]["Y Number of Procs"] >> npY;
+    yamlNode["Parallel"]["X Number of Procs"] >> npString;
+    npX = parseProcs(npString, autoNpX);
+    yamlNode["Parallel"]["Y Number of Procs"] >> npString;
+    npY = parseProcs(npString, autoNpY);
+
+    yamlNode["Parallel"]["Ranks per Node"] >> nodeSize;
+
+    yamlNode["Parallel"]["Progress Thread"] >> progThread;
+
+    yamlNode["Parallel"]["Comm Profile"] >> commProf;
 
     /********** Solver parameters **********/
 
     yamlNode["Solver"]["Differentiation Scheme"] >> dScheme;
+    yamlNode["Solver"]["Advection Scheme"] >> aScheme;
     yamlNode["Solver"]["Integration Scheme"] >> iScheme;
     yamlNode["Solver"]["Solve Tolerance"] >> cnTolerance;
+    yamlNode["Solver"]["Temporal Block Size"] >> tBlock;
+    yamlNode["Solver"]["Pressure Gradient Refresh"] >> gpRefresh;
+    yamlNode["Solver"]["Allocation Padding"] >> allocPad;
 
     yamlNode["Solver"]["Restart Run"] >> restartFlag;
 
@@ -140,13 +167,38 @@ void parser::parseYAML() {
     yamlNode["Solver"]["Solution Format"] >> solnFormat;
     yamlNode["Solver"]["Solution Write Interval"] >> fwInt;
     yamlNode["Solver"]["Restart Write Interval"] >> rsInt;
+    yamlNode["Solver"]["Restart Format"] >> rsFormat;
+
+    yamlNode["Solver"]["Collective Buffering Nodes"] >> cbNodes;
+    yamlNode["Solver"]["Collective Buffer Size"] >> cbBufSize;
+    yamlNode["Solver"]["Stripe Count"] >> stripeCount;
+    yamlNode["Solver"]["Stripe Size"] >> stripeSize;
+    yamlNode["Solver"]["Metadata Block Size"] >> metaBlockSize;
+    yamlNode["Solver"]["Collective Metadata"] >> collMetadata;
+    yamlNode["Solver"]["Early Allocation"] >> earlyAlloc;
 
     yamlNode["Solver"]["Record Probes"] >> readProbes;
     yamlNode["Solver"]["Probe Time Interval"] >> prInt;
     yamlNode["Solver"]["Probes"] >> probeCoords;
 
+    yamlNode["Solver"]["Render Slices"] >> renderSlices;
+    yamlNode["Solver"]["Render Time Interval"] >> rdInt;
+    yamlNode["Solver"]["Render Variable"] >> renderVar;
+    yamlNode["Solver"]["Render Plane"] >> renderPlane;
+    yamlNode["Solver"]["Render Plane Index"] >> renderIndex;
+    yamlNode["Solver"]["Render Minimum"] >> renderMin;
+    yamlNode["Solver"]["Render Maximum"] >> renderMax;
+    yamlNode["Solver"]["Image Format"] >> imgFormat;
+
+    yamlNode["Solver"]["Record PDFs"] >> recordPDFs;
+    yamlNode["Solver"]["PDF Time Interval"] >> pdInt;
+    yamlNode["Solver"]["PDF Bin Count"] >> pdfBins;
+    yamlNode["Solver"]["PDF Band Height"] >> bandHeight;
+
     /********** Multigrid parameters **********/
 
+    yamlNode["Multigrid"]["Poisson Solver"] >> pSolver;
+
     yamlNode["Multigrid"]["V-Cycle Depth"] >> vcDepth;
     yamlNode["Multigrid"]["V-Cycle Count"] >> vcCount;
 
@@ -157,6 +209,11 @@ void parser::parseYAML() {
     yamlNode["Multigrid"]["Pre-Smoothing Count"] >> preSmooth;
     yamlNode["Multigrid"]["Post-Smoothing Count"] >> postSmooth;
 
+    yamlNode["Multigrid"]["Brick Layout"] >> brickLayout;
+    yamlNode["Multigrid"]["Sub-block Size"] >> sbSize;
+
+    yamlNode["Multigrid"]["Float Smoother Pads"] >> floatPads;
+
     yamlNode["Multigrid"]["Residual Type"] >> resType;
     yamlNode["Multigrid"]["Print Residual"] >> printResidual;
 
@@ -169,10 +226,16 @@ void parser::parseYAML() {
     icType = yamlNode["Program"]["Initial Condition"].as<int>();
     meanVelocity = yamlNode["Program"]["Mean Flow Velocity"].as<real>();
     rfIntensity = yamlNode["Program"]["Perturbation Intensity"].as<real>();
+    inflowBC = yamlNode["Program"]["Inflow BC"].as<int>();
+    recPlane = yamlNode["Program"]["Recycling Plane"].as<real>();
+    outflowBC = yamlNode["Program"]["Outflow BC"].as<int>();
     domainType = yamlNode["Program"]["Domain Type"].as<std::string>();
+    symmetryType = yamlNode["Program"]["Symmetry Planes"].as<std::string>();
     rbcType = yamlNode["Program"]["RBC Type"].as<int>();
 
     lesModel = yamlNode["Program"]["LES Model"].as<int>();
+    wmFlag = yamlNode["Program"]["Wall Model"].as<bool>();
+    wmLayer = yamlNode["Program"]["Wall Model Layer"].as<int>();
 
     Re = yamlNode["Program"]["Reynolds Number"].as<real>();
     Ro = yamlNode["Program"]["Rossby Number"].as<real>();
@@ -188,6 +251,7 @@ void parser::parseYAML() {
     patchRadius = yamlNode["Program"]["Plate Radius"].as<real>();
 
     forceType = yamlNode["Program"]["Force"].as<int>();
+    exactCoriolis = yamlNode["Program"]["Exact Coriolis"].as<bool>();
     meanPGrad = yamlNode["Program"]["Mean Pressure Gradient"].as<real>();
 
     /********** Mesh parameters **********/
@@ -202,18 +266,30 @@ void parser::parseYAML() {
     yInd = yamlNode["Mesh"]["Y Index"].as<int>();
     zInd = yamlNode["Mesh"]["Z Index"].as<int>();
 
+    sRefine = yamlNode["Mesh"]["Scalar Refinement"].as<int>();
+
     /********** Parallelization parameters **********/
 
     nThreads = yamlNode["Parallel"]["Number of OMP threads"].as<int>();
 
-    npX = yamlNode["Parallel"]["X Number of Procs"].as<int>();
-    npY = yamlNode["Parallel"]["Y Number of Procs"].as<int>();
+    npX = parseProcs(yamlNode["Parallel"]["X Number of Procs"].as<std::string>(), autoNpX);
+    npY = parseProcs(yamlNode["Parallel"]["Y Number of Procs"].as<std::string>(), autoNpY);
+
+    nodeSize = yamlNode["Parallel"]["Ranks per Node"].as<int>();
+
+    progThread = yamlNode["Parallel"]["Progress Thread"].as<bool>();
+
+    commProf = yamlNode["Parallel"]["Comm Profile"].as<bool>();
 
     /********** Solver parameters **********/
 
     dScheme = yamlNode["Solver"]["Differentiation Scheme"].as<int>();
+    aScheme = yamlNode["Solver"]["Advection Scheme"].as<int>();
     iScheme = yamlNode["Solver"]["Integration Scheme"].as<int>();
     cnTolerance = yamlNode["Solver"]["Solve Tolerance"].as<real>();
+    tBlock = yamlNode["Solver"]["Temporal Block Size"].as<int>();
+    gpRefresh = yamlNode["Solver"]["Pressure Gradient Refresh"].as<int>();
+    allocPad = yamlNode["Solver"]["Allocation Padding"].as<int>();
 
     restartFlag = yamlNode["Solver"]["Restart Run"].as<bool>();
 
@@ -226,13 +302,38 @@ void parser::parseYAML() {
     solnFormat = yamlNode["Solver"]["Solution Format"].as<int>();
     fwInt = yamlNode["Solver"]["Solution Write Interval"].as<real>();
     rsInt = yamlNode["Solver"]["Restart Write Interval"].as<real>();
+    rsFormat = yamlNode["Solver"]["Restart Format"].as<int>();
+
+    cbNodes = yamlNode["Solver"]["Collective Buffering Nodes"].as<int>();
+    cbBufSize = yamlNode["Solver"]["Collective Buffer Size"].as<int>();
+    stripeCount = yamlNode["Solver"]["Stripe Count"].as<int>();
+    stripeSize = yamlNode["Solver"]["Stripe Size"].as<int>();
+    metaBlockSize = yamlNode["Solver"]["Metadata Block Size"].as<int>();
+    collMetadata = yamlNode["Solver"]["Collective Metadata"].as<bool>();
+    earlyAlloc = yamlNode["Solver"]["Early Allocation"].as<bool>();
 
     readProbes = yamlNode["Solver"]["Record Probes"].as<bool>();
     prInt = yamlNode["Solver"]["Probe Time Interval"].as<real>();
     probeCoords = yamlNode["Solver"]["Probes"].as<std::string>();
 
+    renderSlices = yamlNode["Solver"]["Render Slices"].as<bool>();
+    rdInt = yamlNode["Solver"]["Render Time Interval"].as<real>();
+    renderVar = yamlNode["Solver"]["Render Variable"].as<std::string>();
+    renderPlane = yamlNode["Solver"]["Render Plane"].as<int>();
+    renderIndex = yamlNode["Solver"]["Render Plane Index"].as<int>();
+    renderMin = yamlNode["Solver"]["Render Minimum"].as<real>();
+    renderMax = yamlNode["Solver"]["Render Maximum"].as<real>();
+    imgFormat = yamlNode["Solver"]["Image Format"].as<int>();
+
+    recordPDFs = yamlNode["Solver"]["Record PDFs"].as<bool>();
+    pdInt = yamlNode["Solver"]["PDF Time Interval"].as<real>();
+    pdfBins = yamlNode["Solver"]["PDF Bin Count"].as<int>();
+    bandHeight = yamlNode["Solver"]["PDF Band Height"].as<real>();
+
     /********** Multigrid parameters **********/
 
+    pSolver = yamlNode["Multigrid"]["Poisson Solver"].as<int>();
+
     vcDepth = yamlNode["Multigrid"]["V-Cycle Depth"].as<int>();
     vcCount = yamlNode["Multigrid"]["V-Cycle Count"].as<int>();
 
@@ -243,6 +344,11 @@ void parser::parseYAML() {
     preSmooth = yamlNode["Multigrid"]["Pre-Smoothing Count"].as<int>();
     postSmooth = yamlNode["Multigrid"]["Post-Smoothing Count"].as<int>();
 
+    brickLayout = yamlNode["Multigrid"]["Brick Layout"].as<bool>();
+    sbSize = yamlNode["Multigrid"]["Sub-block Size"].as<int>();
+
+    floatPads = yamlNode["Multigrid"]["Float Smoother Pads"].as<bool>();
+
     resType = yamlNode["Multigrid"]["Residual Type"].as<int>();
     printResidual = yamlNode["Multigrid"]["Print Residual"].as<bool>();
 #endif
@@ -276,14 +382,78 @@ void parser::checkData() {
     }
 #endif
 
+    // CHECK IF THE REFINEMENT OF THE SCALAR GRID IS A POWER OF 2, SO THAT THE REFINED GRID REMAINS MULTIGRID COMPATIBLE AND ALIGNED WITH THE SUB-DOMAINS
+    if ((sRefine < 1) or (sRefine & (sRefine - 1))) {
+        std::cout << "ERROR: The refinement of the scalar grid must be a power of 2. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    if ((std::max(xInd, std::max(yInd, zInd)) + int(round(log2(sRefine)))) > 14) {
+        std::cout << "ERROR: The refined scalar grid exceeds the largest grid size supported. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    if ((sRefine > 1) and (lesModel == 2)) {
+        std::cout << "ERROR: The LES model for the scalar field cannot be used with a refined scalar grid. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    // CHECK IF THE INFLOW BC IS VALID, AND IF THE RECYCLING PLANE LIES WITHIN THE DOMAIN
+    if ((inflowBC < 0) or (inflowBC > 1)) {
+        std::cout << "ERROR: Invalid choice of boundary condition at the inflow wall. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    if ((inflowBC == 1) and ((recPlane <= 0.0) or (recPlane >= Lx))) {
+        std::cout << "ERROR: Recycling plane for the inflow does not lie within the domain. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    // CHECK IF THE OUTFLOW BC IS VALID
+    if ((outflowBC < 0) or (outflowBC > 1)) {
+        std::cout << "ERROR: Invalid choice of boundary condition at the outflow wall. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    // CHECK IF THE MATCHING LAYER OF THE WALL MODEL IS VALID
+    if (wmLayer < 0) {
+        std::cout << "ERROR: Matching layer of the wall model must be non-negative. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    if (wmFlag and (sRefine > 1)) {
+        std::cout << "ERROR: The wall model cannot be used with a refined scalar grid. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+#ifdef PLANAR
+    if (sRefine > 1) {
+        std::cout << "WARNING: Refined scalar grid is available only for 3D runs. Solving the scalar on the velocity grid" << std::endl;
+        sRefine = 1;
+    }
+
+    if (exactCoriolis) {
+        std::cout << "WARNING: Exact integration of the Coriolis term is available only for 3D runs. Adding it explicitly to the forcing instead" << std::endl;
+        exactCoriolis = false;
+    }
+#endif
+
     // CHECK IF LESS THAN 1 PROCESSOR IS ASKED FOR ALONG X-DIRECTION. IF SO, WARN AND SET IT TO DEFAULT VALUE OF 1
-    if (npX < 1) {
+    if (not autoNpX and npX < 1) {
         std::cout << "WARNING: Number of processors in X-direction is less than 1. Setting it to 1" << std::endl;
         npX = 1;
     }
 
     // CHECK IF LESS THAN 1 PROCESSOR IS ASKED FOR ALONG Y-DIRECTION. IF SO, WARN AND SET IT TO DEFAULT VALUE OF 1
-    if (npY < 1) {
+    if (not autoNpY and npY < 1) {
         std::cout << "WARNING: Number of processors in Y-direction is less than 1. Setting it to 1" << std::endl;
         npY = 1;
     }
@@ -295,6 +465,24 @@ void parser::checkData() {
         exit(0);
     }
 
+    // CHECK IF SYMMETRY PLANES STRING IS OF CORRECT LENGTH, AND IF THE PLANES LIE ONLY ALONG NON-PERIODIC DIRECTIONS
+    if ((symmetryType.length() != 6) or (symmetryType.find_first_not_of("WS") != std::string::npos)) {
+        std::cout << "ERROR: Symmetry planes string is not correct. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    for (int i = 0; i < 6; i++) {
+#ifdef PLANAR
+        if ((i == 2) or (i == 3)) continue;
+#endif
+        if ((symmetryType[i] == 'S') and (domainType[i/2] == 'P')) {
+            std::cout << "ERROR: Symmetry plane is specified on a wall along a periodic direction. Aborting" << std::endl;
+            MPI_Finalize();
+            exit(0);
+        }
+    }
+
     // CHECK IF MESH TYPE STRING IS OF CORRECT LENGTH
     if (meshType.length() != 3) {
         std::cout << "ERROR: Mesh type string is not correct. Aborting" << std::endl;
@@ -315,6 +503,24 @@ void parser::checkData() {
         exit(0);
     }
 
+    // CHECK IF THE NUMBER OF RANKS PER NODE IS VALID
+    if (nodeSize < 0) {
+        std::cout << "ERROR: The number of ranks per node cannot be negative. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    // CHOOSE THE DOMAIN DECOMPOSITION IF IT IS SET TO auto. THIS HAS TO BE DONE BEFORE THE V-CYCLE DEPTH IS CHECKED AGAINST THE SUB-DOMAIN SIZES
+    if (autoNpX or autoNpY) {
+        setPeriodicity();
+
+        planner decompPlan(*this, autoNpX, autoNpY);
+        decompPlan.printRanking();
+
+        npX = decompPlan.bestNpX();
+        npY = decompPlan.bestNpY();
+    }
+
     // CHECK IF MORE THAN 1 PROCESSOR IS ASKED FOR ALONG Y-DIRECTION FOR A 2D SIMULATION
     if (yInd == 0 and npY > 1) {
         std::cout << "WARNING: More than 1 processor is specified along Y-direction although the PLANAR flag is set. Setting npY to 1" << std::endl;
@@ -373,12 +579,151 @@ void parser::checkData() {
     }
 #endif
 
+    // CHECK IF THE ADVECTION SCHEME IS VALID, AND IF THE PADS SIZED FOR THE SEMI-LAGRANGIAN SCHEME FIT WITHIN THE NEIGHBOURING SUB-DOMAINS
+    if ((aScheme < 1) or (aScheme > 2)) {
+        std::cout << "ERROR: The specified advection scheme is not defined. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    if (aScheme == 2) {
+        if (courantNumber <= 0.0) {
+            std::cout << "ERROR: The Courant number must be positive to size the pads for semi-Lagrangian advection. Aborting" << std::endl;
+            MPI_Finalize();
+            exit(0);
+        }
+
+        int slPads = int(ceil(courantNumber)) + 2;
+        if ((int(pow(2, xInd))/npX < slPads) or ((yInd > 0) and (int(pow(2, yInd))/npY < slPads))) {
+            std::cout << "ERROR: The sub-domains are too small for the pads needed by semi-Lagrangian advection at the specified Courant number. Aborting" << std::endl;
+            MPI_Finalize();
+            exit(0);
+        }
+    }
+
+    if (sbSize < 0) {
+        std::cout << "ERROR: The size of sub-blocks used for multigrid smoothing cannot be negative. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    // CHECK IF THE SUB-BLOCKS TILE THE SUB-DOMAINS EXACTLY. SUB-BLOCKS ARE USED ONLY FOR 3D RUNS WITH JACOBI SMOOTHING AND WITHOUT BRICK LAYOUT
+#ifndef PLANAR
+    if (sbSize > 0 and (not gsSmooth) and (not brickLayout)) {
+        if ((int(pow(2, xInd))/npX) % sbSize or (int(pow(2, yInd))/npY) % sbSize or int(pow(2, zInd)) % sbSize) {
+            std::cout << "ERROR: The size of sub-blocks used for multigrid smoothing does not divide the sub-domain size along all directions. Aborting" << std::endl;
+            MPI_Finalize();
+            exit(0);
+        }
+    }
+#endif
+
+    if (tBlock < 1) {
+        std::cout << "ERROR: The number of Jacobi iterations per temporal block must be at least 1. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    if (gpRefresh < 1) {
+        std::cout << "ERROR: The interval for recomputing the pressure gradient must be at least 1 time-step. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    if (allocPad < 0) {
+        std::cout << "ERROR: The padding of array allocations cannot be negative. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    if (brickLayout and gsSmooth) {
+        std::cout << "WARNING: The brick layout is used only with Jacobi smoothing. Multigrid smoothing will use Gauss-Seidel iterations on the default layout" << std::endl;
+    }
+
+    if ((rsFormat < 1) or (rsFormat > 2)) {
+        std::cout << "ERROR: The specified format for restart files is not defined. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    // CHECK IF THE PARALLEL I/O TUNING PARAMETERS ARE VALID. SIZES IN MB ARE CONVERTED TO BYTES AS INTEGERS IN MPI-IO HINTS
+    if ((cbNodes < 0) or (cbBufSize < 0) or (stripeCount < 0) or (stripeSize < 0) or (metaBlockSize < 0)) {
+        std::cout << "ERROR: The parallel I/O tuning parameters cannot be negative. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    if ((cbBufSize >= 2048) or (stripeSize >= 2048)) {
+        std::cout << "ERROR: The collective buffer size and stripe size must be less than 2048 MB. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    // CHECK IF THE SLICE RENDERING PARAMETERS ARE VALID
+    if (renderSlices) {
+        if ((imgFormat < 1) or (imgFormat > 2)) {
+            std::cout << "ERROR: The specified format for rendered images is not defined. Aborting" << std::endl;
+            MPI_Finalize();
+            exit(0);
+        }
+
+#ifndef PLANAR
+        int planeSize[3] = {int(pow(2, xInd)), int(pow(2, yInd)), int(pow(2, zInd))};
+
+        if ((renderPlane < 0) or (renderPlane > 2)) {
+            std::cout << "ERROR: The normal direction of the rendered plane must be 0, 1 or 2. Aborting" << std::endl;
+            MPI_Finalize();
+            exit(0);
+        }
+
+        if ((renderIndex < 0) or (renderIndex >= planeSize[renderPlane])) {
+            std::cout << "ERROR: The index of the rendered plane lies outside the bounds of the domain. Aborting" << std::endl;
+            MPI_Finalize();
+            exit(0);
+        }
+#endif
+    }
+
+    // CHECK IF THE PARAMETERS FOR COMPUTING PDFS ARE VALID
+    if (recordPDFs) {
+        if (pdfBins < 2) {
+            std::cout << "ERROR: At least 2 bins are needed to compute PDFs. Aborting" << std::endl;
+            MPI_Finalize();
+            exit(0);
+        }
+
+        if ((bandHeight < 0.0) or (bandHeight >= 0.5*Lz)) {
+            std::cout << "ERROR: The height of the near-wall band for conditional PDFs must lie between 0 and half the domain height. Aborting" << std::endl;
+            MPI_Finalize();
+            exit(0);
+        }
+    }
+
     if (resType > 2) {
         std::cout << "ERROR: The specified value for printing error at end of V-Cycles is not defined. Aborting" << std::endl;
         MPI_Finalize();
         exit(0);
     }
 
+    if ((pSolver < 0) or (pSolver > 1)) {
+        std::cout << "ERROR: The specified Poisson solver is not defined. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    // CHECK IF THE DIRECT POISSON SOLVER IS USED WITH UNIFORM GRIDS ALONG ALL THE PERIODIC DIRECTIONS
+    if (pSolver == 1) {
+#ifdef PLANAR
+        if ((domainType[0] == 'P' and meshType[0] != 'U') or (domainType[2] == 'P' and meshType[2] != 'U')) {
+#else
+        if ((domainType[0] == 'P' and meshType[0] != 'U') or (domainType[1] == 'P' and meshType[1] != 'U') or (domainType[2] == 'P' and meshType[2] != 'U')) {
+#endif
+            std::cout << "ERROR: The direct Poisson solver can be used only with uniform grids along periodic directions. Aborting" << std::endl;
+            MPI_Finalize();
+            exit(0);
+        }
+    }
+
     if ((probType < 5) and (lesModel == 2)) {
         std::cout << "WARNING: The specified LES Model is incompatible with the problem type. Resetting LES Model to 1" << std::endl;
         lesModel = 1;
@@ -447,6 +792,46 @@ void parser::setPeriodicity() {
     if (domainType[2] == 'N') zPer = false;
 }
 
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to set the walls which are planes of symmetry based on symmetryType variable
+ *
+ *          The user specifies the type of each of the 6 walls as a single string, with S for a plane of symmetry and W for a wall.
+ *          This string has to be parsed to set the boolean values in symPlanes.
+ *          Mirror boundary conditions are imposed on all the fields at the planes of symmetry, in place of the wall BCs of the problem.
+ ********************************************************************************************************************************************
+ */
+void parser::setSymmetry() {
+    for (int i = 0; i < 6; i++) {
+        symPlanes(i) = (symmetryType[i] == 'S');
+    }
+
+#ifdef PLANAR
+    // FRONT AND BACK WALLS DO NOT EXIST IN 2D RUNS
+    symPlanes(2) = symPlanes(3) = false;
+#endif
+}
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to read the number of processors along a direction from its string in the YAML file
+ *
+ *          The number of processors can either be an integer, or the string auto, in which case it is chosen by the \ref planner class.
+ *
+ * \param   npString is the string read from the YAML file
+ * \param   autoFlag is a reference to the flag which is set to true if the number of processors is to be chosen automatically
+ *
+ * \return  The number of processors specified, or 0 if it is to be chosen automatically
+ ********************************************************************************************************************************************
+ */
+int parser::parseProcs(const std::string npString, bool &autoFlag) {
+    autoFlag = (npString == "auto");
+
+    if (autoFlag) return 0;
+
+    return atoi(npString.c_str());
+}
+
 /**
  ********************************************************************************************************************************************
  * \brief   Function to parse the probeCoords string
@@ -632,3 +1017,39 @@ void parser::writeParams() {
     std::cout << std::endl << "\t******************* END OF parameters.yaml *******************" << std::endl;
     std::cout << std::endl;
 }
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to read the level of thread support to be requested from the MPI library
+ *
+ *          MPI has to be initialized before the parser object is created, since the checks on the parameters need MPI.
+ *          Hence this static function reads only the progress thread flag from the parameters.yaml file.
+ *          Support for calls from multiple threads is requested only when the progress thread is enabled, since MPI libraries
+ *          may take slower, locked paths for all communication at the MPI_THREAD_MULTIPLE level.
+ *
+ * \return  MPI_THREAD_MULTIPLE if the progress thread is enabled, and MPI_THREAD_FUNNELED otherwise
+ ********************************************************************************************************************************************
+ */
+int parser::threadSupport() {
+    bool progFlag;
+    std::ifstream inFile;
+
+    inFile.open("input/parameters.yaml", std::ifstream::in);
+
+#ifdef YAML_LEGACY
+    YAML::Node yamlNode;
+    YAML::Parser parser(inFile);
+
+    parser.GetNextDocument(yamlNode);
+
+    yamlNode["Parallel"]["Progress Thread"] >> progFlag;
+#else
+    YAML::Node yamlNode = YAML::Load(inFile);
+
+    progFlag = yamlNode["Parallel"]["Progress Thread"].as<bool>();
+#endif
+
+    inFile.close();
+
+    return progFlag? MPI_THREAD_MULTIPLE: MPI_THREAD_FUNNELED;
+}
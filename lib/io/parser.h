@@ -60,33 +60,69 @@
 #define real float
 #endif
 
+// Scratch arrays holding intermediate results are stored as sreal. It is float only when MIXED_PRECISION is set for double precision runs.
+// All arithmetic on these arrays is still done in real, and only the stored values are rounded
+#if defined(REAL_DOUBLE) && defined(MIXED_PRECISION)
+#define sreal float
+#else
+#define sreal real
+#endif
+
 class parser {
     public:
         int ioCnt;
         int rbcType;
         int nThreads;
         int npY, npX;
+        int nodeSize;
         int forceType;
         int solnFormat;
+        int rsFormat;
         int xInd, yInd, zInd;
+        int sRefine;
+        int wmLayer;
         int resType, vcDepth, vcCount;
+        int pSolver;
+        int tBlock;
+        int gpRefresh;
+        int allocPad;
+        int sbSize;
+        int imgFormat;
+        int pdfBins;
+        int renderPlane, renderIndex;
+        int cbNodes, cbBufSize;
+        int stripeCount, stripeSize, metaBlockSize;
         int gsSmooth, preSmooth, postSmooth;
 
         int icType;
         int dScheme;
+        int aScheme;
         int iScheme;
         int lesModel;
         int probType;
+        int inflowBC, outflowBC;
         int xGrid, yGrid, zGrid;
 
         bool useCFL;
+        bool exactCoriolis;
+        bool wmFlag;
         bool nonHgBC;
         bool solveFlag;
         bool readProbes;
+        bool renderSlices;
+        bool recordPDFs;
         bool restartFlag;
         bool printResidual;
+        bool brickLayout;
+        bool floatPads;
+        bool progThread;
+        bool commProf;
+        bool earlyAlloc, collMetadata;
         bool xPer, yPer, zPer;
 
+        /** Flags for the left, right, front, back, bottom and top walls, which are true for walls that are planes of symmetry */
+        blitz::TinyVector<bool, 6> symPlanes;
+
         real Re;
         real Ra;
         real Pr;
@@ -96,15 +132,22 @@ class parser {
         real fwInt;
         real rsInt;
         real prInt;
+        real rdInt;
+        real pdInt;
+        real bandHeight;
         real meanPGrad;
         real Lx, Ly, Lz;
         real tStp, tMax;
         real patchRadius;
         real rfIntensity;
+        real recPlane;
         real meanVelocity;
         real courantNumber;
         real betaX, betaY, betaZ;
         real cnTolerance, mgTolerance;
+        real renderMin, renderMax;
+
+        std::string renderVar;
 
         std::vector<blitz::TinyVector<int, 3> > probesList;
 
@@ -112,11 +155,16 @@ class parser {
 
         void writeParams();
 
+        static int threadSupport();
+
     private:
         std::string meshType;
         std::string domainType;
+        std::string symmetryType;
         std::string probeCoords;
 
+        bool autoNpX, autoNpY;
+
         void parseYAML();
         void checkData();
 
@@ -125,6 +173,9 @@ class parser {
 
         void setGrids();
         void setPeriodicity();
+        void setSymmetry();
+
+        int parseProcs(const std::string npString, bool &autoFlag);
 };
 
 /**
@@ -0,0 +1,270 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file planner.cc
+ *
+ *  \brief Definitions for functions of class planner
+ *  \sa planner.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include "planner.h"
+
+// THE COSTS BELOW ARE ROUGH ESTIMATES IN UNITS OF THE TIME TAKEN TO UPDATE ONE GRID POINT, AND ONLY THEIR RATIOS AFFECT THE RANKING
+const real planner::pointCost = 4.0;
+const real planner::latencyCost = 2000.0;
+const real planner::nodeFactor = 4.0;
+
+// MAXIMUM NUMBER OF DECOMPOSITIONS PRINTED IN THE RANKING
+static const int maxPrint = 10;
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the planner class
+ *
+ *          The constructor enumerates all the pairs of divisions along X and Y whose product is the number of ranks.
+ *          Since all sub-domains must be of equal size, the number of divisions along each direction must divide the grid size.
+ *          Sub-domains must also have at least 2 points along each direction for the multigrid solver.
+ *          The constraints that \ref parser#checkData "checkData" applies to the sub-domain sizes are also applied here, so that
+ *          the chosen decomposition is never rejected later.
+ *          For semi-Lagrangian advection, the sub-domains must be at least as wide as the pads needed at the specified Courant number.
+ *          When sub-blocks are used for 3D Jacobi smoothing, their size must divide the sub-domain size along each direction.
+ *          If the number of divisions along one of the directions is specified by the user, only that value is considered for it.
+ *          The valid decompositions are scored and sorted in ascending order of their cost.
+ *
+ * \param   solParam is a const reference to the user-set parameters contained in the parser class
+ * \param   autoX is a boolean flag which is true if the number of divisions along X is to be chosen by the planner
+ * \param   autoY is a boolean flag which is true if the number of divisions along Y is to be chosen by the planner
+ ********************************************************************************************************************************************
+ */
+planner::planner(const parser &solParam, const bool autoX, const bool autoY): inputParams(solParam) {
+    int xSize, ySize, zSize;
+    int slPads, sbSize;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nProc);
+
+    xSize = 1 << inputParams.xInd;
+    ySize = 1 << inputParams.yInd;
+    zSize = 1 << inputParams.zInd;
+
+    // WIDTH OF PADS NEEDED BY SEMI-LAGRANGIAN ADVECTION, AND SIZE OF SUB-BLOCKS USED FOR JACOBI SMOOTHING (0 IF EITHER IS NOT USED)
+    slPads = (inputParams.aScheme == 2 and inputParams.courantNumber > 0.0)? int(std::ceil(inputParams.courantNumber)) + 2: 0;
+    sbSize = (inputParams.yInd > 0 and not inputParams.gsSmooth and not inputParams.brickLayout)? inputParams.sbSize: 0;
+
+    for (int xDiv = 1; xDiv <= nProc; ++xDiv) {
+        if (nProc % xDiv) continue;
+
+        int yDiv = nProc/xDiv;
+
+        if (not autoX and xDiv != inputParams.npX) continue;
+        if (not autoY and yDiv != inputParams.npY) continue;
+
+        // FOR 2D SIMULATIONS, THERE ARE NO DIVISIONS ALONG Y
+        if (inputParams.yInd == 0 and yDiv > 1) continue;
+
+        if (xSize % xDiv or xSize/xDiv < 2) continue;
+        if (inputParams.yInd > 0 and (ySize % yDiv or ySize/yDiv < 2)) continue;
+
+        // SUB-DOMAINS MUST HOLD THE PADS OF SEMI-LAGRANGIAN ADVECTION
+        if (xSize/xDiv < slPads) continue;
+        if (inputParams.yInd > 0 and ySize/yDiv < slPads) continue;
+
+        // SUB-BLOCKS MUST TILE THE SUB-DOMAINS EXACTLY
+        if (sbSize > 0 and ((xSize/xDiv) % sbSize or (ySize/yDiv) % sbSize or zSize % sbSize)) continue;
+
+        plans.push_back(evaluate(xDiv, yDiv));
+    }
+
+    if (plans.empty()) {
+        if (rank == 0) {
+            std::cout << "ERROR: No valid domain decomposition could be found for " << nProc << " ranks with the given grid size. Aborting" << std::endl;
+        }
+        MPI_Finalize();
+        exit(0);
+    }
+
+    std::sort(plans.begin(), plans.end(), [](const plan &a, const plan &b) { return a.totalCost < b.totalCost; });
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the weight of a halo exchange between two ranks
+ *
+ *          An exchange of a rank with itself, as happens along periodic directions with a single division, is a local copy and
+ *          is not counted.
+ *          Exchanges between ranks on different nodes are weighted by \ref nodeFactor when the number of ranks per node is set.
+ *          Ranks are assumed to be placed on nodes in blocks of consecutive ranks.
+ *
+ * \param   rankA is the rank of the first process
+ * \param   rankB is the rank of the second process
+ *
+ * \return  The weight of the exchange, which multiplies the cost of its message and halo points
+ ********************************************************************************************************************************************
+ */
+real planner::linkWeight(const int rankA, const int rankB) const {
+    if (rankA == rankB) return 0.0;
+
+    if (inputParams.nodeSize > 0 and rankA/inputParams.nodeSize != rankB/inputParams.nodeSize) return nodeFactor;
+
+    return 1.0;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to estimate the cost of one V-Cycle of the multigrid solver for a given decomposition
+ *
+ *          The V-Cycle depth is first limited by the sub-domain sizes, in the same way as in \ref parser#checkData "checkData".
+ *          At each level, the smoothing sweeps add the cost of updating the local points, and the cost of halo exchanges with
+ *          the neighbouring ranks.
+ *          Since all ranks wait for the slowest one at each exchange, the cost of halo exchange is the maximum over all ranks.
+ *          The number of iterations needed at the coarsest level grows as the square of its largest dimension.
+ *          Hence the coarsest level becomes expensive when the sub-domains are too small to reach the depth specified by the user.
+ *
+ * \param   xDiv is the number of divisions of the domain along X
+ * \param   yDiv is the number of divisions of the domain along Y
+ *
+ * \return  The plan structure holding the estimated costs of the decomposition
+ ********************************************************************************************************************************************
+ */
+planner::plan planner::evaluate(const int xDiv, const int yDiv) const {
+    plan p;
+    int locX, locY, locZ, maxSize;
+    real cX, cY, cZ, maxHalo;
+
+    const bool planar = (inputParams.yInd == 0);
+    const int nSweeps = std::max(inputParams.preSmooth + inputParams.postSmooth, 1);
+
+    p.npX = xDiv;
+    p.npY = yDiv;
+
+    locX = (1 << inputParams.xInd)/xDiv;
+    locY = (1 << inputParams.yInd)/yDiv;
+    locZ = 1 << inputParams.zInd;
+
+    p.mgDepth = inputParams.vcDepth;
+    while (p.mgDepth > 0 and locX < (2 << p.mgDepth)) p.mgDepth -= 1;
+    while (p.mgDepth > 0 and not planar and locY < (2 << p.mgDepth)) p.mgDepth -= 1;
+    while (p.mgDepth > 0 and locZ < (2 << p.mgDepth)) p.mgDepth -= 1;
+
+    // WEIGHTS OF THE EXCHANGES OF EACH RANK WITH ITS NEIGHBOURS ALONG X AND Y, AND THE TOTAL WEIGHT OF ITS MESSAGES
+    std::vector<real> wX(nProc, 0.0), wY(nProc, 0.0), wM(nProc, 0.0);
+    for (int r = 0; r < nProc; ++r) {
+        int xR = r % xDiv;
+        int yR = r / xDiv;
+
+        for (int s = -1; s <= 1; s += 2) {
+            if (inputParams.xPer or (xR + s >= 0 and xR + s < xDiv)) {
+                real w = linkWeight(r, yR*xDiv + (xR + s + xDiv) % xDiv);
+                wX[r] += w;
+                wM[r] += w;
+            }
+
+            if (not planar and (inputParams.yPer or (yR + s >= 0 and yR + s < yDiv))) {
+                real w = linkWeight(r, ((yR + s + yDiv) % yDiv)*xDiv + xR);
+                wY[r] += w;
+                wM[r] += w;
+            }
+        }
+    }
+
+    p.compCost = 0.0;
+    p.haloCost = 0.0;
+    maxHalo = 0.0;
+    cX = cY = cZ = 1.0;
+    for (int l = 0; l <= p.mgDepth; ++l) {
+        cX = locX >> l;
+        cY = planar? 1: locY >> l;
+        cZ = locZ >> l;
+
+        maxHalo = 0.0;
+        for (int r = 0; r < nProc; ++r) {
+            maxHalo = std::max(maxHalo, pointCost*(wX[r]*cY*cZ + wY[r]*cX*cZ) + latencyCost*wM[r]);
+        }
+
+        p.compCost += nSweeps*cX*cY*cZ;
+        p.haloCost += nSweeps*maxHalo;
+    }
+
+    // WHEN THE COARSEST LEVEL IS ONLY SMOOTHED INSTEAD OF BEING SOLVED, THE NUMBER OF V-CYCLES GROWS IN A SIMILAR MANNER
+    maxSize = std::max(std::max(locX*xDiv, planar? 1: locY*yDiv), locZ) >> p.mgDepth;
+    p.coarseCost = real(maxSize)*maxSize*(cX*cY*cZ + maxHalo);
+
+    p.totalCost = p.compCost + p.haloCost + p.coarseCost;
+
+    return p;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to print the ranking of the decompositions along with their estimated costs
+ *
+ *          Only the rank 0 process prints the ranking.
+ *          The costs are in units of the time taken to update one grid point, and are meant only for comparing the decompositions.
+ ********************************************************************************************************************************************
+ */
+void planner::printRanking() const {
+    if (rank == 0) {
+        std::cout << std::endl << "Ranking of domain decompositions for " << nProc << " ranks by estimated cost per V-Cycle" << std::endl << std::endl;
+        std::cout << std::setw(6) << "npX" << std::setw(6) << "npY" << std::setw(20) << "Sub-domain" << std::setw(8) << "Depth"
+                  << std::setw(14) << "Compute" << std::setw(14) << "Halo" << std::setw(14) << "Coarse" << std::setw(14) << "Total" << std::endl;
+
+        for (unsigned int i = 0; i < std::min(plans.size(), size_t(maxPrint)); ++i) {
+            std::ostringstream subSize;
+
+            subSize << (1 << inputParams.xInd)/plans[i].npX << "x" << (1 << inputParams.yInd)/plans[i].npY << "x" << (1 << inputParams.zInd);
+
+            std::cout << std::setw(6) << plans[i].npX << std::setw(6) << plans[i].npY << std::setw(20) << subSize.str() << std::setw(8) << plans[i].mgDepth
+                      << std::scientific << std::setprecision(3)
+                      << std::setw(14) << plans[i].compCost << std::setw(14) << plans[i].haloCost
+                      << std::setw(14) << plans[i].coarseCost << std::setw(14) << plans[i].totalCost << std::endl;
+        }
+
+        std::cout << std::endl << "Using " << bestNpX() << " divisions along X and " << bestNpY() << " divisions along Y" << std::endl;
+
+        if (plans.front().mgDepth < inputParams.vcDepth) {
+            std::cout << "WARNING: The chosen decomposition cannot reach the V-Cycle depth specified" << std::endl;
+        }
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,104 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file planner.h
+ *
+ *  \brief Class declaration of planner
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef PLANNER_H
+#define PLANNER_H
+
+#include <vector>
+#include <iostream>
+
+#include "parser.h"
+#include "mpi.h"
+
+class planner {
+    public:
+        planner(const parser &solParam, const bool autoX, const bool autoY);
+
+        inline int bestNpX() const { return plans.front().npX; };
+        inline int bestNpY() const { return plans.front().npY; };
+
+        void printRanking() const;
+
+    private:
+        /** Cost model estimates of a single decomposition, all in units of the time taken to update one grid point */
+        struct plan {
+            int npX, npY;
+            int mgDepth;
+            real compCost, haloCost, coarseCost, totalCost;
+        };
+
+        const parser &inputParams;
+
+        /** Rank of the process and total number of processes in MPI_COMM_WORLD */
+        int rank, nProc;
+
+        /** List of valid decompositions, sorted in ascending order of their total cost */
+        std::vector<plan> plans;
+
+        /** Cost of transferring one halo point between ranks on the same node */
+        static const real pointCost;
+
+        /** Cost of the latency of one message sent to a neighbouring rank */
+        static const real latencyCost;
+
+        /** Factor by which the cost of a message and its halo points is multiplied when it is sent to a rank on another node */
+        static const real nodeFactor;
+
+        plan evaluate(const int xDiv, const int yDiv) const;
+
+        real linkWeight(const int rankA, const int rankB) const;
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class planner planner.h "lib/io/planner.h"
+ *  \brief Class to choose the domain decomposition when the number of processors along X or Y is set to auto
+ *
+ *  All the decompositions of the available ranks into equal sub-domains are enumerated, and each is scored with a simple model of
+ *  one V-Cycle of the multigrid solver.
+ *  The model adds the cost of computation, the cost of halo exchanges at each level, and the cost of the coarsest level,
+ *  which grows quickly when the sub-domains are too small to reach the V-Cycle depth specified by the user.
+ *  The decomposition with the least cost is used, and the ranking of all decompositions is printed for reference.
+ ********************************************************************************************************************************************
+ */
+
+#endif
@@ -0,0 +1,387 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file rawrestart.cc
+ *
+ *  \brief Definitions for functions of class rawrestart
+ *  \sa rawrestart.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include "rawrestart.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the rawrestart class
+ *
+ *          The constructor sets the name of the restart file of the rank.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   rsFields is a vector of fields to be written or read
+ * \param   rsSuffix is a string appended to the name of the restart folder, to keep apart the restart data of fields on different grids
+ ********************************************************************************************************************************************
+ */
+rawrestart::rawrestart(const grid &mesh, std::vector<field> &rsFields, std::string rsSuffix): mesh(mesh), rsFields(rsFields) {
+    std::ostringstream constFile;
+
+    // Flag to enable printing to I/O only by 0 rank
+    pf = false;
+    if (mesh.rankData.rank == 0) pf = true;
+
+    rsFolder = "output/restart" + rsSuffix;
+
+    constFile << rsFolder << "/rank_" << std::setfill('0') << std::setw(6) << mesh.rankData.rank << ".bin";
+    rankFile = constFile.str();
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to write the restart data of all ranks
+ *
+ *          Each rank writes its header followed by the name and padded array of each field into its own file.
+ *          The checksums of the data from all ranks are gathered at the root rank, which then writes the manifest.
+ *          The manifest is first written to a temporary file and then renamed, so that an existing manifest is replaced
+ *          only after all the rank files have been written completely.
+ *
+ * \param   time is a real value containing the time to be written to the restart files
+ ********************************************************************************************************************************************
+ */
+void rawrestart::writeData(real time) {
+    struct stat info;
+    rawHeader fHeader;
+    char fieldName[nameLength];
+    unsigned long long localSum;
+
+    std::ofstream ofFile;
+
+    // Create the restart folder if it does not exist
+    if (pf) {
+        if (stat(rsFolder.c_str(), &info) != 0) {
+            if (mkdir(rsFolder.c_str(), S_IRWXU | S_IRWXG)) {
+                std::cout << "Error in while attempting to create directory for writing restart files. Aborting" << std::endl;
+                exit(0);
+            }
+        }
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    fillHeader(fHeader, time);
+
+    ofFile.open(rankFile.c_str(), std::fstream::out | std::fstream::binary | std::fstream::trunc);
+    if (not ofFile.is_open()) {
+        std::cout << "Error in opening restart file " << rankFile << " for writing. Aborting" << std::endl;
+        MPI_Finalize();
+        exit(0);
+    }
+
+    ofFile.write((const char*) &fHeader, sizeof(rawHeader));
+
+    localSum = 14695981039346656037ULL;
+    for (unsigned int i=0; i < rsFields.size(); i++) {
+        size_t numBytes = rsFields[i].F.numElements()*sizeof(real);
+        const char *fieldData = (const char*) rsFields[i].F.dataFirst();
+
+        // ARRAYS WITH EXTRA POINTS IN THEIR STORAGE ARE COPIED TO A CONTIGUOUS ARRAY, SO THAT THE FILES DO NOT DEPEND ON THE PADDING
+        blitz::Array<real, 3> fieldCopy;
+        if (not rsFields[i].F.isStorageContiguous()) {
+            fieldCopy.resize(rsFields[i].F.shape());
+            fieldCopy.reindexSelf(rsFields[i].F.lbound());
+            fieldCopy = rsFields[i].F;
+
+            fieldData = (const char*) fieldCopy.dataFirst();
+        }
+
+        memset(fieldName, 0, nameLength);
+        strncpy(fieldName, rsFields[i].fieldName.c_str(), nameLength - 1);
+
+        ofFile.write(fieldName, nameLength);
+        ofFile.write(fieldData, numBytes);
+
+        localSum = checkSum(fieldData, numBytes, localSum);
+    }
+
+    ofFile.close();
+
+    // Gather the checksums from all ranks to write the manifest
+    std::vector<unsigned long long> allSums(mesh.rankData.nProc);
+    MPI_Gather(&localSum, 1, MPI_UNSIGNED_LONG_LONG, &allSums[0], 1, MPI_UNSIGNED_LONG_LONG, 0, MPI_COMM_WORLD);
+
+    if (pf) {
+        ofFile.open((rsFolder + "/manifest.tmp").c_str(), std::fstream::out | std::fstream::trunc);
+
+        ofFile << "Time " << std::scientific << std::setprecision(17) << time << std::endl;
+        ofFile << "Ranks " << mesh.rankData.nProc << std::endl;
+        ofFile << "Decomposition " << mesh.rankData.npX << " " << mesh.rankData.npY << std::endl;
+        ofFile << "GlobalSize " << mesh.globalSize(0) << " " << mesh.globalSize(1) << " " << mesh.globalSize(2) << std::endl;
+        ofFile << "RealBytes " << sizeof(real) << std::endl;
+
+        ofFile << "Fields " << rsFields.size();
+        for (unsigned int i=0; i < rsFields.size(); i++) ofFile << " " << rsFields[i].fieldName;
+        ofFile << std::endl;
+
+        ofFile << "Checksums" << std::endl;
+        for (int r=0; r < mesh.rankData.nProc; r++) ofFile << r << " " << allSums[r] << std::endl;
+
+        ofFile.close();
+
+        std::rename((rsFolder + "/manifest.tmp").c_str(), (rsFolder + "/manifest.txt").c_str());
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to read the restart data of all ranks
+ *
+ *          The root rank parses the manifest and checks it against the present decomposition, grid size and fields.
+ *          If these are consistent, each rank maps its restart file into memory, verifies the header and checksum,
+ *          and copies the data into its fields.
+ *          The result of all the checks is reduced over all ranks, so that either all ranks use the data, or none do.
+ *          Even when the data cannot be used, the time in the manifest is returned, so that the caller can check
+ *          whether any other restart file it falls back to was written at the same time.
+ *
+ * \param   time is a reference to the real value into which the time of the restart data is read.
+ *          It is set to -1 when the manifest could not be read.
+ *
+ * \return  true if the restart data was read successfully by all ranks, false otherwise
+ ********************************************************************************************************************************************
+ */
+bool rawrestart::readData(real &time) {
+    int fDesc;
+    int localValid, globalValid;
+    size_t fileSize, offset;
+    struct stat info;
+    char *fileMap;
+    rawHeader fHeader, fileHeader;
+    unsigned long long localSum, fileSum;
+
+    std::vector<unsigned long long> allSums;
+
+    double mTime = -1.0;
+
+    // THE ROOT RANK PARSES THE MANIFEST AND CHECKS IT AGAINST THE PRESENT RUN
+    localValid = 1;
+    if (pf) {
+        int mProcs, mNpX, mNpY, mBytes, mFields;
+        blitz::TinyVector<int, 3> mSize;
+        std::string label, fName;
+
+        std::ifstream inFile;
+        inFile.open((rsFolder + "/manifest.txt").c_str(), std::ifstream::in);
+
+        if (inFile.is_open()) {
+            inFile >> label >> mTime;
+            if (inFile.fail()) mTime = -1.0;
+            inFile >> label >> mProcs;
+            inFile >> label >> mNpX >> mNpY;
+            inFile >> label >> mSize(0) >> mSize(1) >> mSize(2);
+            inFile >> label >> mBytes;
+
+            if ((mProcs != mesh.rankData.nProc) or (mNpX != mesh.rankData.npX) or (mNpY != mesh.rankData.npY)) localValid = 0;
+            for (int d=0; d<3; d++) if (mSize(d) != mesh.globalSize(d)) localValid = 0;
+            if (mBytes != int(sizeof(real))) localValid = 0;
+
+            inFile >> label >> mFields;
+            if (mFields != int(rsFields.size())) localValid = 0;
+
+            for (int i=0; i < mFields and localValid; i++) {
+                inFile >> fName;
+                if (fName != rsFields[i].fieldName) localValid = 0;
+            }
+
+            if (localValid) {
+                allSums.resize(mProcs);
+
+                inFile >> label;
+                for (int r=0; r < mProcs; r++) inFile >> label >> allSums[r];
+
+                if (inFile.fail()) localValid = 0;
+            }
+
+            inFile.close();
+
+            if (not localValid) std::cout << "Decomposition or grid in restart manifest does not match the parameters" << std::endl;
+        } else {
+            localValid = 0;
+
+            std::cout << "Could not open the restart manifest" << std::endl;
+        }
+    }
+
+    MPI_Bcast(&mTime, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    time = mTime;
+
+    MPI_Bcast(&localValid, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    if (not localValid) return false;
+
+    if (not pf) allSums.resize(mesh.rankData.nProc);
+    MPI_Scatter(&allSums[0], 1, MPI_UNSIGNED_LONG_LONG, &fileSum, 1, MPI_UNSIGNED_LONG_LONG, 0, MPI_COMM_WORLD);
+
+    // EACH RANK MAPS ITS OWN FILE AND VERIFIES IT BEFORE COPYING
+    fileMap = NULL;
+    fileSize = 0;
+
+    fDesc = open(rankFile.c_str(), O_RDONLY);
+    if (fDesc < 0) {
+        localValid = 0;
+    } else {
+        fstat(fDesc, &info);
+        fileSize = info.st_size;
+
+        if (fileSize >= sizeof(rawHeader)) {
+            fileMap = (char*) mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, fDesc, 0);
+            if (fileMap == MAP_FAILED) fileMap = NULL;
+        }
+
+        if (fileMap == NULL) localValid = 0;
+    }
+
+    if (localValid) {
+        fillHeader(fHeader, 0.0);
+        memcpy(&fileHeader, fileMap, sizeof(rawHeader));
+
+        if (strncmp(fileHeader.magic, fHeader.magic, 8) or (fileHeader.version != fHeader.version) or
+            (fileHeader.rank != fHeader.rank) or (fileHeader.nFields != fHeader.nFields) or (fileHeader.realBytes != fHeader.realBytes)) localValid = 0;
+
+        for (int d=0; d<3; d++) {
+            if ((fileHeader.fullSize[d] != fHeader.fullSize[d]) or (fileHeader.subStarts[d] != fHeader.subStarts[d])) localValid = 0;
+        }
+    }
+
+    // VERIFY THE SIZE AND CHECKSUM OF THE FILE BEFORE TOUCHING THE FIELDS
+    if (localValid) {
+        offset = sizeof(rawHeader);
+        localSum = 14695981039346656037ULL;
+        for (unsigned int i=0; i < rsFields.size(); i++) {
+            size_t numBytes = rsFields[i].F.numElements()*sizeof(real);
+
+            if (offset + nameLength + numBytes > fileSize) {
+                localValid = 0;
+                break;
+            }
+
+            offset += nameLength;
+            localSum = checkSum(fileMap + offset, numBytes, localSum);
+            offset += numBytes;
+        }
+
+        if (localSum != fileSum) localValid = 0;
+    }
+
+    MPI_Allreduce(&localValid, &globalValid, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+    if (globalValid) {
+        offset = sizeof(rawHeader);
+        for (unsigned int i=0; i < rsFields.size(); i++) {
+            size_t numBytes = rsFields[i].F.numElements()*sizeof(real);
+
+            offset += nameLength;
+            if (rsFields[i].F.isStorageContiguous()) {
+                memcpy(rsFields[i].F.dataFirst(), fileMap + offset, numBytes);
+            } else {
+                blitz::Array<real, 3> fieldCopy(rsFields[i].F.lbound(), rsFields[i].F.shape());
+                memcpy(fieldCopy.dataFirst(), fileMap + offset, numBytes);
+                rsFields[i].F = fieldCopy;
+            }
+            offset += numBytes;
+        }
+
+        time = fileHeader.time;
+    } else {
+        if (pf) std::cout << "Restart files of one or more ranks are missing or corrupted" << std::endl;
+    }
+
+    if (fileMap != NULL) munmap(fileMap, fileSize);
+    if (fDesc >= 0) close(fDesc);
+
+    return globalValid;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to fill the header of the restart file of the rank
+ *
+ * \param   fHeader is a reference to the header to be filled
+ * \param   time is a real value containing the time to be written into the header
+ ********************************************************************************************************************************************
+ */
+void rawrestart::fillHeader(rawHeader &fHeader, real time) const {
+    memset(&fHeader, 0, sizeof(rawHeader));
+
+    strncpy(fHeader.magic, "SARASRS", 8);
+    fHeader.version = 1;
+    fHeader.rank = mesh.rankData.rank;
+    fHeader.nFields = rsFields.size();
+    fHeader.realBytes = sizeof(real);
+    fHeader.time = time;
+
+    for (int d=0; d<3; d++) {
+        fHeader.fullSize[d] = rsFields.size()? rsFields[0].F.extent(d): 0;
+        fHeader.subStarts[d] = mesh.subarrayStarts(d);
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to update a 64-bit FNV-1a checksum with a block of data
+ *
+ *          The data is processed in 8-byte words for speed, with the trailing bytes processed individually.
+ *
+ * \param   data is a pointer to the block of data
+ * \param   numBytes is the size of the block in bytes
+ * \param   hash is the checksum computed so far, which is updated with the block
+ *
+ * \return  The updated checksum
+ ********************************************************************************************************************************************
+ */
+unsigned long long rawrestart::checkSum(const char *data, size_t numBytes, unsigned long long hash) const {
+    const unsigned long long fnvPrime = 1099511628211ULL;
+    unsigned long long word;
+    size_t i;
+
+    for (i=0; i + 8 <= numBytes; i += 8) {
+        memcpy(&word, data + i, 8);
+        hash = (hash ^ word)*fnvPrime;
+    }
+
+    for (; i < numBytes; i++) {
+        hash = (hash ^ (unsigned char) data[i])*fnvPrime;
+    }
+
+    return hash;
+}
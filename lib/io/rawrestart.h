@@ -0,0 +1,117 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file rawrestart.h
+ *
+ *  \brief Class declaration of rawrestart
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef RAWRESTART_H
+#define RAWRESTART_H
+
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+
+#include "field.h"
+#include "grid.h"
+
+class rawrestart {
+    public:
+        rawrestart(const grid &mesh, std::vector<field> &rsFields, std::string rsSuffix = "");
+
+        void writeData(real time);
+        bool readData(real &time);
+
+        ~rawrestart() { };
+
+    private:
+        const grid &mesh;
+
+        // Print flag - basically flag to ease printing to I/O. It is true for root rank (0)
+        bool pf;
+
+        std::vector<field> &rsFields;
+
+        /** Header written at the start of the restart file of each rank */
+        struct rawHeader {
+            char magic[8];
+            int version;
+            int rank;
+            int nFields;
+            int realBytes;
+            int fullSize[3];
+            int subStarts[3];
+            double time;
+        };
+
+        /** Fixed length of the field names written before the data of each field */
+        static const int nameLength = 16;
+
+        /** Folder holding the restart files of all ranks and the manifest, output/restart followed by the suffix given to the constructor */
+        std::string rsFolder;
+
+        std::string rankFile;
+
+        void fillHeader(rawHeader &fHeader, real time) const;
+
+        unsigned long long checkSum(const char *data, size_t numBytes, unsigned long long hash) const;
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class rawrestart rawrestart.h "lib/io/rawrestart.h"
+ *  \brief Class to write and read restart data as one raw binary file per rank
+ *
+ *  Each rank writes the padded arrays of its fields into its own file inside output/restart/, preceded by a small header.
+ *  Fields on a different grid are written into a separate folder, whose name is output/restart followed by a suffix.
+ *  The root rank additionally writes a manifest containing the time, domain decomposition, grid size, and a checksum
+ *  of the data written by each rank.
+ *  On restart, each rank maps its file into memory and copies the data into its fields.
+ *  This is possible only when the decomposition has not changed, and the reader class falls back to the HDF5 restart file otherwise,
+ *  provided that this file was written at the same time as the data of the ranks.
+ ********************************************************************************************************************************************
+ */
+
+#endif
@@ -50,13 +50,16 @@
  *
  * \param   mesh is a const reference to the global data contained in the grid class
  * \param   wField is a vector of fields to be read into
+ * \param   rsSuffix is a string appended to the names of the restart files, to keep apart the restart data of fields on different grids
  ********************************************************************************************************************************************
  */
-reader::reader(const grid &mesh, std::vector<field> &rFields): mesh(mesh), rFields(rFields) {
+reader::reader(const grid &mesh, std::vector<field> &rFields, std::string rsSuffix): mesh(mesh), rFields(rFields), ioTuning(mesh.inputParams), rawReader(mesh, rFields, rsSuffix) {
     // Flag to enable printing to I/O only by 0 rank
     pf = false;
     if (mesh.rankData.rank == 0) pf = true;
 
+    rsFile = "output/restartFile" + rsSuffix + ".h5";
+
     /** Initialize the common global and local limits for file writing */
     initLimits();
 }
@@ -82,6 +85,9 @@ void reader::initLimits() {
     hsize_t offset[3];          /* offset of hyperslab */
 #endif
 
+    hsize_t dimsm[3];           /* memory dataspace dimensions */
+    hsize_t offsetm[3];         /* offset of hyperslab in memory */
+
     locSize = mesh.coreSize;
     gloSize = mesh.globalSize;
     sdStart = mesh.subarrayStarts;
@@ -91,35 +97,25 @@ void reader::initLimits() {
     locSize(1) = 1;
 #endif
 
-    // Create a dataspace representing the full limits of the array - this is the target dataspace
-#ifdef PLANAR
-    dimsf[0] = locSize(0);
-    dimsf[1] = locSize(2);
-    targetDSpace = H5Screate_simple(2, dimsf, NULL);
-#else
-    dimsf[0] = locSize(0);
-    dimsf[1] = locSize(1);
-    dimsf[2] = locSize(2);
-    targetDSpace = H5Screate_simple(3, dimsf, NULL);
-#endif
-
-    // Modify the view of the *target* dataspace by using a hyperslab - *this view will be used to read from memory*
-#ifdef PLANAR
-    dimsf[0] = locSize(0);
-    dimsf[1] = locSize(2);
-    offset[0] = 0;
-    offset[1] = 0;
-#else
-    dimsf[0] = locSize(0);
-    dimsf[1] = locSize(1);
-    dimsf[2] = locSize(2);
-    offset[0] = 0;
-    offset[1] = 0;
-    offset[2] = 0;
-#endif
-    status = H5Sselect_hyperslab(targetDSpace, H5S_SELECT_SET, offset, NULL, dimsf, NULL);
+    // Create a dataspace representing the full limits of the local array including the pads - this is the target dataspace
+    // The dataspace is always 3D since it describes the padded blitz array of the field in memory
+    // Its size is that of the storage of the array, which may have extra points beyond the pads along the inner dimensions
+    dimsm[0] = mesh.fullSize(0) + mesh.allocPads(0);
+    dimsm[1] = mesh.fullSize(1) + mesh.allocPads(1);
+    dimsm[2] = mesh.fullSize(2) + mesh.allocPads(2);
+    targetDSpace = H5Screate_simple(3, dimsm, NULL);
+
+    // Modify the view of the *target* dataspace by using a hyperslab that selects only the core - *this view will be used to write into memory*
+    // This allows the data to be read directly into the field without copying from a separate buffer
+    dimsm[0] = locSize(0);
+    dimsm[1] = locSize(1);
+    dimsm[2] = locSize(2);
+    offsetm[0] = mesh.padWidths(0);
+    offsetm[1] = mesh.padWidths(1);
+    offsetm[2] = mesh.padWidths(2);
+    status = H5Sselect_hyperslab(targetDSpace, H5S_SELECT_SET, offsetm, NULL, dimsm, NULL);
     if (status) {
-        if (pf) std::cout << "Error in creating hyperslab while writing data. Aborting" << std::endl;
+        if (pf) std::cout << "Error in creating hyperslab while reading data. Aborting" << std::endl;
         MPI_Finalize();
         exit(0);
     }
@@ -163,6 +159,10 @@ void reader::initLimits() {
  * \brief   Function to read files in HDF5 format in parallel
  *
  *          It opens a file in the output folder and all the processors read in parallel from the file
+ *          If the file-per-rank restart format is chosen by the user, the data is first read through \ref rawrestart,
+ *          and the HDF5 file is read only if this fails.
+ *          Since the HDF5 restart file is not updated in this format, it is used only when its time matches the time of
+ *          the file-per-rank data, and the solver aborts otherwise instead of silently restarting from older data.
  *
  ********************************************************************************************************************************************
  */
@@ -173,20 +173,27 @@ real reader::readData() {
 
     herr_t status;
 
-    real time;
+    real time, rawTime;
+
+    // Read from the files of each rank if the corresponding format is chosen. Fall back to HDF5 if it fails
+    rawTime = -1.0;
+    if (mesh.inputParams.rsFormat == 2) {
+        if (rawReader.readData(rawTime)) return rawTime;
+
+        if (pf) std::cout << "WARNING: Could not restart from the file-per-rank restart data. Reading " << rsFile << " instead" << std::endl;
+    }
 
     // Create a property list for collectively opening a file by all processors
-    plist_id = H5Pcreate(H5P_FILE_ACCESS);
-    H5Pset_fapl_mpio(plist_id, MPI_COMM_WORLD, MPI_INFO_NULL);
+    plist_id = ioTuning.fileAccess();
 
     // First create a file handle with the path to the input file
     H5E_BEGIN_TRY {
-        fileHandle = H5Fopen("output/restartFile.h5", H5F_ACC_RDONLY, plist_id);
+        fileHandle = H5Fopen(rsFile.c_str(), H5F_ACC_RDONLY, plist_id);
     } H5E_END_TRY;
 
     // Abort if file doesn't exist
     if (fileHandle < 0) {
-        if (pf) std::cout << "ERROR: Restart flag is true, but could not open restart file. Aborting" << std::endl;
+        if (pf) std::cout << "ERROR: Restart flag is true, but could not open restart file " << rsFile << ". Aborting" << std::endl;
         MPI_Finalize();
         exit(0);
     }
@@ -206,38 +213,36 @@ real reader::readData() {
     H5Dclose(dataSet);
     H5Sclose(timeDSpace);
 
+    // The HDF5 file must hold the same data as the file-per-rank restart data that could not be read
+    if (rawTime >= 0.0 and std::abs(time - rawTime) > 1.0e-6*std::max(real(1.0), std::abs(rawTime))) {
+        if (pf) std::cout << "ERROR: " << rsFile << " at time " << time << " does not match the file-per-rank restart data at time " << rawTime << ". Aborting" << std::endl;
+        H5Fclose(fileHandle);
+        MPI_Finalize();
+        exit(0);
+    }
+
     // Create a property list to use collective data read
-    plist_id = H5Pcreate(H5P_DATASET_XFER);
-    H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+    plist_id = ioTuning.dataTransfer();
 
     for (unsigned int i=0; i < rFields.size(); i++) {
-#ifdef PLANAR
-        fieldData.resize(blitz::TinyVector<int, 2>(locSize(0), locSize(2)));
-#else
-        fieldData.resize(locSize);
-#endif
-
         // Create the dataset *for the array in memory*, linking it to the file handle.
         // Correspondingly, it will use the *core* dataspace, as only the core has to be written excluding the pads
         dataSet = H5Dopen2(fileHandle, rFields[i].fieldName.c_str(), H5P_DEFAULT);
 
         // Write the dataset. Most important thing to note is that the 3rd and 4th arguments represent the *source* and *destination* dataspaces.
         // The source here is the sourceDSpace pointing to the file. Note that its view has been adjusted using hyperslab.
-        // The destination is the targetDSpace. Though the targetDSpace is smaller than the sourceDSpace,
-        // only the appropriate hyperslab within the sourceDSpace is transferred to the destination.
+        // The destination is the targetDSpace, which points to the padded array of the field with its view adjusted to the core.
+        // Only the appropriate hyperslab within the sourceDSpace is transferred to the destination.
 
         // Note that the targetDSpace and sourceDSpace have switched positions
         // This is another point where the reader differs from the writer
-        status = H5Dread(dataSet, H5T_NATIVE_REAL, targetDSpace, sourceDSpace, plist_id, fieldData.dataFirst());
+        status = H5Dread(dataSet, H5T_NATIVE_REAL, targetDSpace, sourceDSpace, plist_id, rFields[i].F.dataFirst());
         if (status) {
             if (pf) std::cout << "Error in reading input from HDF file. Aborting" << std::endl;
             MPI_Finalize();
             exit(0);
         }
 
-        //Read data
-        copyData(rFields[i]);
-
         H5Dclose(dataSet);
     }
 
@@ -248,29 +253,6 @@ real reader::readData() {
     return time;
 }
 
-/**
- ********************************************************************************************************************************************
- * \brief   Function to copy data from blitz array without pads into solver variables
- *
- *          In order to simplify the file views while reading from disk to memory,
- *          the variables are copied into a local blitz array without the pads.
- *          These variables are then written into the solver variables supplied to the reader class.
- *
- ********************************************************************************************************************************************
- */
-void reader::copyData(field &outField) {
-#ifdef PLANAR
-    for (int i=0; i < fieldData.shape()[0]; i++)
-        for (int k=0; k < fieldData.shape()[1]; k++)
-            outField.F(i, 0, k) = fieldData(i, k);
-#else
-    for (int i=0; i < fieldData.shape()[0]; i++)
-        for (int j=0; j < fieldData.shape()[1]; j++)
-            for (int k=0; k < fieldData.shape()[2]; k++)
-                outField.F(i, j, k) = fieldData(i, j, k);
-#endif
-}
-
 /**
  ********************************************************************************************************************************************
  * \brief   Function to check compatibility of restart file with input parameters
@@ -281,8 +263,8 @@ void reader::copyData(field &outField) {
  ********************************************************************************************************************************************
  */
 void reader::restartCheck(hid_t fHandle) {
-    // Use the pressure data to get size of dataset
-    hid_t pData = H5Dopen2(fHandle, "P", H5P_DEFAULT);
+    // Use the data of the first field to be read to get size of dataset, since the restart files of refined grids hold only their own fields
+    hid_t pData = H5Dopen2(fHandle, rFields[0].fieldName.c_str(), H5P_DEFAULT);
     hid_t pSpace = H5Dget_space(pData);
     const int ndims = H5Sget_simple_extent_ndims(pSpace);
 #ifdef PLANAR
@@ -52,10 +52,12 @@
 #include "field.h"
 #include "grid.h"
 #include "hdf5.h"
+#include "iotune.h"
+#include "rawrestart.h"
 
 class reader {
     public:
-        reader(const grid &mesh, std::vector<field> &rFields);
+        reader(const grid &mesh, std::vector<field> &rFields, std::string rsSuffix = "");
 
         real readData();
 
@@ -69,11 +71,14 @@ class reader {
 
         std::vector<field> &rFields;
 
-#ifdef PLANAR
-        blitz::Array<real, 2> fieldData;
-#else
-        blitz::Array<real, 3> fieldData;
-#endif
+        /** Instance of the \ref iotune class that provides the property lists for parallel file I/O */
+        iotune ioTuning;
+
+        /** Instance of the \ref rawrestart class used to read restart files when the file-per-rank format is chosen */
+        rawrestart rawReader;
+
+        /** Name of the HDF5 restart file, output/restartFile followed by the suffix given to the constructor */
+        std::string rsFile;
 
         hid_t sourceDSpace, targetDSpace;
 
@@ -82,8 +87,6 @@ class reader {
         void restartCheck(hid_t fHandle);
 
         void initLimits();
-
-        void copyData(field &outField);
 };
 
 /**
@@ -0,0 +1,486 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file render.cc
+ *
+ *  \brief Definitions for functions of class render
+ *  \sa render.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include "render.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the render class
+ *
+ *          The constructor locates the plane to be rendered and the field to be rendered on it.
+ *          Since the domain decomposition does not change during the run, the position and size of the part of the slice
+ *          held by each rank is gathered only once here, and used by the root rank to assemble the slice at every render.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   rFields is a vector of fields from which the rendered variable is chosen
+ ********************************************************************************************************************************************
+ */
+render::render(const grid &mesh, std::vector<field> &rFields): mesh(mesh), rFields(rFields) {
+    int gloIndex;
+    int tileInfo[4];
+
+    // Flag to enable printing to I/O only by 0 rank
+    pf = false;
+    if (mesh.rankData.rank == 0) pf = true;
+
+#ifdef PLANAR
+    nDim = 1;
+    gloIndex = 0;
+#else
+    nDim = mesh.inputParams.renderPlane;
+    gloIndex = mesh.inputParams.renderIndex;
+#endif
+
+    // THE PLANE IS SPANNED BY THE REMAINING TWO DIRECTIONS, WITH THE HIGHER ONE ALONG THE VERTICAL AXIS OF THE IMAGE
+    uDim = (nDim == 0)? 1: 0;
+    vDim = (nDim == 2)? 1: 2;
+
+    imgWidth = mesh.globalSize(uDim);
+    imgHeight = mesh.globalSize(vDim);
+
+    // LOCATE THE VARIABLE TO BE RENDERED. A VALUE OF -1 INDICATES THAT THE MAGNITUDE OF VELOCITY HAS TO BE RENDERED
+    varIndex = -1;
+    for (unsigned int i=0; i < rFields.size(); i++) {
+        if (rFields[i].fieldName == mesh.inputParams.renderVar) varIndex = i;
+        if (rFields[i].fieldName == "Vx" or rFields[i].fieldName == "Vy" or rFields[i].fieldName == "Vz") velIndices.push_back(i);
+    }
+
+    if (varIndex < 0 and mesh.inputParams.renderVar != "U") {
+        if (pf) std::cout << "WARNING: The variable " << mesh.inputParams.renderVar << " is not available for rendering. Rendering velocity magnitude instead" << std::endl;
+    }
+
+    hasPlane = (gloIndex >= mesh.subarrayStarts(nDim)) and (gloIndex <= mesh.subarrayEnds(nDim));
+    locIndex = gloIndex - mesh.subarrayStarts(nDim);
+
+    if (hasPlane) {
+        tileInfo[0] = mesh.subarrayStarts(uDim);
+        tileInfo[1] = mesh.subarrayStarts(vDim);
+        tileInfo[2] = mesh.coreSize(uDim);
+        tileInfo[3] = mesh.coreSize(vDim);
+    } else {
+        tileInfo[0] = tileInfo[1] = tileInfo[2] = tileInfo[3] = 0;
+    }
+
+    localTile.resize(std::max(tileInfo[2]*tileInfo[3], 1));
+
+    std::vector<int> allInfo(4*mesh.rankData.nProc);
+    MPI_Gather(tileInfo, 4, MPI_INT, &allInfo[0], 4, MPI_INT, 0, MPI_COMM_WORLD);
+
+    if (pf) {
+        int totalCount = 0;
+
+        tileStarts.resize(2*mesh.rankData.nProc);
+        tileSizes.resize(2*mesh.rankData.nProc);
+        tileCounts.resize(mesh.rankData.nProc);
+        tileDispls.resize(mesh.rankData.nProc);
+
+        for (int i=0; i < mesh.rankData.nProc; i++) {
+            tileStarts[2*i] = allInfo[4*i];
+            tileStarts[2*i + 1] = allInfo[4*i + 1];
+            tileSizes[2*i] = allInfo[4*i + 2];
+            tileSizes[2*i + 1] = allInfo[4*i + 3];
+
+            tileCounts[i] = tileSizes[2*i]*tileSizes[2*i + 1];
+            tileDispls[i] = totalCount;
+            totalCount += tileCounts[i];
+        }
+
+        sliceData.resize(totalCount);
+    } else {
+        tileCounts.resize(1);
+        tileDispls.resize(1);
+        sliceData.resize(1);
+    }
+
+    setColourMap();
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to render the slice at the current time
+ *
+ *          The parts of the slice held by the ranks are gathered at the root rank, which places them in the image.
+ *          The values are mapped linearly to the colour map, either between the limits set by the user,
+ *          or between the extrema of the slice when the user has not set valid limits.
+ *          Rows of the image are written from top to bottom, so that the vertical axis of the image points upwards.
+ *
+ * \param   time is a real value containing the time at which the slice is rendered
+ ********************************************************************************************************************************************
+ */
+void render::renderSlice(real time) {
+    packTile();
+
+    MPI_Gatherv(&localTile[0], hasPlane? int(localTile.size()): 0, MPI_FP_REAL,
+                &sliceData[0], &tileCounts[0], &tileDispls[0], MPI_FP_REAL, 0, MPI_COMM_WORLD);
+
+    if (pf) {
+        real minVal, maxVal;
+        std::ostringstream constFile;
+        std::vector<unsigned char> pixels(imgWidth*imgHeight);
+
+        minVal = mesh.inputParams.renderMin;
+        maxVal = mesh.inputParams.renderMax;
+        if (minVal >= maxVal) {
+            minVal = *std::min_element(sliceData.begin(), sliceData.end());
+            maxVal = *std::max_element(sliceData.begin(), sliceData.end());
+            if (maxVal <= minVal) maxVal = minVal + 1.0;
+        }
+
+        for (int n=0; n < mesh.rankData.nProc; n++) {
+            for (int j=0; j < tileSizes[2*n + 1]; j++) {
+                int row = imgHeight - 1 - (tileStarts[2*n + 1] + j);
+                for (int i=0; i < tileSizes[2*n]; i++) {
+                    real fValue = (sliceData[tileDispls[n] + j*tileSizes[2*n] + i] - minVal)/(maxVal - minVal);
+                    int cIndex = int(fValue*255.0 + 0.5);
+
+                    pixels[row*imgWidth + tileStarts[2*n] + i] = (unsigned char) std::min(std::max(cIndex, 0), 255);
+                }
+            }
+        }
+
+        constFile << "output/slice_" << std::fixed << std::setfill('0') << std::setw(9) << std::setprecision(4) << time;
+        if (mesh.inputParams.imgFormat == 1) {
+            constFile << ".ppm";
+            writePPM(constFile.str(), pixels);
+        } else {
+            constFile << ".png";
+            writePNG(constFile.str(), pixels);
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to copy the part of the slice within the sub-domain of the rank into the local buffer
+ *
+ *          The values are stored with the index along the image width varying fastest.
+ *          When the magnitude of velocity is rendered, it is computed from the available components while copying.
+ *
+ ********************************************************************************************************************************************
+ */
+void render::packTile() {
+    blitz::TinyVector<int, 3> locPoint;
+
+    if (not hasPlane) return;
+
+    locPoint(nDim) = locIndex;
+    for (int j=0; j < mesh.coreSize(vDim); j++) {
+        locPoint(vDim) = j;
+        for (int i=0; i < mesh.coreSize(uDim); i++) {
+            locPoint(uDim) = i;
+
+            if (varIndex < 0) {
+                real sqSum = 0.0;
+                for (unsigned int n=0; n < velIndices.size(); n++) sqSum += pow(rFields[velIndices[n]].F(locPoint), 2);
+                localTile[j*mesh.coreSize(uDim) + i] = sqrt(sqSum);
+            } else {
+                localTile[j*mesh.coreSize(uDim) + i] = rFields[varIndex].F(locPoint);
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to set the colour map used to render the slices
+ *
+ *          The colour map is obtained by linearly interpolating between 9 colours sampled uniformly from the perceptually uniform
+ *          viridis colour map.
+ *
+ ********************************************************************************************************************************************
+ */
+void render::setColourMap() {
+    const int numStops = 9;
+    const real cStops[numStops][3] = {{ 68,   1,  84}, { 71,  44, 122}, { 59,  81, 139},
+                                      { 44, 113, 142}, { 33, 144, 141}, { 39, 173, 129},
+                                      { 92, 200,  99}, {170, 220,  50}, {253, 231,  37}};
+
+    for (int i=0; i < 256; i++) {
+        real sPos = real(i)*(numStops - 1)/255.0;
+        int sInd = std::min(int(sPos), numStops - 2);
+        real sWgt = sPos - sInd;
+
+        for (int c=0; c < 3; c++) {
+            colourMap[3*i + c] = (unsigned char) int((1.0 - sWgt)*cStops[sInd][c] + sWgt*cStops[sInd + 1][c] + 0.5);
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to write the rendered slice as a binary PPM image
+ *
+ * \param   fileName is a string containing the name of the image file
+ * \param   pixels is a vector of colour map indices of all the pixels, stored row-wise from the top of the image
+ ********************************************************************************************************************************************
+ */
+void render::writePPM(const std::string fileName, const std::vector<unsigned char> &pixels) const {
+    std::ofstream ofFile;
+    std::vector<unsigned char> rgbData(3*pixels.size());
+
+    for (unsigned int i=0; i < pixels.size(); i++) {
+        for (int c=0; c < 3; c++) rgbData[3*i + c] = colourMap[3*pixels[i] + c];
+    }
+
+    ofFile.open(fileName.c_str(), std::fstream::out | std::fstream::binary | std::fstream::trunc);
+    if (not ofFile.is_open()) {
+        std::cout << "WARNING: Unable to open image file " << fileName << " for writing. Skipping render" << std::endl;
+        return;
+    }
+
+    ofFile << "P6\n" << imgWidth << " " << imgHeight << "\n255\n";
+    ofFile.write((const char*) &rgbData[0], rgbData.size());
+
+    ofFile.close();
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to write the rendered slice as a PNG image
+ *
+ *          The image is written with 8-bit palette indices, and the colour map is written as the palette.
+ *          Each row is preceded by the Sub filter byte and the differences of adjacent indices are compressed,
+ *          since smooth regions of the slice then reduce to long runs of identical bytes.
+ *
+ * \param   fileName is a string containing the name of the image file
+ * \param   pixels is a vector of colour map indices of all the pixels, stored row-wise from the top of the image
+ ********************************************************************************************************************************************
+ */
+void render::writePNG(const std::string fileName, const std::vector<unsigned char> &pixels) const {
+    std::ofstream ofFile;
+    std::vector<unsigned char> rawData, zData, chunkData;
+    const unsigned char pngSignature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+
+    // APPLY THE SUB FILTER TO EACH ROW
+    rawData.resize(imgHeight*(imgWidth + 1));
+    for (int j=0; j < imgHeight; j++) {
+        const unsigned char *pRow = &pixels[j*imgWidth];
+        unsigned char *rRow = &rawData[j*(imgWidth + 1)];
+
+        rRow[0] = 1;
+        rRow[1] = pRow[0];
+        for (int i=1; i < imgWidth; i++) rRow[i + 1] = (unsigned char) (pRow[i] - pRow[i - 1]);
+    }
+
+    deflateData(rawData, zData);
+
+    ofFile.open(fileName.c_str(), std::fstream::out | std::fstream::binary | std::fstream::trunc);
+    if (not ofFile.is_open()) {
+        std::cout << "WARNING: Unable to open image file " << fileName << " for writing. Skipping render" << std::endl;
+        return;
+    }
+
+    ofFile.write((const char*) pngSignature, 8);
+
+    // IMAGE HEADER: WIDTH, HEIGHT, BIT DEPTH 8, COLOUR TYPE 3 (PALETTE), DEFAULT COMPRESSION, FILTERING AND NO INTERLACING
+    chunkData.resize(13, 0);
+    for (int b=0; b < 4; b++) {
+        chunkData[b] = (unsigned char) ((imgWidth >> (24 - 8*b)) & 0xFF);
+        chunkData[4 + b] = (unsigned char) ((imgHeight >> (24 - 8*b)) & 0xFF);
+    }
+    chunkData[8] = 8;
+    chunkData[9] = 3;
+    writeChunk(ofFile, "IHDR", chunkData);
+
+    chunkData.assign(colourMap, colourMap + 768);
+    writeChunk(ofFile, "PLTE", chunkData);
+
+    writeChunk(ofFile, "IDAT", zData);
+
+    chunkData.clear();
+    writeChunk(ofFile, "IEND", chunkData);
+
+    ofFile.close();
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to write a single chunk of the PNG file along with its length and CRC
+ *
+ * \param   ofFile is the output stream of the open PNG file
+ * \param   chunkType is the four character type of the chunk
+ * \param   chunkData is the vector of bytes to be written in the chunk
+ ********************************************************************************************************************************************
+ */
+void render::writeChunk(std::ofstream &ofFile, const char *chunkType, const std::vector<unsigned char> &chunkData) const {
+    unsigned long crc;
+    unsigned char lenBytes[4], crcBytes[4];
+    unsigned long chunkLength = chunkData.size();
+
+    crc = crcValue((const unsigned char*) chunkType, 4, 0xFFFFFFFFUL);
+    if (chunkLength) crc = crcValue(&chunkData[0], chunkLength, crc);
+    crc ^= 0xFFFFFFFFUL;
+
+    for (int b=0; b < 4; b++) {
+        lenBytes[b] = (unsigned char) ((chunkLength >> (24 - 8*b)) & 0xFF);
+        crcBytes[b] = (unsigned char) ((crc >> (24 - 8*b)) & 0xFF);
+    }
+
+    ofFile.write((const char*) lenBytes, 4);
+    ofFile.write(chunkType, 4);
+    if (chunkLength) ofFile.write((const char*) &chunkData[0], chunkLength);
+    ofFile.write((const char*) crcBytes, 4);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compress data into a zlib stream for the IDAT chunk of the PNG file
+ *
+ *          The data is written as a single deflate block with the fixed Huffman codes.
+ *          Only matches at a distance of one byte are searched for, which makes the compression a run-length encoding.
+ *          This is sufficient for the filtered rows of a rendered slice, and avoids the need for an external library.
+ *
+ * \param   rawData is the vector of bytes to be compressed
+ * \param   zData is the vector into which the zlib stream is written
+ ********************************************************************************************************************************************
+ */
+void render::deflateData(const std::vector<unsigned char> &rawData, std::vector<unsigned char> &zData) const {
+    static const int lenBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static const int lenExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                     3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+
+    unsigned long bitBuffer = 0;
+    int bitCount = 0;
+
+    // BITS ARE PACKED STARTING FROM THE LEAST SIGNIFICANT BIT OF EACH BYTE
+    auto putBits = [&](unsigned long bValue, int nBits) {
+        bitBuffer |= bValue << bitCount;
+        bitCount += nBits;
+        while (bitCount >= 8) {
+            zData.push_back((unsigned char) (bitBuffer & 0xFF));
+            bitBuffer >>= 8;
+            bitCount -= 8;
+        }
+    };
+
+    // HUFFMAN CODES ARE PACKED STARTING FROM THEIR MOST SIGNIFICANT BIT
+    auto putCode = [&](unsigned long hCode, int nBits) {
+        unsigned long rCode = 0;
+        for (int b=0; b < nBits; b++) rCode |= ((hCode >> b) & 1) << (nBits - 1 - b);
+        putBits(rCode, nBits);
+    };
+
+    // FIXED HUFFMAN CODES FOR THE LITERAL/LENGTH ALPHABET
+    auto putSymbol = [&](int symbol) {
+        if (symbol < 144) putCode(0x30 + symbol, 8);
+        else if (symbol < 256) putCode(0x190 + symbol - 144, 9);
+        else if (symbol < 280) putCode(symbol - 256, 7);
+        else putCode(0xC0 + symbol - 280, 8);
+    };
+
+    zData.clear();
+
+    // ZLIB HEADER FOR DEFLATE WITH 32K WINDOW AND NO DICTIONARY
+    zData.push_back(0x78);
+    zData.push_back(0x01);
+
+    // FINAL BLOCK COMPRESSED WITH FIXED HUFFMAN CODES
+    putBits(1, 1);
+    putBits(1, 2);
+
+    size_t i = 0;
+    while (i < rawData.size()) {
+        size_t runLength = 0;
+        if (i > 0) {
+            while (i + runLength < rawData.size() and runLength < 258 and rawData[i + runLength] == rawData[i - 1]) runLength++;
+        }
+
+        if (runLength >= 3) {
+            int lCode = 28;
+            while (lenBase[lCode] > int(runLength)) lCode--;
+
+            putSymbol(257 + lCode);
+            if (lenExtra[lCode]) putBits(runLength - lenBase[lCode], lenExtra[lCode]);
+
+            // DISTANCE CODE 0 FOR A DISTANCE OF ONE BYTE
+            putCode(0, 5);
+
+            i += runLength;
+        } else {
+            putSymbol(rawData[i]);
+            i += 1;
+        }
+    }
+
+    // END OF BLOCK, FOLLOWED BY PADDING TO THE BYTE BOUNDARY
+    putSymbol(256);
+    if (bitCount > 0) putBits(0, 8 - bitCount);
+
+    // ADLER-32 CHECKSUM OF THE UNCOMPRESSED DATA
+    unsigned long adlerA = 1, adlerB = 0;
+    for (size_t n=0; n < rawData.size(); n++) {
+        adlerA = (adlerA + rawData[n]) % 65521;
+        adlerB = (adlerB + adlerA) % 65521;
+    }
+    unsigned long adlerSum = (adlerB << 16) | adlerA;
+
+    for (int b=0; b < 4; b++) zData.push_back((unsigned char) ((adlerSum >> (24 - 8*b)) & 0xFF));
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to update the CRC-32 of the PNG chunks with the given bytes
+ *
+ * \param   data is a pointer to the bytes to be added to the CRC
+ * \param   numBytes is the number of bytes to be added
+ * \param   crc is the running value of the CRC
+ *
+ * \return  The updated value of the CRC
+ ********************************************************************************************************************************************
+ */
+unsigned long render::crcValue(const unsigned char *data, size_t numBytes, unsigned long crc) const {
+    for (size_t n=0; n < numBytes; n++) {
+        crc ^= data[n];
+        for (int b=0; b < 8; b++) crc = (crc & 1)? (0xEDB88320UL ^ (crc >> 1)): (crc >> 1);
+    }
+
+    return crc & 0xFFFFFFFFUL;
+}
@@ -0,0 +1,130 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file render.h
+ *
+ *  \brief Class declaration of render
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <vector>
+#include <string>
+
+#include "field.h"
+#include "grid.h"
+
+class render {
+    public:
+        render(const grid &mesh, std::vector<field> &rFields);
+
+        void renderSlice(real time);
+
+        ~render() { };
+
+    private:
+        const grid &mesh;
+
+        // Print flag - basically flag to ease printing to I/O. It is true for root rank (0)
+        bool pf;
+
+        /** Flag that is true for all the ranks whose sub-domains intersect the rendered plane */
+        bool hasPlane;
+
+        /** Direction normal to the rendered plane and the local index of the plane along this direction */
+        int nDim, locIndex;
+
+        /** The two directions spanning the rendered plane, with uDim along the image width and vDim along the image height */
+        int uDim, vDim;
+
+        /** Width and height of the rendered image in pixels */
+        int imgWidth, imgHeight;
+
+        /** Index of the rendered field within rFields, or -1 if the magnitude of velocity is rendered */
+        int varIndex;
+
+        /** Indices of the velocity components within rFields, used when the magnitude of velocity is rendered */
+        std::vector<int> velIndices;
+
+        std::vector<field> &rFields;
+
+        /** Number of values sent by each rank to the root rank, and their displacements in the gathered buffer */
+        std::vector<int> tileCounts, tileDispls;
+
+        /** Starting global indices and sizes of the tile sent by each rank, along uDim and vDim */
+        std::vector<int> tileStarts, tileSizes;
+
+        /** Buffers holding the local tile and the full slice gathered at the root rank */
+        std::vector<real> localTile, sliceData;
+
+        /** The 256 entry colour map as RGB triplets */
+        unsigned char colourMap[768];
+
+        void setColourMap();
+        void packTile();
+
+        void writePPM(const std::string fileName, const std::vector<unsigned char> &pixels) const;
+        void writePNG(const std::string fileName, const std::vector<unsigned char> &pixels) const;
+
+        void writeChunk(std::ofstream &ofFile, const char *chunkType, const std::vector<unsigned char> &chunkData) const;
+        void deflateData(const std::vector<unsigned char> &rawData, std::vector<unsigned char> &zData) const;
+
+        unsigned long crcValue(const unsigned char *data, size_t numBytes, unsigned long crc) const;
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class render render.h "lib/io/render.h"
+ *  \brief Class to render a 2D slice of the solution into an image while the solver runs
+ *
+ *  The ranks whose sub-domains intersect the plane chosen by the user send their part of the slice to the root rank.
+ *  The root rank assembles the slice, maps the values to colours and writes them as a PPM or PNG image into the output folder.
+ *  The PNG images are written with a palette and compressed with a simple run-length deflate encoder, so that no external
+ *  image library is needed.
+ *  This allows quick visual monitoring of a run without writing and post-processing full solution files.
+ ********************************************************************************************************************************************
+ */
+
+#endif
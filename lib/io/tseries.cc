@@ -95,7 +95,10 @@ tseries::tseries(const grid &mesh, vfield &solverV, const real &solverTime, cons
         }
     }
 #endif
-    MPI_Allreduce(&localVol, &totalVol, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+    // THE VOLUME IS REDUCED ONLY ONCE, AND ITS CALL SITE IS REGISTERED WITH THE PROFILER RIGHT HERE
+    mesh.rankData.allReduce(&localVol, &totalVol, 1, MPI_SUM, mesh.rankData.registerSite("Reduce tseries::tseries"));
+
+    tsSite = mesh.rankData.registerSite("Reduce tseries::writeTSData");
 
     // This switch decides if mean or maximum of divergence has to be printed.
     // Ideally maximum has to be tracked, but mean is a less strict metric.
@@ -190,7 +193,7 @@ void tseries::writeTSData() {
         }
     }
 #endif
-    MPI_Allreduce(&localKineticEnergy, &totalKineticEnergy, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+    mesh.rankData.allReduce(&localKineticEnergy, &totalKineticEnergy, 1, MPI_SUM, tsSite);
     totalKineticEnergy /= totalVol;
     if (mesh.inputParams.lesModel) subgridEnergy /= totalVol;
 
@@ -283,9 +286,9 @@ void tseries::writeTSData(const sfield &T) {
     }
 #endif
 
-    MPI_Allreduce(&localKineticEnergy, &totalKineticEnergy, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
-    MPI_Allreduce(&localThermalEnergy, &totalThermalEnergy, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
-    MPI_Allreduce(&localUzT, &totalUzT, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+    mesh.rankData.allReduce(&localKineticEnergy, &totalKineticEnergy, 1, MPI_SUM, tsSite);
+    mesh.rankData.allReduce(&localThermalEnergy, &totalThermalEnergy, 1, MPI_SUM, tsSite);
+    mesh.rankData.allReduce(&localUzT, &totalUzT, 1, MPI_SUM, tsSite);
     totalKineticEnergy /= totalVol;
     totalThermalEnergy /= totalVol;
     NusseltNo = 1.0 + (totalUzT/totalVol)/tDiff;
@@ -76,6 +76,9 @@ class tseries {
         real totalThermalEnergy, localThermalEnergy;
         real totalUzT, localUzT, NusseltNo, ReynoldsNo;
 
+        /** Counter of the profiler under which the reductions of the global quantities are recorded. It is NULL when profiling is disabled */
+        commprof::counter *tsSite;
+
         const real &time, &tStp;
 
         const grid &mesh;
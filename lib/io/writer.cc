@@ -50,13 +50,19 @@
  *
  * \param   mesh is a const reference to the global data contained in the grid class
  * \param   wField is a vector of sfields to be written
+ * \param   rsSuffix is a string appended to the names of the restart files, to keep apart the restart data of fields on different grids
  ********************************************************************************************************************************************
  */
-writer::writer(const grid &mesh, std::vector<field> &wFields): mesh(mesh), wFields(wFields) {
+writer::writer(const grid &mesh, std::vector<field> &wFields, std::string rsSuffix): mesh(mesh), wFields(wFields), ioTuning(mesh.inputParams), rawWriter(mesh, wFields, rsSuffix) {
     // Flag to enable printing to I/O only by 0 rank
     pf = false;
     if (mesh.rankData.rank == 0) pf = true;
 
+    rsFile = "output/restartFile" + rsSuffix + ".h5";
+
+    // Report the settings used for parallel I/O
+    if (pf) ioTuning.printTuning();
+
     /** Initialize the common global and local limits for file writing */
     initLimits();
 
@@ -85,6 +91,9 @@ void writer::initLimits() {
     hsize_t offset[3];          /* offset of hyperslab */
 #endif
 
+    hsize_t dimsm[3];           /* memory dataspace dimensions */
+    hsize_t offsetm[3];         /* offset of hyperslab in memory */
+
     locSize = mesh.coreSize;
     gloSize = mesh.globalSize;
     sdStart = mesh.subarrayStarts;
@@ -94,33 +103,23 @@ void writer::initLimits() {
     locSize(1) = 1;
 #endif
 
-    // Create a dataspace representing the full limits of the local array - this is the source dataspace
-#ifdef PLANAR
-    dimsf[0] = locSize(0);
-    dimsf[1] = locSize(2);
-    sourceDSpace = H5Screate_simple(2, dimsf, NULL);
-#else
-    dimsf[0] = locSize(0);
-    dimsf[1] = locSize(1);
-    dimsf[2] = locSize(2);
-    sourceDSpace = H5Screate_simple(3, dimsf, NULL);
-#endif
-
-    // Modify the view of the *source* dataspace by using a hyperslab - *this view will be used to read from memory*
-#ifdef PLANAR
-    dimsf[0] = locSize(0);
-    dimsf[1] = locSize(2);
-    offset[0] = 0;
-    offset[1] = 0;
-#else
-    dimsf[0] = locSize(0);
-    dimsf[1] = locSize(1);
-    dimsf[2] = locSize(2);
-    offset[0] = 0;
-    offset[1] = 0;
-    offset[2] = 0;
-#endif
-    status = H5Sselect_hyperslab(sourceDSpace, H5S_SELECT_SET, offset, NULL, dimsf, NULL);
+    // Create a dataspace representing the full limits of the local array including the pads - this is the source dataspace
+    // The dataspace is always 3D since it describes the padded blitz array of the field in memory
+    // Its size is that of the storage of the array, which may have extra points beyond the pads along the inner dimensions
+    dimsm[0] = mesh.fullSize(0) + mesh.allocPads(0);
+    dimsm[1] = mesh.fullSize(1) + mesh.allocPads(1);
+    dimsm[2] = mesh.fullSize(2) + mesh.allocPads(2);
+    sourceDSpace = H5Screate_simple(3, dimsm, NULL);
+
+    // Modify the view of the *source* dataspace by using a hyperslab that selects only the core - *this view will be used to read from memory*
+    // This allows the data to be written directly from the field without copying the core into a separate buffer
+    dimsm[0] = locSize(0);
+    dimsm[1] = locSize(1);
+    dimsm[2] = locSize(2);
+    offsetm[0] = mesh.padWidths(0);
+    offsetm[1] = mesh.padWidths(1);
+    offsetm[2] = mesh.padWidths(2);
+    status = H5Sselect_hyperslab(sourceDSpace, H5S_SELECT_SET, offsetm, NULL, dimsm, NULL);
     if (status) {
         if (pf) std::cout << "Error in creating hyperslab while writing data. Aborting" << std::endl;
         MPI_Finalize();
@@ -216,7 +215,7 @@ void writer::outputCheck() {
  ********************************************************************************************************************************************
  */
 void writer::writeTarang(real time) {
-    hid_t plist_id;
+    hid_t plist_id, dcpl_id;
     hid_t fileHandle;
     hid_t dataSet;
 
@@ -262,8 +261,7 @@ void writer::writeTarang(real time) {
         strcpy(fieldStr, constFile.str().c_str());
 
         // Create a property list for collectively opening a file by all processors
-        plist_id = H5Pcreate(H5P_FILE_ACCESS);
-        H5Pset_fapl_mpio(plist_id, MPI_COMM_WORLD, MPI_INFO_NULL);
+        plist_id = ioTuning.fileAccess();
 
         // Generate the foldername corresponding to the time
         fileName = new char[100];
@@ -278,28 +276,21 @@ void writer::writeTarang(real time) {
         H5Pclose(plist_id);
 
         // Create a property list to use collective data write
-        plist_id = H5Pcreate(H5P_DATASET_XFER);
-        H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
-
-#ifdef PLANAR
-        fieldData.resize(blitz::TinyVector<int, 2>(locSize(0), locSize(2)));
-#else
-        fieldData.resize(locSize);
-#endif
+        plist_id = ioTuning.dataTransfer();
 
-        //Write data after first interpolating them to cell centers
-        copyData(wFields[i]);
+        // Create a property list for creating the datasets of fields
+        dcpl_id = ioTuning.dataCreate();
 
         // Create the dataset *for the file*, linking it to the file handle.
         // Correspondingly, it will use the *core* dataspace, as only the core has to be written excluding the pads
-        dataSet = H5Dcreate2(fileHandle, wFields[i].fieldName.c_str(), H5T_NATIVE_REAL, targetDSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        dataSet = H5Dcreate2(fileHandle, wFields[i].fieldName.c_str(), H5T_NATIVE_REAL, targetDSpace, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
 
         // Write the dataset. Most important thing to note is that the 3rd and 4th arguments represent the *source* and *destination* dataspaces.
-        // The source here is the sourceDSpace pointing to the memory buffer. Note that its view has been adjusted using hyperslab.
+        // The source here is the sourceDSpace pointing to the padded array of the field. Note that its view has been adjusted using hyperslab.
         // The destination is the targetDSpace. Though the targetDSpace is smaller than the sourceDSpace,
         // only the appropriate hyperslab within the sourceDSpace is transferred to the destination.
 
-        status = H5Dwrite(dataSet, H5T_NATIVE_REAL, sourceDSpace, targetDSpace, plist_id, fieldData.dataFirst());
+        status = H5Dwrite(dataSet, H5T_NATIVE_REAL, sourceDSpace, targetDSpace, plist_id, wFields[i].F.dataFirst());
         if (status) {
             if (pf) std::cout << "Error in writing output to HDF file. Aborting" << std::endl;
             MPI_Finalize();
@@ -309,6 +300,7 @@ void writer::writeTarang(real time) {
         // CLOSE/RELEASE RESOURCES
         H5Dclose(dataSet);
         H5Pclose(plist_id);
+        H5Pclose(dcpl_id);
         H5Fclose(fileHandle);
 
         delete fileName;
@@ -329,7 +321,7 @@ void writer::writeTarang(real time) {
  ********************************************************************************************************************************************
  */
 void writer::writeSolution(real time) {
-    hid_t plist_id;
+    hid_t plist_id, dcpl_id;
     hid_t fileHandle;
     hid_t dataSet;
 
@@ -340,8 +332,7 @@ void writer::writeSolution(real time) {
     char* fileName;
 
     // Create a property list for collectively opening a file by all processors
-    plist_id = H5Pcreate(H5P_FILE_ACCESS);
-    H5Pset_fapl_mpio(plist_id, MPI_COMM_WORLD, MPI_INFO_NULL);
+    plist_id = ioTuning.fileAccess();
 
     // Generate the filename corresponding to the solution file
     fileName = new char[100];
@@ -378,29 +369,22 @@ void writer::writeSolution(real time) {
     H5Dclose(dataSet);
 
     // Create a property list to use collective data write
-    plist_id = H5Pcreate(H5P_DATASET_XFER);
-    H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+    plist_id = ioTuning.dataTransfer();
 
-    for (unsigned int i=0; i < wFields.size(); i++) {
-#ifdef PLANAR
-        fieldData.resize(blitz::TinyVector<int, 2>(locSize(0), locSize(2)));
-#else
-        fieldData.resize(locSize);
-#endif
-
-        //Write data after first interpolating them to cell centers
-        copyData(wFields[i]);
+    // Create a property list for creating the datasets of fields
+    dcpl_id = ioTuning.dataCreate();
 
+    for (unsigned int i=0; i < wFields.size(); i++) {
         // Create the dataset *for the file*, linking it to the file handle.
         // Correspondingly, it will use the *core* dataspace, as only the core has to be written excluding the pads
-        dataSet = H5Dcreate2(fileHandle, wFields[i].fieldName.c_str(), H5T_NATIVE_REAL, targetDSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        dataSet = H5Dcreate2(fileHandle, wFields[i].fieldName.c_str(), H5T_NATIVE_REAL, targetDSpace, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
 
         // Write the dataset. Most important thing to note is that the 3rd and 4th arguments represent the *source* and *destination* dataspaces.
-        // The source here is the sourceDSpace pointing to the memory buffer. Note that its view has been adjusted using hyperslab.
+        // The source here is the sourceDSpace pointing to the padded array of the field. Note that its view has been adjusted using hyperslab.
         // The destination is the targetDSpace. Though the targetDSpace is smaller than the sourceDSpace,
         // only the appropriate hyperslab within the sourceDSpace is transferred to the destination.
 
-        status = H5Dwrite(dataSet, H5T_NATIVE_REAL, sourceDSpace, targetDSpace, plist_id, fieldData.dataFirst());
+        status = H5Dwrite(dataSet, H5T_NATIVE_REAL, sourceDSpace, targetDSpace, plist_id, wFields[i].F.dataFirst());
         if (status) {
             if (pf) std::cout << "Error in writing output to HDF file. Aborting" << std::endl;
             MPI_Finalize();
@@ -413,6 +397,7 @@ void writer::writeSolution(real time) {
 
     // CLOSE/RELEASE RESOURCES
     H5Pclose(plist_id);
+    H5Pclose(dcpl_id);
     H5Fclose(fileHandle);
 
     delete fileName;
@@ -426,23 +411,29 @@ void writer::writeSolution(real time) {
  *          The restart file is similar to the solution file, but it doesn't contain the extra data on grids.
  *          The solution file at any given time can be renamed as the restart file to resume the solver from that time.
  *          The restart file is overwritten with each call to this function.
+ *          If the file-per-rank restart format is chosen by the user, the data is instead written through \ref rawrestart.
  *
  * \param   time is a real value containing the time to be added as metadata to the restart file
  ********************************************************************************************************************************************
  */
 void writer::writeRestart(real time) {
-    hid_t plist_id;
+    hid_t plist_id, dcpl_id;
     hid_t fileHandle;
     hid_t dataSet;
 
     herr_t status;
 
+    // Write one binary file per rank if the corresponding format is chosen
+    if (mesh.inputParams.rsFormat == 2) {
+        rawWriter.writeData(time);
+        return;
+    }
+
     // Create a property list for collectively opening a file by all processors
-    plist_id = H5Pcreate(H5P_FILE_ACCESS);
-    H5Pset_fapl_mpio(plist_id, MPI_COMM_WORLD, MPI_INFO_NULL);
+    plist_id = ioTuning.fileAccess();
 
     // First create a file handle with the path to the output file
-    fileHandle = H5Fcreate("output/restartFile.h5", H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+    fileHandle = H5Fcreate(rsFile.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
 
     // Close the property list for later reuse
     H5Pclose(plist_id);
@@ -453,29 +444,22 @@ void writer::writeRestart(real time) {
     H5Dclose(dataSet);
 
     // Create a property list to use collective data write
-    plist_id = H5Pcreate(H5P_DATASET_XFER);
-    H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
-
-    for (unsigned int i=0; i < wFields.size(); i++) {
-#ifdef PLANAR
-        fieldData.resize(blitz::TinyVector<int, 2>(locSize(0), locSize(2)));
-#else
-        fieldData.resize(locSize);
-#endif
+    plist_id = ioTuning.dataTransfer();
 
-        //Write data
-        copyData(wFields[i]);
+    // Create a property list for creating the datasets of fields
+    dcpl_id = ioTuning.dataCreate();
 
+    for (unsigned int i=0; i < wFields.size(); i++) {
         // Create the dataset *for the file*, linking it to the file handle.
         // Correspondingly, it will use the *core* dataspace, as only the core has to be written excluding the pads
-        dataSet = H5Dcreate2(fileHandle, wFields[i].fieldName.c_str(), H5T_NATIVE_REAL, targetDSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        dataSet = H5Dcreate2(fileHandle, wFields[i].fieldName.c_str(), H5T_NATIVE_REAL, targetDSpace, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
 
         // Write the dataset. Most important thing to note is that the 3rd and 4th arguments represent the *source* and *destination* dataspaces.
-        // The source here is the sourceDSpace pointing to the memory buffer. Note that its view has been adjusted using hyperslab.
+        // The source here is the sourceDSpace pointing to the padded array of the field. Note that its view has been adjusted using hyperslab.
         // The destination is the targetDSpace. Though the targetDSpace is smaller than the sourceDSpace,
         // only the appropriate hyperslab within the sourceDSpace is transferred to the destination.
 
-        status = H5Dwrite(dataSet, H5T_NATIVE_REAL, sourceDSpace, targetDSpace, plist_id, fieldData.dataFirst());
+        status = H5Dwrite(dataSet, H5T_NATIVE_REAL, sourceDSpace, targetDSpace, plist_id, wFields[i].F.dataFirst());
         if (status) {
             if (pf) std::cout << "Error in writing output to HDF file. Aborting" << std::endl;
             MPI_Finalize();
@@ -488,29 +472,8 @@ void writer::writeRestart(real time) {
 
     // CLOSE/RELEASE RESOURCES
     H5Pclose(plist_id);
+    H5Pclose(dcpl_id);
     H5Fclose(fileHandle);
 }
 
-/**
- ********************************************************************************************************************************************
- * \brief   Function to copy data to a blitz array without pads
- *
- *          In order to simplify the file views while writing to disk from memory for the restart file,
- *          the variables are copied into a local blitz array without the pads.
- *
- ********************************************************************************************************************************************
- */
-void writer::copyData(field &outField) {
-#ifdef PLANAR
-    for (int i=0; i < fieldData.shape()[0]; i++)
-        for (int k=0; k < fieldData.shape()[1]; k++)
-            fieldData(i, k) = outField.F(i, 0, k);
-#else
-    for (int i=0; i < fieldData.shape()[0]; i++)
-        for (int j=0; j < fieldData.shape()[1]; j++)
-            for (int k=0; k < fieldData.shape()[2]; k++)
-                fieldData(i, j, k) = outField.F(i, j, k);
-#endif
-}
-
 writer::~writer() { }
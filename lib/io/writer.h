@@ -50,10 +50,12 @@
 #include "field.h"
 #include "grid.h"
 #include "hdf5.h"
+#include "iotune.h"
+#include "rawrestart.h"
 
 class writer {
     public:
-        writer(const grid &mesh, std::vector<field> &wFields);
+        writer(const grid &mesh, std::vector<field> &wFields, std::string rsSuffix = "");
 
         void writeTarang(real time);
         void writeSolution(real time);
@@ -69,11 +71,14 @@ class writer {
 
         std::vector<field> &wFields;
 
-#ifdef PLANAR
-        blitz::Array<real, 2> fieldData;
-#else
-        blitz::Array<real, 3> fieldData;
-#endif
+        /** Instance of the \ref iotune class that provides the property lists for parallel file I/O */
+        iotune ioTuning;
+
+        /** Instance of the \ref rawrestart class used to write restart files when the file-per-rank format is chosen */
+        rawrestart rawWriter;
+
+        /** Name of the HDF5 restart file, output/restartFile followed by the suffix given to the constructor */
+        std::string rsFile;
 
         hid_t timeDSpace;
         hid_t xDSpace, yDSpace, zDSpace;
@@ -84,8 +89,6 @@ class writer {
         void outputCheck();
 
         void initLimits();
-
-        void copyData(field &outField);
 };
 
 /**
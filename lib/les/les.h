@@ -107,14 +107,17 @@ class spiral: public les {
         // Sub-grid energy
         real K;
 
+        // Counter of the profiler under which the reduction of the sub-grid energy is recorded. It is NULL when profiling is disabled
+        commprof::counter *sgSite;
+
         // These 9 arrays store components of the velocity gradient tensor intially
         // Then they are reused to store the derivatives of stress tensor to calculate its divergence
-        blitz::Array<real, 3> A11, A12, A13;
-        blitz::Array<real, 3> A21, A22, A23;
-        blitz::Array<real, 3> A31, A32, A33;
+        blitz::Array<sreal, 3> A11, A12, A13;
+        blitz::Array<sreal, 3> A21, A22, A23;
+        blitz::Array<sreal, 3> A31, A32, A33;
 
         // These 3 arrays are used only when computing scalar turbulent SGS diffusion
-        blitz::Array<real, 3> B1, B2, B3;
+        blitz::Array<sreal, 3> B1, B2, B3;
 
         // These are three 3x3x3 arrays containing local interpolated velocities
         // These are used to calculate the structure function within the spiral les routine
@@ -65,6 +65,9 @@ spiral::spiral(const grid &mesh, const real &kDiff): les(mesh), nu(kDiff) {
     blitz::TinyVector<int, 3> dSize = mesh.fullDomain.ubound() - mesh.fullDomain.lbound() + 1;
     blitz::TinyVector<int, 3> dlBnd = mesh.fullDomain.lbound();
 
+    // Counter of the profiler for the reduction of the sub-grid energy
+    sgSite = mesh.rankData.registerSite("Reduce spiral::computeSG");
+
     // Scalar fields used to store components of the sub-grid stress tensor field
     Txx = new sfield(mesh, "Txx");
     Tyy = new sfield(mesh, "Tyy");
@@ -199,7 +202,7 @@ real spiral::computeSG(plainvf &nseRHS, vfield &V) {
         }
     }
 
-    MPI_Allreduce(&localSGKE, &totalSGKE, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+    mesh.rankData.allReduce(&localSGKE, &totalSGKE, 1, MPI_SUM, sgSite);
 
     // Synchronize the sub-grid stress tensor field data across MPI processors
     Txx->syncData();
@@ -347,7 +350,7 @@ real spiral::computeSG(plainvf &nseRHS, plainsf &tmpRHS, vfield &V, sfield &T) {
         }
     }
 
-    MPI_Allreduce(&localSGKE, &totalSGKE, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+    mesh.rankData.allReduce(&localSGKE, &totalSGKE, 1, MPI_SUM, sgSite);
 
     // Synchronize the sub-grid stress tensor field data across MPI processors
     Txx->syncData();
@@ -369,9 +372,10 @@ real spiral::computeSG(plainvf &nseRHS, plainsf &tmpRHS, vfield &V, sfield &T) {
     Tzz->derS.calcDerivative1_z(A33);
 
     // Compute the divergence of the sub-grid stress tensor field
-    B1 = A11 + A21 + A31;
-    B2 = A12 + A22 + A32;
-    B3 = A13 + A23 + A33;
+    // The first operand is cast to real so that the sums are evaluated in real even when the arrays are stored as sreal
+    B1 = blitz::cast<real>(A11) + A21 + A31;
+    B2 = blitz::cast<real>(A12) + A22 + A32;
+    B3 = blitz::cast<real>(A13) + A23 + A33;
 
     // Add the divergence to the RHS of NSE provided as argument to the function
     nseRHS.Vx(core) = nseRHS.Vx(core) + B1(core);
@@ -404,21 +408,21 @@ real spiral::computeSG(plainvf &nseRHS, plainsf &tmpRHS, vfield &V, sfield &T) {
         V.derVz.calcDerivative2yy(A32);
         V.derVz.calcDerivative2zz(A33);
 
-        A11 = A11 + A12 + A13;
-        A22 = A21 + A22 + A23;
-        A33 = A31 + A32 + A33;
+        A11 = blitz::cast<real>(A11) + A12 + A13;
+        A22 = blitz::cast<real>(A21) + A22 + A23;
+        A33 = blitz::cast<real>(A31) + A32 + A33;
 
         B1 /= A11;
         B2 /= A22;
         B3 /= A33;
 
-        B1 = (B1 + B2 + B3)/(mesh.inputParams.Pr*3.0);
+        B1 = (blitz::cast<real>(B1) + B2 + B3)/(mesh.inputParams.Pr*3.0);
 
         T.derS.calcDerivative2xx(A11);
         T.derS.calcDerivative2yy(A22);
         T.derS.calcDerivative2zz(A33);
 
-        tmpRHS.F(core) = tmpRHS.F(core) + B1(core)*(A11(core) + A22(core) + A33(core));
+        tmpRHS.F(core) = tmpRHS.F(core) + B1(core)*(blitz::cast<real>(A11(core)) + A22(core) + A33(core));
     }
 
     return totalSGKE;
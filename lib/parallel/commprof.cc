@@ -0,0 +1,218 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file commprof.cc
+ *
+ *  \brief Definitions for functions of class commprof
+ *  \sa commprof.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "commprof.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to get the counter of a call site
+ *
+ *          The counter is created when a call site is used for the first time.
+ *          Since the counters are stored in a map, the pointer remains valid for the lifetime of the profiler,
+ *          and call sites which are executed often should store it rather than calling this function every time.
+ *
+ * \param   siteName is the name which identifies the call site in the report
+ *
+ * \return  Pointer to the counter of the call site
+ ********************************************************************************************************************************************
+ */
+commprof::counter *commprof::site(const std::string siteName) {
+    std::map<std::string, counter>::iterator it = sites.find(siteName);
+
+    if (it == sites.end()) {
+        counter newSite;
+
+        newSite.calls = 0;
+        newSite.bytes = 0.0;
+        newSite.waitTime = 0.0;
+
+        it = sites.insert(std::make_pair(siteName, newSite)).first;
+    }
+
+    return &(it->second);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to write the communication profile of the run
+ *
+ *          This function must be called by all the ranks, since the statistics of each call site are reduced across ranks.
+ *          Because all the halo exchanges and reductions are collective, every rank should have the same set of call sites.
+ *          As the sites are stored in a map, they are then also in the same order on all ranks.
+ *          Since the statistics are reduced by their position in this order, the number of sites and a hash of their
+ *          ordered names are first compared across ranks, and the report is not written if they differ.
+ *          For each call site, the total number of bytes sent, and the minimum, mean and maximum wait times are written.
+ *          The imbalance is the ratio of the maximum wait time to the mean.
+ *          For reductions, a large imbalance usually points to uneven computational load before the call site,
+ *          since the ranks which arrive early wait for the slowest one.
+ *
+ * \param   rank is the MPI rank of the calling process
+ * \param   nProc is the total number of processes
+ ********************************************************************************************************************************************
+ */
+void commprof::writeReport(const int rank, const int nProc) const {
+    int locCount, minCount, maxCount;
+    unsigned long long locHash, minHash, maxHash;
+    double totalTime;
+    std::ofstream ofFile;
+
+    locCount = sites.size();
+    MPI_Allreduce(&locCount, &minCount, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(&locCount, &maxCount, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+
+    locHash = siteHash();
+    MPI_Allreduce(&locHash, &minHash, 1, MPI_UNSIGNED_LONG_LONG, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(&locHash, &maxHash, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, MPI_COMM_WORLD);
+
+    if ((minCount != maxCount) or (minHash != maxHash)) {
+        if (rank == 0) {
+            std::cout << "WARNING: Communication call sites differ across ranks. Communication profile will not be written" << std::endl;
+        }
+        return;
+    }
+
+    std::vector<double> locBytes, locTime, gloBytes, minTime, sumTime, maxTime;
+
+    for (std::map<std::string, counter>::const_iterator it = sites.begin(); it != sites.end(); ++it) {
+        locBytes.push_back(it->second.bytes);
+        locTime.push_back(it->second.waitTime);
+    }
+
+    gloBytes.resize(locCount);
+    minTime.resize(locCount);
+    sumTime.resize(locCount);
+    maxTime.resize(locCount);
+
+    MPI_Reduce(locBytes.data(), gloBytes.data(), locCount, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(locTime.data(), minTime.data(), locCount, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD);
+    MPI_Reduce(locTime.data(), sumTime.data(), locCount, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(locTime.data(), maxTime.data(), locCount, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+    if (rank > 0) return;
+
+    totalTime = 0.0;
+    for (int i=0; i<locCount; i++) totalTime += sumTime[i]/nProc;
+
+    ofFile.open("output/CommProfile.dat", std::fstream::out);
+    if (not ofFile.is_open()) {
+        std::cout << "WARNING: Unable to open output/CommProfile.dat. Communication profile will not be written" << std::endl;
+        return;
+    }
+
+    ofFile << "# Communication profile over " << nProc << " ranks. Times are in seconds, and data sent is summed over all ranks" << std::endl;
+    ofFile << "# Mean time spent in communication per rank: " << std::scientific << std::setprecision(4) << totalTime << std::endl;
+    ofFile << "#" << std::setw(39) << std::left << " Call site" << std::right <<
+              std::setw(12) << "Calls" << std::setw(14) << "MB sent" <<
+              std::setw(14) << "Min time" << std::setw(14) << "Mean time" << std::setw(14) << "Max time" <<
+              std::setw(12) << "Imbalance" << std::setw(10) << "% time" << std::endl;
+
+    int i = 0;
+    for (std::map<std::string, counter>::const_iterator it = sites.begin(); it != sites.end(); ++it, ++i) {
+        double meanTime = sumTime[i]/nProc;
+
+        ofFile << "  " << std::setw(38) << std::left << it->first << std::right <<
+                  std::setw(12) << it->second.calls <<
+                  std::scientific << std::setprecision(4) <<
+                  std::setw(14) << gloBytes[i]/1.0e6 <<
+                  std::setw(14) << minTime[i] << std::setw(14) << meanTime << std::setw(14) << maxTime[i] <<
+                  std::fixed << std::setprecision(2) <<
+                  std::setw(12) << (meanTime > 0.0? maxTime[i]/meanTime: 1.0) <<
+                  std::setw(10) << (totalTime > 0.0? 100.0*meanTime/totalTime: 0.0) << std::endl;
+    }
+
+    ofFile.close();
+
+    std::cout << "Communication profile written to output/CommProfile.dat" << std::endl;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute a hash of the names of all the call sites, in the order in which they are stored
+ *
+ *          The 64-bit FNV-1a hash is used, with a null character appended to each name so that the boundaries
+ *          between names also contribute to the hash.
+ *
+ * \return  The hash of the ordered names of the call sites
+ ********************************************************************************************************************************************
+ */
+unsigned long long commprof::siteHash() const {
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (std::map<std::string, counter>::const_iterator it = sites.begin(); it != sites.end(); ++it) {
+        for (unsigned int i=0; i <= it->first.size(); i++) {
+            hash ^= (unsigned char) it->first.c_str()[i];
+            hash *= 1099511628211ULL;
+        }
+    }
+
+    return hash;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to get the number of bytes sent in a message
+ *
+ *          Messages to MPI_PROC_NULL are not sent, and hence contribute no bytes.
+ *
+ * \param   msgType is the MPI datatype of the message
+ * \param   destRank is the rank of the process to which the message is sent
+ *
+ * \return  The number of bytes sent
+ ********************************************************************************************************************************************
+ */
+double commprof::msgBytes(const MPI_Datatype msgType, const int destRank) {
+    int typeSize;
+
+    if (destRank == MPI_PROC_NULL) return 0.0;
+
+    MPI_Type_size(msgType, &typeSize);
+
+    return double(typeSize);
+}
@@ -0,0 +1,106 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file commprof.h
+ *
+ *  \brief Class declaration of commprof
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef COMMPROF_H
+#define COMMPROF_H
+
+#include <mpi.h>
+#include <map>
+#include <string>
+
+class commprof {
+    public:
+        /** Statistics of all the communication calls made from a single call site */
+        struct counter {
+            /** Number of times the call site was executed */
+            long calls;
+
+            /** Total number of bytes sent by this rank from the call site */
+            double bytes;
+
+            /** Total time spent by the calling thread waiting for the communication to complete */
+            double waitTime;
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to add a completed communication call to the counter
+ *
+ * \param   nBytes is the number of bytes sent by the call
+ * \param   tStart is the value of MPI_Wtime when the call was started
+ ********************************************************************************************************************************************
+ */
+            inline void add(const double nBytes, const double tStart) {
+                calls += 1;
+                bytes += nBytes;
+                waitTime += MPI_Wtime() - tStart;
+            };
+        };
+
+    private:
+        /** Counters of all the call sites, identified by their names */
+        std::map<std::string, counter> sites;
+
+        unsigned long long siteHash() const;
+
+    public:
+        counter *site(const std::string siteName);
+
+        void writeReport(const int rank, const int nProc) const;
+
+        static double msgBytes(const MPI_Datatype msgType, const int destRank);
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class commprof commprof.h "lib/commprof.h"
+ *  \brief Class to record the statistics of inter-processor communication at each call site of the solver
+ *
+ *  Every halo exchange and global reduction of the solver is tagged with the name of its call site.
+ *  The number of calls, bytes sent and the time spent waiting for the communication are accumulated per call site.
+ *  Since only two calls to MPI_Wtime and a few additions are made per communication call, the profiler may be left on
+ *  in production runs.
+ *  At the end of the run, the statistics of all ranks are collected and written to a report along with the imbalance
+ *  in the wait times across ranks.
+ ********************************************************************************************************************************************
+ */
+
+#endif
@@ -0,0 +1,148 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file commthread.cc
+ *
+ *  \brief Definitions for functions of class commthread
+ *  \sa commthread.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include "commthread.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the commthread class
+ *
+ *          The constructor starts the progress thread, which waits for tasks to be posted to it.
+ *          MPI must have been initialized with support for MPI_THREAD_MULTIPLE before the class is created.
+ ********************************************************************************************************************************************
+ */
+commthread::commthread(): postCount(0), doneCount(0), stopFlag(false) {
+    worker = std::thread(&commthread::run, this);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function executed by the progress thread
+ *
+ *          The thread sleeps till a task is posted, and performs the tasks one after the other in the order they were posted.
+ *          After each task, all the threads waiting for a task to complete are woken up.
+ *          When the class is destroyed, the thread exits after completing all the tasks already posted.
+ ********************************************************************************************************************************************
+ */
+void commthread::run() {
+    while (true) {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(qLock);
+            postSignal.wait(lock, [this] { return stopFlag or (not tasks.empty()); });
+
+            if (tasks.empty()) return;
+
+            task = tasks.front();
+            tasks.pop_front();
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(qLock);
+            doneCount += 1;
+        }
+        doneSignal.notify_all();
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to post a communication task to the progress thread
+ *
+ *          The task is queued and the function returns immediately.
+ *          All the data used by the task must remain valid and unmodified till the task is completed.
+ *
+ * \param   task is the function object which performs the MPI calls
+ *
+ * \return  The ticket of the task, which is to be passed to \ref wait to wait for its completion
+ ********************************************************************************************************************************************
+ */
+long commthread::post(const std::function<void()> task) {
+    long ticket;
+
+    {
+        std::lock_guard<std::mutex> lock(qLock);
+        tasks.push_back(task);
+        ticket = postCount++;
+    }
+    postSignal.notify_one();
+
+    return ticket;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to wait till a posted task is completed
+ *
+ *          Since the tasks are completed in order, all the tasks posted before the given one are also completed on return.
+ *
+ * \param   ticket is the ticket returned by \ref post when the task was posted
+ ********************************************************************************************************************************************
+ */
+void commthread::wait(const long ticket) {
+    std::unique_lock<std::mutex> lock(qLock);
+    doneSignal.wait(lock, [this, ticket] { return doneCount > ticket; });
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Destructor of the commthread class
+ *
+ *          The progress thread is asked to stop, and is joined after it completes the tasks already posted.
+ ********************************************************************************************************************************************
+ */
+commthread::~commthread() {
+    {
+        std::lock_guard<std::mutex> lock(qLock);
+        stopFlag = true;
+    }
+    postSignal.notify_one();
+
+    worker.join();
+}
@@ -0,0 +1,95 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file commthread.h
+ *
+ *  \brief Class declaration of commthread
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#ifndef COMMTHREAD_H
+#define COMMTHREAD_H
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+class commthread {
+    private:
+        /** The thread which performs all the communication tasks posted to it */
+        std::thread worker;
+
+        /** Lock protecting the queue of tasks, the counters and the stop flag */
+        std::mutex qLock;
+
+        /** Signals to wake the worker when a task is posted, and the waiting threads when a task is completed */
+        std::condition_variable postSignal, doneSignal;
+
+        /** Queue of communication tasks which are yet to be started */
+        std::deque<std::function<void()> > tasks;
+
+        /** Number of tasks posted and completed so far. Tasks complete in the order in which they are posted */
+        long postCount, doneCount;
+
+        bool stopFlag;
+
+        void run();
+
+    public:
+        commthread();
+
+        long post(const std::function<void()> task);
+        void wait(const long ticket);
+
+        ~commthread();
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class commthread commthread.h "lib/commthread.h"
+ *  \brief Class for a dedicated thread which performs MPI communication on behalf of the compute threads
+ *
+ *  Many MPI libraries make progress on non-blocking transfers only when the application calls into the library.
+ *  With the progress thread, the halo exchanges of mpidata and the global reductions of the parallel class are posted as tasks
+ *  and performed by this thread, while the compute threads only wait for the tickets of the tasks they need to complete.
+ *  Since the tasks are performed one after the other in the order in which they are posted, the order of MPI calls
+ *  is the same on all ranks, as it is without the progress thread.
+ ********************************************************************************************************************************************
+ */
+
+#endif
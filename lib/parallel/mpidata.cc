@@ -49,14 +49,23 @@
  *          The short constructor of mpidata class merely resizes the array of MPI_Status and MPI_Request datatypes.
  *          The former is used in non-blocking communication of MPI_Irecv, while the later is used in the MPI_Waitall
  *          function to complete the non-blocking communication call.
+ *          If the communication profiler is enabled, the counter under which the halo exchanges are recorded is also fetched.
  *
  * \param   inputArray is the blitz array whose sub-arrays have to be created and synchronised across processors
  * \param   parallelData is a const reference to the global data contained in the parallel class
+ * \param   siteName is the name under which the halo exchanges of the array are recorded by the communication profiler
  ********************************************************************************************************************************************
  */
-mpidata::mpidata(blitz::Array<real, 3> inputArray, const parallel &parallelData): dataField(inputArray), rankData(parallelData) {
+mpidata::mpidata(blitz::Array<real, 3> inputArray, const parallel &parallelData, const std::string siteName): dataField(inputArray), rankData(parallelData) {
     recvStatus.resize(4);
     recvRequest.resize(4);
+
+    syncTicket = -1;
+
+    syncBytes = 0.0;
+    syncTime = 0.0;
+
+    profSite = rankData.registerSite(siteName);
 }
 
 /**
@@ -72,7 +81,7 @@ mpidata::mpidata(blitz::Array<real, 3> inputArray, const parallel &parallelData)
  *          within itself, and a reverse include will raise cyclic dependency error.
  *          As a result, the mpidata class offers an additional layer over the parallel class for grid specific data transfer functions.
  *
- * \param   globSize stores the global size of a sub-domain - including core and pads
+ * \param   globSize stores the global size of a sub-domain - including core and pads, and any extra points in the storage of the array
  * \param   coreSize stores the size of the core of the sub-domain and is similar to the collocCoreSize variable in the grid class
  * \param   padWidth contains the widths of pads along the 3 directions, namely padWidths TinyVector from the grid class
  ********************************************************************************************************************************************
@@ -196,6 +205,12 @@ void mpidata::createSubarrays(const blitz::TinyVector<int, 3> globSize,
     saStarts = coreSize + padWidth; saStarts(2) = padWidth(2);
     MPI_Type_create_subarray(3, globCopy.data(), loclSize.data(), saStarts.data(), MPI_ORDER_C, MPI_FP_REAL, &recvSubarrayX1Y1);
     MPI_Type_commit(&recvSubarrayX1Y1);
+
+    // BYTES SENT IN EACH HALO EXCHANGE, AS RECORDED BY THE COMMUNICATION PROFILER
+    syncBytes = commprof::msgBytes(sendSubarrayX0, rankData.faceRanks(0)) + commprof::msgBytes(sendSubarrayX1, rankData.faceRanks(1)) +
+                commprof::msgBytes(sendSubarrayY0, rankData.faceRanks(2)) + commprof::msgBytes(sendSubarrayY1, rankData.faceRanks(3)) +
+                commprof::msgBytes(sendSubarrayX0Y0, rankData.edgeRanks(0)) + commprof::msgBytes(sendSubarrayX0Y1, rankData.edgeRanks(1)) +
+                commprof::msgBytes(sendSubarrayX1Y0, rankData.edgeRanks(2)) + commprof::msgBytes(sendSubarrayX1Y1, rankData.edgeRanks(3));
 }
 
 /**
@@ -213,7 +228,7 @@ void mpidata::createSubarrays(const blitz::TinyVector<int, 3> globSize,
  *          The receives are non-blocking, while the sends are blocking. This combination prevents inter-processor deadlock.
  ********************************************************************************************************************************************
  */
-void mpidata::syncData() {
+void mpidata::exchangeData() {
     recvRequest = MPI_REQUEST_NULL;
 
     // FIRST PERFORM DATA TRANSFER ACROSS THE FOUR FACES
@@ -242,3 +257,61 @@ void mpidata::syncData() {
 
     MPI_Waitall(4, recvRequest.dataFirst(), recvStatus.dataFirst());
 }
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to synchronise the data across all sub-domain faces and edges
+ *
+ *          The halo exchange is performed by the progress thread if it is used, and directly by the calling thread otherwise.
+ *          In either case, the pads of the array are updated when the function returns.
+ ********************************************************************************************************************************************
+ */
+void mpidata::syncData() {
+    syncStart();
+    syncFinish();
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to start the synchronisation of data across all sub-domain faces and edges
+ *
+ *          When the progress thread is used, the halo exchange is posted to it and the function returns immediately.
+ *          The caller may then perform computations which neither modify the core nor read the pads of the array,
+ *          before calling \ref syncFinish.
+ *          Without the progress thread, the halo exchange is completed before the function returns.
+ ********************************************************************************************************************************************
+ */
+void mpidata::syncStart() {
+    double tStart = 0.0;
+
+    if (profSite) tStart = MPI_Wtime();
+
+    if (rankData.progress) {
+        syncTicket = rankData.progress->post([this] { exchangeData(); });
+    } else {
+        exchangeData();
+    }
+
+    if (profSite) syncTime = MPI_Wtime() - tStart;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to wait for the synchronisation started by \ref syncStart to complete
+ *
+ *          If the communication profiler is enabled, the time spent by the calling thread in \ref syncStart and here is recorded.
+ *          Any computation performed between the two calls is not counted.
+ ********************************************************************************************************************************************
+ */
+void mpidata::syncFinish() {
+    double tStart = 0.0;
+
+    if (profSite) tStart = MPI_Wtime() - syncTime;
+
+    if (rankData.progress) rankData.progress->wait(syncTicket);
+
+    if (profSite) profSite->add(syncBytes, tStart);
+}
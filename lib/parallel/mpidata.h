@@ -92,17 +92,34 @@ class mpidata {
         /** Blitz array of the data field which needs to be synchronised across processors. */
         blitz::Array<real, 3> dataField;
 
+        /** Ticket of the halo exchange posted to the progress thread by syncStart, which syncFinish waits for */
+        long syncTicket;
+
+        /** Counter of the profiler under which the halo exchanges of the array are recorded. It is NULL when profiling is disabled */
+        commprof::counter *profSite;
+
+        /** Number of bytes sent by this rank in each halo exchange of the array */
+        double syncBytes;
+
+        /** Time spent by the calling thread in \ref syncStart for the current halo exchange */
+        double syncTime;
+
+        void exchangeData();
+
     public:
         /** A const reference to the global variables stored in the parallel class to access rank data */
         const parallel &rankData;
 
-        mpidata(blitz::Array<real, 3> inputArray, const parallel &parallelData);
+        mpidata(blitz::Array<real, 3> inputArray, const parallel &parallelData, const std::string siteName);
 
         void createSubarrays(const blitz::TinyVector<int, 3> globSize,
                              const blitz::TinyVector<int, 3> coreSize,
                              const blitz::TinyVector<int, 3> padWidth);
 
         void syncData();
+
+        void syncStart();
+        void syncFinish();
 };
 
 /**
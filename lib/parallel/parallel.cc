@@ -76,6 +76,13 @@ parallel::parallel(const parser &iDat): npX(iDat.npX), npY(iDat.npY) {
 
     // CREATE ROW AND COLUMN COMMUNICATORS *AFTER* THE xRanks AND yRanks HAVE BEEN ASSIGNED
     createComms();
+
+    // START THE PROGRESS THREAD FOR COMMUNICATION IF REQUESTED
+    startProgress(iDat);
+
+    // START RECORDING COMMUNICATION STATISTICS IF REQUESTED
+    profile = NULL;
+    if (iDat.commProf) profile = new commprof();
 }
 
 /**
@@ -143,3 +150,94 @@ inline void parallel::createComms() {
     MPI_Comm_split(MPI_COMM_WORLD, yRank, xRank, &MPI_ROW_COMM);
     MPI_Comm_split(MPI_COMM_WORLD, xRank, yRank, &MPI_COL_COMM);
 }
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to start the progress thread for communication
+ *
+ *          Since the progress thread makes MPI calls while the main thread may also make MPI calls elsewhere in the solver,
+ *          the thread is started only if MPI was initialized with support for MPI_THREAD_MULTIPLE.
+ *          Otherwise a warning is issued and all communication is performed directly by the calling thread.
+ *
+ * \param   iDat is a const reference to the global data contained in the parser class
+ ********************************************************************************************************************************************
+ */
+void parallel::startProgress(const parser &iDat) {
+    int threadLevel;
+
+    progress = NULL;
+
+    if (iDat.progThread) {
+        MPI_Query_thread(&threadLevel);
+
+        if (threadLevel == MPI_THREAD_MULTIPLE) {
+            progress = new commthread();
+        } else if (rank == 0) {
+            std::cout << "WARNING: MPI library does not support MPI_THREAD_MULTIPLE. Communication will be performed without progress thread" << std::endl;
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to register a call site with the communication profiler
+ *
+ *          The counter of the call site should be obtained once, when the calling object is set up, and passed to the
+ *          communication functions, so that no look-up of the site by its name is made on every call.
+ *
+ * \param   siteName is the name which identifies the call site in the report
+ *
+ * \return  Pointer to the counter of the call site, or NULL if profiling is disabled
+ ********************************************************************************************************************************************
+ */
+commprof::counter *parallel::registerSite(const std::string siteName) const {
+    if (profile) return profile->site(siteName);
+
+    return NULL;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to perform a global reduction of real values across all the processes
+ *
+ *          When the progress thread is used, the reduction is posted to it and the calling thread waits for its completion.
+ *          Otherwise MPI_Allreduce is called directly.
+ *          If the communication profiler is enabled, the time spent in the reduction is recorded against the call site.
+ *
+ * \param   locVal is the pointer to the local values to be reduced
+ * \param   gloVal is the pointer to the array into which the reduced values are written
+ * \param   count is the number of values to be reduced
+ * \param   op is the MPI operation used for the reduction, like MPI_MAX or MPI_SUM
+ * \param   redSite is the counter of the call site returned by \ref registerSite, under which the reduction is recorded
+ ********************************************************************************************************************************************
+ */
+void parallel::allReduce(real *locVal, real *gloVal, const int count, const MPI_Op op, commprof::counter *redSite) const {
+    double tStart = 0.0;
+
+    if (redSite) tStart = MPI_Wtime();
+
+    if (progress) {
+        progress->wait(progress->post([=] { MPI_Allreduce(locVal, gloVal, count, MPI_FP_REAL, op, MPI_COMM_WORLD); }));
+    } else {
+        MPI_Allreduce(locVal, gloVal, count, MPI_FP_REAL, op, MPI_COMM_WORLD);
+    }
+
+    if (redSite) redSite->add(count*sizeof(real), tStart);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Destructor of the parallel class
+ *
+ *          The progress thread, if used, is stopped after it completes any pending tasks.
+ *          The communication profiler, if used, is also deleted.
+ ********************************************************************************************************************************************
+ */
+parallel::~parallel() {
+    if (progress) delete progress;
+    if (profile) delete profile;
+}
@@ -46,12 +46,15 @@
 #include <mpi.h>
 
 #include "parser.h"
+#include "commthread.h"
+#include "commprof.h"
 
 class parallel {
     private:
         inline void assignRanks();
         void getNeighbours();
         void createComms();
+        void startProgress(const parser &iDat);
 
     public:
         // ALL THE INTEGERS USED BELOW ARE POSITIVE. STILL IT IS BETTER TO USE int INSTEAD OF unsigned int
@@ -83,8 +86,20 @@ class parallel {
         /** Array of ranks of the 4 neighbouring sub-domains across edges - Left-Front, Left-Back, Right-Front, Right-Back */
         blitz::Array<int, 1> edgeRanks;
 
+        /** Pointer to the progress thread which performs all the halo exchanges and reductions. It is NULL when the thread is not used */
+        commthread *progress;
+
+        /** Pointer to the profiler which records the statistics of communication at each call site. It is NULL when profiling is disabled */
+        commprof *profile;
+
         parallel(const parser &iDat);
 
+        commprof::counter *registerSite(const std::string siteName) const;
+
+        void allReduce(real *locVal, real *gloVal, const int count, const MPI_Op op, commprof::counter *redSite) const;
+
+        ~parallel();
+
 /**
  ********************************************************************************************************************************************
  * \brief   Function to calculate the positive modulus of two numbers
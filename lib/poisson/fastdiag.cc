@@ -0,0 +1,544 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file fastdiag.cc
+ *
+ *  \brief Definitions for functions of class fastdiag
+ *  \sa poisson.h
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include <limits>
+#include "poisson.h"
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Constructor of the fastdiag class derived from the poisson class
+ *
+ *          The constructor first calls the constructor of the base poisson class, which sets up the staggered grid limits
+ *          and the arrays used here as work arrays.
+ *          It then builds the 1D operators along each direction from the global grid metrics and computes their
+ *          eigen-decompositions.
+ *          This is done only once and stored for use in all subsequent calls to the solver.
+ *          Finally, the buffers needed for transposing lines of data across ranks are allocated.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   solParam is a const reference to the user-set parameters contained in the parser class
+ ********************************************************************************************************************************************
+ */
+fastdiag::fastdiag(const grid &mesh, const parser &solParam): poisson(mesh, solParam) {
+    int np, nLines, locPoints, maxPoints;
+    blitz::TinyVector<int, 3> locSize;
+
+    gloSize = mesh.globalSize;
+
+    // COMPUTE THE EIGENVALUES AND TRANSFORM MATRICES OF THE 1D OPERATORS
+    initOperator(0);
+#ifndef PLANAR
+    initOperator(1);
+#endif
+    initOperator(2);
+
+    // RESIZE THE BUFFERS USED FOR TRANSPOSING DATA
+    // THE RECEIVE BUFFER HOLDS THE FULL GLOBAL LINES ASSIGNED TO THE RANK, WHICH MAY BE ONE MORE THAN THE AVERAGE
+    locSize = stagCore(0).ubound() + 1;
+    locPoints = locSize(0)*locSize(1)*locSize(2);
+
+    maxPoints = locPoints;
+    for (int dim=0; dim<3; dim++) {
+        np = (dim == 0)? mesh.rankData.npX: (dim == 1)? mesh.rankData.npY: 1;
+        nLines = locPoints/locSize(dim);
+
+        maxPoints = std::max(maxPoints, (nLines/np + 1)*gloSize(dim));
+    }
+
+    sendBuf.resize(locPoints);
+    recvBuf.resize(maxPoints);
+
+    sendBuf = 0.0;
+    recvBuf = 0.0;
+
+    meanSite = mesh.rankData.registerSite("Reduce fastdiag::mgSolve");
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to solve the Poisson equation directly by fast diagonalisation
+ *
+ *          The function overrides the multi-grid solver of the base class, so that the time-stepping classes can use either
+ *          solver through a pointer to poisson.
+ *          The RHS is transformed to the eigen-space of the 1D operators along each direction, divided point-wise by
+ *          the sum of eigenvalues, and transformed back.
+ *          The mode corresponding to a constant pressure, for which the sum of eigenvalues is zero, is discarded.
+ *          Finally, the global mean is subtracted from the solution as done in the multi-grid solver.
+ *
+ * \param   outLHS is a pointer to the plain scalar field (cell-centered) into which the computed soltuion must be transferred
+ * \param   inpRHS is a const reference to the plain scalar field (cell-centered) which contains the RHS for the Poisson equation to solve
+ ********************************************************************************************************************************************
+ */
+void fastdiag::mgSolve(plainsf &outLHS, const plainsf &inpRHS) {
+    int xSt, ySt;
+    real eigSum;
+
+    vLevel = 0;
+
+    xSt = mesh.subarrayStarts(0);
+    ySt = mesh.subarrayStarts(1);
+
+    // THE lhs ARRAY OF THE FINEST LEVEL IS USED AS THE WORK ARRAY
+    lhs(0) = 0.0;
+    lhs(0)(stagCore(0)) = inpRHS.F(stagCore(0));
+
+    if (fluxCorrect) correctMassFlux(lhs(0));
+
+    // FORWARD TRANSFORMS ALONG EACH DIRECTION
+    transform(lhs(0), 0, xFwd);
+#ifndef PLANAR
+    transform(lhs(0), 1, yFwd);
+#endif
+    transform(lhs(0), 2, zFwd);
+
+    // DIVIDE BY THE EIGENVALUES OF THE LAPLACIAN
+#pragma omp parallel for num_threads(inputParams.nThreads) private(eigSum)
+    for (int i = 0; i <= xEnd(0); ++i) {
+#ifdef PLANAR
+        int j = 0;
+#else
+        for (int j = 0; j <= yEnd(0); ++j) {
+#endif
+            for (int k = 0; k <= zEnd(0); ++k) {
+#ifdef PLANAR
+                eigSum = xEig(i + xSt) + zEig(k);
+#else
+                eigSum = xEig(i + xSt) + yEig(j + ySt) + zEig(k);
+#endif
+                lhs(0)(i, j, k) = (eigSum == 0.0)? 0.0: lhs(0)(i, j, k)/eigSum;
+            }
+#ifndef PLANAR
+        }
+#endif
+    }
+
+    // BACKWARD TRANSFORMS ALONG EACH DIRECTION
+    transform(lhs(0), 2, zBwd);
+#ifndef PLANAR
+    transform(lhs(0), 1, yBwd);
+#endif
+    transform(lhs(0), 0, xBwd);
+
+    // WHEN USING NEUMANN BC ON ALL SIDES, SUBTRACT THE MEAN OF THE SOLUTION AS IN THE MULTI-GRID SOLVER
+    real localMean = blitz::sum(lhs(0)(stagCore(0)))/mesh.totalPoints;
+    real globalAvg = 0.0;
+
+    mesh.rankData.allReduce(&localMean, &globalAvg, 1, MPI_SUM, meanSite);
+
+    lhs(0)(stagCore(0)) -= globalAvg;
+
+    // THE GHOST POINTS AT WALLS ARE SET HERE. THE PADS BETWEEN SUB-DOMAINS ARE UPDATED BY THE CALLING FUNCTION
+    imposeBC();
+
+    // RETURN CALCULATED PRESSURE DATA
+    outLHS.F(stagFull(0)) = lhs(0)(stagFull(0));
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the eigen-decomposition of the 1D operator along a given direction
+ *
+ *          The 1D operator is the same tridiagonal second derivative on the stretched grid as used by the multi-grid solver,
+ *          with Neumann BC applied at both ends.
+ *          This matrix is not symmetric on a non-uniform grid, but it is similar to a symmetric matrix through a diagonal
+ *          scaling D, as long as the products of its off-diagonal entries are positive.
+ *          The symmetric matrix is diagonalized as \f$ Q \Lambda Q^T \f$, so that the operator is \f$ S \Lambda S^{-1} \f$
+ *          with \f$ S = D^{-1} Q \f$ and \f$ S^{-1} = Q^T D \f$.
+ *          Along periodic directions, the grid must be uniform, and the operator is then a circulant matrix.
+ *          Its eigenvectors are the discrete cosine and sine waves, which are used as the columns of Q with D as identity.
+ *
+ * \param   dim is the direction along which the operator is computed (x -> 0, y -> 1, z -> 2)
+ ********************************************************************************************************************************************
+ */
+void fastdiag::initOperator(const int dim) {
+    int n, ls, nullIndex;
+    real ih2, i2h;
+
+    blitz::Array<real, 1> subDiag, supDiag, dVec, eVec, dScale;
+    blitz::Array<real, 2> qMat;
+
+    n = gloSize(dim);
+
+    // INDEX OF THE SECOND DERIVATIVE TERM OF THE TRANSFORM IN THE GLOBAL METRICS AT THE FINEST LEVEL
+    ls = 5*dim + 3;
+
+    switch (dim) {
+        case 0: ih2 = ihx2(0);
+                i2h = i2hx(0);
+            break;
+        case 1: ih2 = ihy2(0);
+                i2h = i2hy(0);
+            break;
+        default: ih2 = ihz2(0);
+                 i2h = i2hz(0);
+    }
+
+    subDiag.resize(n);
+    supDiag.resize(n);
+    dVec.resize(n);
+    eVec.resize(n);
+    dScale.resize(n);
+    qMat.resize(n, n);
+
+    for (int i=0; i<n; i++) {
+        subDiag(i) = mesh.globalMetrics(ls + 1)(i)*ih2 - mesh.globalMetrics(ls)(i)*i2h;
+        supDiag(i) = mesh.globalMetrics(ls + 1)(i)*ih2 + mesh.globalMetrics(ls)(i)*i2h;
+        dVec(i) = -2.0*mesh.globalMetrics(ls + 1)(i)*ih2;
+    }
+
+    if ((dim == 0 and inputParams.xPer) or (dim == 1 and inputParams.yPer) or (dim == 2 and inputParams.zPer)) {
+        // THE CIRCULANT OPERATOR OF A UNIFORM PERIODIC GRID HAS THE SAME COEFFICIENTS AT ALL POINTS
+        for (int i=0; i<n; i++) {
+            if ((fabs(subDiag(i) - subDiag(0)) > 1.0e-10*fabs(subDiag(0))) or (fabs(supDiag(i) - subDiag(0)) > 1.0e-10*fabs(subDiag(0)))) {
+                if (mesh.rankData.rank == 0) std::cout << "ERROR: The direct Poisson solver needs a uniform grid along periodic directions. Aborting" << std::endl;
+                MPI_Finalize();
+                exit(0);
+            }
+        }
+
+        dScale = 1.0;
+
+        // THE CONSTANT VECTOR IS THE NULL SPACE OF THE OPERATOR, AND ITS EIGENVALUE IS EXACTLY ZERO
+        qMat(blitz::Range::all(), 0) = 1.0/sqrt(real(n));
+        dVec(0) = 0.0;
+
+        // EACH WAVENUMBER m HAS A COSINE AND A SINE EIGENVECTOR, WITH EIGENVALUE -4 c sin^2(pi m/n) FOR OFF-DIAGONAL ENTRIES c
+        for (int m=1; 2*m<n; m++) {
+            for (int i=0; i<n; i++) {
+                qMat(i, 2*m - 1) = sqrt(2.0/n)*cos(2.0*M_PI*m*i/n);
+                qMat(i, 2*m) = sqrt(2.0/n)*sin(2.0*M_PI*m*i/n);
+            }
+            dVec(2*m - 1) = dVec(2*m) = -4.0*subDiag(0)*pow(sin(M_PI*m/n), 2.0);
+        }
+
+        // FOR EVEN n, THE HIGHEST WAVENUMBER HAS ONLY THE ALTERNATING EIGENVECTOR
+        if (n % 2 == 0) {
+            for (int i=0; i<n; i++) qMat(i, n - 1) = ((i % 2)? -1.0: 1.0)/sqrt(real(n));
+            dVec(n - 1) = -4.0*subDiag(0);
+        }
+    } else {
+        // NEUMANN BC AT BOTH ENDS - THE GHOST POINT IS EQUAL TO THE ADJACENT POINT IN THE CORE
+        dVec(0) += subDiag(0);
+        dVec(n - 1) += supDiag(n - 1);
+
+        // SYMMETRIZE THE OPERATOR BY DIAGONAL SCALING
+        dScale(0) = 1.0;
+        eVec = 0.0;
+        for (int i=0; i<n-1; i++) {
+            if (supDiag(i)*subDiag(i + 1) <= 0.0) {
+                if (mesh.rankData.rank == 0) std::cout << "ERROR: The grid is too strongly stretched to use the direct Poisson solver. Aborting" << std::endl;
+                MPI_Finalize();
+                exit(0);
+            }
+
+            dScale(i + 1) = dScale(i)*sqrt(supDiag(i)/subDiag(i + 1));
+            eVec(i) = sqrt(supDiag(i)*subDiag(i + 1));
+        }
+
+        qMat = 0.0;
+        for (int i=0; i<n; i++) qMat(i, i) = 1.0;
+
+        eigenSolve(dVec, eVec, qMat);
+
+        // THE OPERATOR WITH NEUMANN BC HAS A NULL SPACE OF CONSTANT VECTORS. ITS EIGENVALUE IS THE LARGEST AND IS SET TO EXACTLY ZERO
+        nullIndex = blitz::maxIndex(dVec)(0);
+        dVec(nullIndex) = 0.0;
+    }
+
+    blitz::Array<real, 2> fwdMat(n, n), bwdMat(n, n);
+    for (int p=0; p<n; p++) {
+        for (int q=0; q<n; q++) {
+            fwdMat(p, q) = qMat(q, p)*dScale(q);
+            bwdMat(p, q) = qMat(p, q)/dScale(p);
+        }
+    }
+
+    switch (dim) {
+        case 0: xEig.reference(dVec);
+                xFwd.reference(fwdMat);
+                xBwd.reference(bwdMat);
+            break;
+        case 1: yEig.reference(dVec);
+                yFwd.reference(fwdMat);
+                yBwd.reference(bwdMat);
+            break;
+        default: zEig.reference(dVec);
+                 zFwd.reference(fwdMat);
+                 zBwd.reference(bwdMat);
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the eigenvalues and eigenvectors of a symmetric tridiagonal matrix
+ *
+ *          The implicit QL algorithm with Wilkinson shifts is used.
+ *          On return, the diagonal holds the eigenvalues and the columns of the matrix hold the corresponding
+ *          orthonormal eigenvectors.
+ *
+ * \param   dVec is the diagonal of the matrix, which is overwritten by the eigenvalues
+ * \param   eVec is the off-diagonal of the matrix, with element i coupling rows i and i + 1. It is destroyed in the process
+ * \param   qMat is the matrix which must be initialized to identity, and is overwritten by the eigenvectors
+ ********************************************************************************************************************************************
+ */
+void fastdiag::eigenSolve(blitz::Array<real, 1> &dVec, blitz::Array<real, 1> &eVec, blitz::Array<real, 2> &qMat) {
+    int i, m, iterCount;
+    int n = dVec.size();
+    real b, c, f, g, p, r, s, dd;
+
+    for (int l=0; l<n; l++) {
+        iterCount = 0;
+        do {
+            // LOOK FOR A SMALL OFF-DIAGONAL ELEMENT TO SPLIT THE MATRIX
+            for (m=l; m<n-1; m++) {
+                dd = fabs(dVec(m)) + fabs(dVec(m + 1));
+                if (fabs(eVec(m)) <= std::numeric_limits<real>::epsilon()*dd) break;
+            }
+
+            if (m != l) {
+                if (iterCount++ == 60) {
+                    if (mesh.rankData.rank == 0) std::cout << "ERROR: Eigenvalues of the operator for direct Poisson solver did not converge. Aborting" << std::endl;
+                    MPI_Finalize();
+                    exit(0);
+                }
+
+                // SHIFT
+                g = (dVec(l + 1) - dVec(l))/(2.0*eVec(l));
+                r = hypot(g, 1.0);
+                g = dVec(m) - dVec(l) + eVec(l)/(g + copysign(r, g));
+
+                s = c = 1.0;
+                p = 0.0;
+
+                // PLANE ROTATIONS TO RESTORE THE TRIDIAGONAL FORM
+                for (i=m-1; i>=l; i--) {
+                    f = s*eVec(i);
+                    b = c*eVec(i);
+                    r = hypot(f, g);
+                    eVec(i + 1) = r;
+
+                    if (r == 0.0) {
+                        dVec(i + 1) -= p;
+                        eVec(m) = 0.0;
+                        break;
+                    }
+
+                    s = f/r;
+                    c = g/r;
+                    g = dVec(i + 1) - p;
+                    r = (dVec(i) - g)*s + 2.0*c*b;
+                    p = s*r;
+                    dVec(i + 1) = g + p;
+                    g = c*r - b;
+
+                    // ACCUMULATE THE ROTATIONS INTO THE EIGENVECTORS
+                    for (int k=0; k<n; k++) {
+                        f = qMat(k, i + 1);
+                        qMat(k, i + 1) = s*qMat(k, i) + c*f;
+                        qMat(k, i) = c*qMat(k, i) - s*f;
+                    }
+                }
+
+                if (r == 0.0 and i >= l) continue;
+
+                dVec(l) -= p;
+                eVec(l) = g;
+                eVec(m) = 0.0;
+            }
+        } while (m != l);
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to apply a dense transform matrix to all the lines of data along a given direction
+ *
+ *          Since the sub-domain of a rank holds only a part of each line along x and y, the lines are first transposed across the
+ *          ranks of the row (for x) or column (for y) communicator, such that each rank receives a subset of full global lines.
+ *          The transform is applied to these lines, after which they are transposed back to the original decomposition.
+ *          No communication is needed along z, or when there is only one rank along the direction.
+ *
+ * \param   data is the blitz array whose core is transformed in place
+ * \param   dim is the direction along which the transform is applied (x -> 0, y -> 1, z -> 2)
+ * \param   tMat is the transform matrix of size equal to the global number of points along dim
+ ********************************************************************************************************************************************
+ */
+void fastdiag::transform(blitz::Array<real, 3> &data, const int dim, const blitz::Array<real, 2> &tMat) {
+    int np, myRank, myLines;
+    int nl, ng, nLines, index;
+
+    MPI_Comm lineComm;
+
+    switch (dim) {
+        case 0: np = mesh.rankData.npX;
+                myRank = mesh.rankData.xRank;
+                lineComm = mesh.rankData.MPI_ROW_COMM;
+            break;
+        case 1: np = mesh.rankData.npY;
+                myRank = mesh.rankData.yRank;
+                lineComm = mesh.rankData.MPI_COL_COMM;
+            break;
+        default: np = 1;
+                 myRank = 0;
+                 lineComm = MPI_COMM_SELF;
+    }
+
+    nl = stagCore(0).ubound(dim) + 1;
+    ng = gloSize(dim);
+    nLines = (stagCore(0).ubound(0) + 1)*(stagCore(0).ubound(1) + 1)*(stagCore(0).ubound(2) + 1)/nl;
+
+    // DIVIDE THE LOCAL LINES AS EVENLY AS POSSIBLE AMONG THE RANKS ALONG THE DIRECTION
+    blitz::Array<int, 1> lineStart(np + 1);
+    blitz::Array<int, 1> sendCount(np), sendDispl(np);
+    blitz::Array<int, 1> recvCount(np), recvDispl(np);
+
+    for (int r=0; r<=np; r++) lineStart(r) = (r*nLines)/np;
+    myLines = lineStart(myRank + 1) - lineStart(myRank);
+
+    for (int r=0; r<np; r++) {
+        sendCount(r) = (lineStart(r + 1) - lineStart(r))*nl;
+        sendDispl(r) = lineStart(r)*nl;
+        recvCount(r) = myLines*nl;
+        recvDispl(r) = r*myLines*nl;
+    }
+
+    // PACK THE LINES - THE LINES TO BE SENT TO EACH RANK ARE ALREADY CONTIGUOUS IN THIS ORDERING
+    index = 0;
+    for (int l=0; l<nLines; l++) {
+        for (int p=0; p<nl; p++) {
+            sendBuf(index++) = data(lineIndex(dim, l, p));
+        }
+    }
+
+    if (np > 1) {
+        MPI_Alltoallv(sendBuf.dataFirst(), sendCount.dataFirst(), sendDispl.dataFirst(), MPI_FP_REAL,
+                      recvBuf.dataFirst(), recvCount.dataFirst(), recvDispl.dataFirst(), MPI_FP_REAL, lineComm);
+    } else {
+        recvBuf(blitz::Range(0, nLines*nl - 1)) = sendBuf(blitz::Range(0, nLines*nl - 1));
+    }
+
+    // APPLY THE TRANSFORM ON THE FULL LINES. THE PIECE OF A LINE RECEIVED FROM RANK s STARTS AT GLOBAL INDEX s*nl
+    // EACH THREAD ALLOCATES ITS LINE BUFFER ONCE, BEFORE THE LINES ARE DIVIDED AMONG THE THREADS
+#pragma omp parallel num_threads(inputParams.nThreads)
+    {
+        blitz::Array<real, 1> lineData(ng);
+
+#pragma omp for
+        for (int l=0; l<myLines; l++) {
+            for (int s=0; s<np; s++) {
+                for (int p=0; p<nl; p++) {
+                    lineData(s*nl + p) = recvBuf(s*myLines*nl + l*nl + p);
+                }
+            }
+
+            for (int s=0; s<np; s++) {
+                for (int p=0; p<nl; p++) {
+                    real tSum = 0.0;
+                    for (int q=0; q<ng; q++) tSum += tMat(s*nl + p, q)*lineData(q);
+
+                    recvBuf(s*myLines*nl + l*nl + p) = tSum;
+                }
+            }
+        }
+    }
+
+    if (np > 1) {
+        MPI_Alltoallv(recvBuf.dataFirst(), recvCount.dataFirst(), recvDispl.dataFirst(), MPI_FP_REAL,
+                      sendBuf.dataFirst(), sendCount.dataFirst(), sendDispl.dataFirst(), MPI_FP_REAL, lineComm);
+    } else {
+        sendBuf(blitz::Range(0, nLines*nl - 1)) = recvBuf(blitz::Range(0, nLines*nl - 1));
+    }
+
+    // UNPACK THE TRANSFORMED LINES
+    index = 0;
+    for (int l=0; l<nLines; l++) {
+        for (int p=0; p<nl; p++) {
+            data(lineIndex(dim, l, p)) = sendBuf(index++);
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to impose the boundary conditions at the walls on the computed solution
+ *
+ *          The ghost points of the finest level at the walls of non-periodic directions are set equal to the adjacent points
+ *          in the core for the Neumann BC.
+ *          Along periodic x and y directions, the ghost points are updated along with the pads between sub-domains by the
+ *          calling function, while along a periodic z direction, they are copied from the opposite end of the core.
+ *
+ ********************************************************************************************************************************************
+ */
+void fastdiag::imposeBC() {
+    if (not inputParams.xPer) {
+        // NEUMANN BOUNDARY CONDITION AT LEFT AND RIGHT WALLS
+        if (xfr) lhs(0)(-1, all, all) = lhs(0)(0, all, all);
+
+        if (xlr) lhs(0)(stagCore(0).ubound(0) + 1, all, all) = lhs(0)(stagCore(0).ubound(0), all, all);
+    }
+
+#ifndef PLANAR
+    if (not inputParams.yPer) {
+        // NEUMANN BOUNDARY CONDITION AT FRONT AND BACK WALLS
+        if (yfr) lhs(0)(all, -1, all) = lhs(0)(all, 0, all);
+
+        if (ylr) lhs(0)(all, stagCore(0).ubound(1) + 1, all) = lhs(0)(all, stagCore(0).ubound(1), all);
+    }
+#endif
+
+    if (inputParams.zPer) {
+        // PERIODIC BOUNDARY CONDITION AT BOTTOM AND TOP WALLS
+        lhs(0)(all, all, -1) = lhs(0)(all, all, stagCore(0).ubound(2));
+
+        lhs(0)(all, all, stagCore(0).ubound(2) + 1) = lhs(0)(all, all, 0);
+    } else {
+        // NEUMANN BOUNDARY CONDITION AT BOTTOM AND TOP WALLS
+        lhs(0)(all, all, -1) = lhs(0)(all, all, 0);
+
+        lhs(0)(all, all, stagCore(0).ubound(2) + 1) = lhs(0)(all, all, stagCore(0).ubound(2));
+    }
+}
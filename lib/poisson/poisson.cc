@@ -97,6 +97,18 @@ poisson::poisson(const grid &mesh, const parser &solParam): mesh(mesh), inputPar
     // SINCE ALL THE BOUNDARIES ARE ASSUMED TO HAVE NEUMANN BC WHEN 
     // SOLVING THE PRESSURE CORRECTION EQUATION.
     allNeumann = true;
+
+    // THE GUESSED VELOCITY NEED NOT CONSERVE MASS GLOBALLY WHEN THE OUTFLOW IS CONVECTED OUT OF THE DOMAIN
+    fluxCorrect = (inputParams.probType == 3) and (inputParams.outflowBC == 1);
+
+    // PADS ARE EXCHANGED AT FULL PRECISION UNLESS SET OTHERWISE BY THE SMOOTHER
+    floatExchange = false;
+
+    // REGISTER THE GLOBAL REDUCTIONS WITH THE COMMUNICATION PROFILER. THOSE OF THE DERIVED SOLVERS ARE REGISTERED BY THEM
+    mgSolveSite = mesh.rankData.registerSite("Reduce poisson::mgSolve");
+    fluxSite = mesh.rankData.registerSite("Reduce poisson::correctMassFlux");
+
+    solveSite = errorSite = NULL;
 }
 
 
@@ -127,6 +139,8 @@ void poisson::mgSolve(plainsf &outLHS, const plainsf &inpRHS) {
     rhs(0)(stagCore(0)) = inpRHS.F(stagCore(0));
     lhs(0)(stagCore(0)) = outLHS.F(stagCore(0));
 
+    if (fluxCorrect) correctMassFlux(rhs(0));
+
     updatePads(rhs);
     updatePads(lhs);
 
@@ -174,7 +188,7 @@ void poisson::mgSolve(plainsf &outLHS, const plainsf &inpRHS) {
 
         real gloMax = 0.0;
         real locMax = blitz::max(fabs(tempArray));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, mgSolveSite);
 
         if (mesh.rankData.rank == 0) {
             std::cout << std::endl;
@@ -201,7 +215,7 @@ void poisson::mgSolve(plainsf &outLHS, const plainsf &inpRHS) {
         real localMean = blitz::sum(lhs(0)(stagCore(0)))/mesh.totalPoints;
         real globalAvg = 0.0;
 
-        MPI_Allreduce(&localMean, &globalAvg, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+        mesh.rankData.allReduce(&localMean, &globalAvg, 1, MPI_SUM, mgSolveSite);
 
         lhs(0) -= globalAvg;
     }
@@ -212,6 +226,42 @@ void poisson::mgSolve(plainsf &outLHS, const plainsf &inpRHS) {
 };
 
 
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to correct the global mass flux through the walls of the domain
+ *
+ *          With Neumann BC on all the walls, the Poisson equation has a solution only if the volume integral of its
+ *          RHS vanishes, i.e., if the net flux of the guessed velocity through the walls is zero.
+ *          The convective outflow BC does not ensure that the flux through the outflow balances the inflow exactly.
+ *          The volume average of the RHS, which is the net flux imbalance divided by the volume of the domain, is hence
+ *          subtracted from the RHS.
+ *          This is equivalent to a uniform correction of the outflow velocity which restores global mass conservation.
+ *
+ * \param   data is a reference to the blitz array at the finest level which contains the RHS of the Poisson equation
+ ********************************************************************************************************************************************
+ */
+void poisson::correctMassFlux(blitz::Array<real, 3> &data) {
+    real cellVol;
+    real locSum[2], gloSum[2];
+
+    locSum[0] = locSum[1] = 0.0;
+    for (int i = 0; i <= xEnd(0); ++i) {
+        for (int j = 0; j <= yEnd(0); ++j) {
+            for (int k = 0; k <= zEnd(0); ++k) {
+                cellVol = 1.0/(mesh.xi_x(i)*mesh.et_y(j)*mesh.zt_z(k));
+
+                locSum[0] += data(i, j, k)*cellVol;
+                locSum[1] += cellVol;
+            }
+        }
+    }
+
+    mesh.rankData.allReduce(locSum, gloSum, 2, MPI_SUM, fluxSite);
+
+    data(stagCore(0)) -= gloSum[0]/gloSum[1];
+};
+
+
 /**
  ********************************************************************************************************************************************
  * \brief   Function to perform one loop of V-cycle
@@ -297,6 +347,7 @@ void poisson::vCycle() {
  *
  *          The memory required for various arrays in multi-grid solver are pre-allocated through this function.
  *          The function is called from within the constructor to perform this allocation once and for all.
+ *          The storage of the arrays includes the extra points set in the grid class to avoid cache conflicts.
  *          The arrays are initialized to 0.
  *
  ********************************************************************************************************************************************
@@ -308,20 +359,16 @@ void poisson::initializeArrays() {
     smd.resize(inputParams.vcDepth + 1);
 
     for (int i=0; i <= inputParams.vcDepth; i++) {
-        lhs(i).resize(blitz::TinyVector<int, 3>(stagFull(i).ubound() - stagFull(i).lbound() + 1));
-        lhs(i).reindexSelf(stagFull(i).lbound());
+        grid::allocPadded(lhs(i), stagFull(i).ubound() - stagFull(i).lbound() + 1, stagFull(i).lbound(), mesh.allocPads);
         lhs(i) = 0.0;
 
-        tmp(i).resize(blitz::TinyVector<int, 3>(stagFull(i).ubound() - stagFull(i).lbound() + 1));
-        tmp(i).reindexSelf(stagFull(i).lbound());
+        grid::allocPadded(tmp(i), stagFull(i).ubound() - stagFull(i).lbound() + 1, stagFull(i).lbound(), mesh.allocPads);
         tmp(i) = 0.0;
 
-        rhs(i).resize(blitz::TinyVector<int, 3>(stagFull(i).ubound() - stagFull(i).lbound() + 1));
-        rhs(i).reindexSelf(stagFull(i).lbound());
+        grid::allocPadded(rhs(i), stagFull(i).ubound() - stagFull(i).lbound() + 1, stagFull(i).lbound(), mesh.allocPads);
         rhs(i) = 0.0;
 
-        smd(i).resize(blitz::TinyVector<int, 3>(stagFull(i).ubound() - stagFull(i).lbound() + 1));
-        smd(i).reindexSelf(stagFull(i).lbound());
+        grid::allocPadded(smd(i), stagFull(i).ubound() - stagFull(i).lbound() + 1, stagFull(i).lbound(), mesh.allocPads);
         smd(i) = 0.0;
     }
 }
@@ -596,6 +643,8 @@ real poisson::computeError(const int normOrder) {  return 0.0; };
  *          This function is called mainly during smoothing operations to impose the boundary conditions for the
  *          Poisson equation.
  *          The sub-domains close to the wall will have the Neumann boundary condition on pressure imposeed at the walls.
+ *          The Neumann condition is also the mirror condition on pressure at planes of symmetry set in the YAML file, so that
+ *          the same operator is used at walls and at planes of symmetry.
  *          Meanwhile at the interior boundaries at the inter-processor sub-domains, data is transferred from the neighbouring cells
  *          by calling the \ref updatePads function.
  *
@@ -617,6 +666,123 @@ void poisson::imposeBC() { };
 void poisson::updatePads(blitz::Array<blitz::Array<real, 3>, 1> &data) { };
 
 
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to add a face or edge of the sub-domain to the list of regions exchanged in single precision
+ *
+ *          Regions shared with MPI_PROC_NULL are not added, as they have no data to be exchanged.
+ *          The send and receive buffers are resized to hold all the regions of the level.
+ *
+ * \param   n is the V-cycle level to which the region belongs
+ * \param   sendStart is the index of the first point of the region sent to the neighbour
+ * \param   recvStart is the index of the first point of the region received from the neighbour
+ * \param   shape is the number of points of the region along each direction
+ * \param   nRank is the rank of the neighbouring sub-domain
+ * \param   sendTag is the tag of the message sent to the neighbour
+ * \param   recvTag is the tag of the message received from the neighbour
+ ********************************************************************************************************************************************
+ */
+void poisson::addPadLink(const int n, const blitz::TinyVector<int, 3> sendStart, const blitz::TinyVector<int, 3> recvStart,
+                         const blitz::TinyVector<int, 3> shape, const int nRank, const int sendTag, const int recvTag) {
+    padLink link;
+    size_t totalCount;
+
+    if (nRank == MPI_PROC_NULL) return;
+
+    link.sendStart = sendStart;
+    link.recvStart = recvStart;
+    link.shape = shape;
+    link.nRank = nRank;
+    link.sendTag = sendTag;
+    link.recvTag = recvTag;
+
+    padLinks[n].push_back(link);
+
+    totalCount = 0;
+    for (size_t l=0; l<padLinks[n].size(); l++) totalCount += blitz::product(padLinks[n][l].shape);
+
+    if (totalCount > sendFloats.size()) {
+        sendFloats.resize(totalCount);
+        recvFloats.resize(totalCount);
+    }
+    if (padLinks[n].size() > floatRequests.size()) floatRequests.resize(padLinks[n].size());
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to update the pad points of the local sub-domains in single precision
+ *
+ *          During the smoothing iterations at the coarser levels of the V-cycle, the pads need to be only approximately right.
+ *          The faces and edges listed in \ref padLinks are hence packed into buffers of float, which halves the
+ *          volume of data exchanged when real is double.
+ *          All the regions are exchanged together, and the received data is unpacked in the order in which the regions
+ *          were added, so that the edges overwrite the corners of the faces, as in the full precision exchange.
+ *
+ * \param   data is the array of blitz arrays at all V-cycle levels whose pads at the current level are to be updated
+ ********************************************************************************************************************************************
+ */
+void poisson::updatePadsFloat(blitz::Array<blitz::Array<real, 3>, 1> &data) {
+    int offset;
+    double tStart = 0.0;
+
+    const std::vector<padLink> &links = padLinks[vLevel];
+    const int nLinks = links.size();
+
+    const aview<real, 3> D(data(vLevel));
+
+    if (padSites[vLevel]) tStart = MPI_Wtime();
+
+    offset = 0;
+    for (int l=0; l<nLinks; l++) {
+        const padLink &p = links[l];
+        const int count = blitz::product(p.shape);
+
+        MPI_Irecv(&recvFloats[offset], count, MPI_FLOAT, p.nRank, p.recvTag, MPI_COMM_WORLD, &floatRequests[l]);
+
+        float *sendBuf = &sendFloats[offset];
+        for (int i = 0; i < p.shape(0); ++i) {
+            for (int j = 0; j < p.shape(1); ++j) {
+                for (int k = 0; k < p.shape(2); ++k) {
+                    *sendBuf++ = float(D(p.sendStart(0) + i, p.sendStart(1) + j, p.sendStart(2) + k));
+                }
+            }
+        }
+
+        offset += count;
+    }
+
+    offset = 0;
+    for (int l=0; l<nLinks; l++) {
+        const int count = blitz::product(links[l].shape);
+
+        MPI_Send(&sendFloats[offset], count, MPI_FLOAT, links[l].nRank, links[l].sendTag, MPI_COMM_WORLD);
+
+        offset += count;
+    }
+
+    MPI_Waitall(nLinks, floatRequests.data(), MPI_STATUSES_IGNORE);
+
+    offset = 0;
+    for (int l=0; l<nLinks; l++) {
+        const padLink &p = links[l];
+
+        const float *recvBuf = &recvFloats[offset];
+        for (int i = 0; i < p.shape(0); ++i) {
+            for (int j = 0; j < p.shape(1); ++j) {
+                for (int k = 0; k < p.shape(2); ++k) {
+                    D(p.recvStart(0) + i, p.recvStart(1) + j, p.recvStart(2) + k) = *recvBuf++;
+                }
+            }
+        }
+
+        offset += blitz::product(p.shape);
+    }
+
+    if (padSites[vLevel]) padSites[vLevel]->add(offset*sizeof(float), tStart);
+}
+
+
 /**
  ********************************************************************************************************************************************
  * \brief   Function to create the MPI sub-array data types necessary to transfer data across sub-domains
@@ -47,6 +47,9 @@
 #include <algorithm>
 
 #include "plainsf.h"
+#include "brick.h"
+#include "subblock.h"
+#include "aview.h"
 #include "grid.h"
 
 class poisson {
@@ -62,6 +65,10 @@ class poisson {
         // USING THIS, THE SOLVER IMPOSES COMPATIBILITY CONDITION. 
         bool allNeumann;
 
+        // THIS FLAG IS true WHEN THE VELOCITY HAS A CONVECTIVE OUTFLOW BC.
+        // THE NET FLUX THROUGH THE WALLS IS THEN REMOVED FROM THE RHS TO KEEP THE NEUMANN PROBLEM COMPATIBLE.
+        bool fluxCorrect;
+
         const grid &mesh;
         const parser &inputParams;
 
@@ -93,6 +100,26 @@ class poisson {
         blitz::Array<MPI_Datatype, 1> yMGArray;
         blitz::Array<MPI_Datatype, 1> zMGArray;
 
+        // COUNTERS AND BYTES SENT PER CALL FOR THE PAD EXCHANGES AT EACH V-CYCLE LEVEL, AS RECORDED BY THE COMMUNICATION PROFILER
+        std::vector<commprof::counter *> padSites;
+        std::vector<double> padBytes;
+
+        // COUNTERS OF THE GLOBAL REDUCTIONS IN THE SOLVER, AS RECORDED BY THE COMMUNICATION PROFILER. THEY ARE NULL WHEN PROFILING IS DISABLED
+        commprof::counter *mgSolveSite, *fluxSite;
+        commprof::counter *solveSite, *errorSite;
+
+        // FACES AND EDGES OF THE SUB-DOMAIN EXCHANGED WITH EACH NEIGHBOUR AT EACH LEVEL, WHEN THE PADS ARE SENT IN SINGLE PRECISION
+        struct padLink {
+            blitz::TinyVector<int, 3> sendStart, recvStart, shape;
+            int nRank, sendTag, recvTag;
+        };
+        std::vector<std::vector<padLink> > padLinks;
+        std::vector<float> sendFloats, recvFloats;
+        std::vector<MPI_Request> floatRequests;
+
+        // THIS FLAG IS true DURING SMOOTHING ITERATIONS WHOSE PADS MAY BE EXCHANGED IN SINGLE PRECISION
+        bool floatExchange;
+
         blitz::Array<blitz::TinyVector<int, 3>, 1> mgSendLft, mgSendRgt;
         blitz::Array<blitz::TinyVector<int, 3>, 1> mgRecvLft, mgRecvRgt;
 
@@ -123,12 +150,17 @@ class poisson {
         virtual void createMGSubArrays();
         virtual void updatePads(blitz::Array<blitz::Array<real, 3>, 1> &data);
 
+        void addPadLink(const int n, const blitz::TinyVector<int, 3> sendStart, const blitz::TinyVector<int, 3> recvStart,
+                        const blitz::TinyVector<int, 3> shape, const int nRank, const int sendTag, const int recvTag);
+        void updatePadsFloat(blitz::Array<blitz::Array<real, 3>, 1> &data);
+        void correctMassFlux(blitz::Array<real, 3> &data);
+
         void vCycle();
 
     public:
         poisson(const grid &mesh, const parser &solParam);
 
-        void mgSolve(plainsf &outLHS, const plainsf &inpRHS);
+        virtual void mgSolve(plainsf &outLHS, const plainsf &inpRHS);
 
         virtual ~poisson();
 };
@@ -187,6 +219,9 @@ class multigrid_d3: public poisson {
         void prolong();
         void computeResidual();
         void smooth(const int smoothCount);
+        void blockedSmooth(const int iterCount);
+        void brickSmooth(const int smoothCount);
+        void subblockSmooth(const int smoothCount);
         real computeError(const int normOrder);
 
         void solve();
@@ -199,6 +234,19 @@ class multigrid_d3: public poisson {
 
         blitz::Array<real, 2> xWall, yWall, zWall;
 
+        /** Copies of lhs, tmp and rhs in brick layout at all V-cycle levels, used only when brickLayout is set */
+        std::vector<brick> lhsBrick, tmpBrick, rhsBrick;
+
+        /** Copies of lhs, tmp and rhs split into sub-blocks at all V-cycle levels, used only when sbSize is non-zero */
+        std::vector<subblock> lhsBlocks, tmpBlocks, rhsBlocks;
+
+        /** Coefficients of the Laplacian along each direction at all V-cycle levels, in the form used by brick::jacobiSweep and subblock::jacobiSweep */
+        std::vector<blitz::Array<blitz::Array<real, 1>, 1> > bCoeffM, bCoeffP, bCoeffD;
+
+        void initBricks();
+        void initSubblocks();
+        void initCoeffs();
+
     public:
         multigrid_d3(const grid &mesh, const parser &solParam);
 
@@ -215,4 +263,78 @@ class multigrid_d3: public poisson {
  ********************************************************************************************************************************************
  */
 
+class fastdiag: public poisson {
+    private:
+        /** Global number of cell-centres along each direction */
+        blitz::TinyVector<int, 3> gloSize;
+
+        /** Matrices of the forward (S^-1) and backward (S) transforms that diagonalize the 1D operators along each direction */
+        blitz::Array<real, 2> xFwd, xBwd;
+        blitz::Array<real, 2> yFwd, yBwd;
+        blitz::Array<real, 2> zFwd, zBwd;
+
+        /** Eigenvalues of the 1D operators along each direction */
+        blitz::Array<real, 1> xEig, yEig, zEig;
+
+        /** Buffers for the all-to-all transposes */
+        blitz::Array<real, 1> sendBuf, recvBuf;
+
+        /** Counter of the profiler under which the reduction of the mean of the solution is recorded */
+        commprof::counter *meanSite;
+
+        void initOperator(const int dim);
+        void eigenSolve(blitz::Array<real, 1> &dVec, blitz::Array<real, 1> &eVec, blitz::Array<real, 2> &qMat);
+
+        void transform(blitz::Array<real, 3> &data, const int dim, const blitz::Array<real, 2> &tMat);
+
+        void imposeBC();
+
+        /**
+        ********************************************************************************************************************************************
+        * \brief   Function to get the local indices of a point on a line of data along a given direction
+        *
+        *          The lines along direction dim are numbered serially over the two remaining directions of the local core.
+        *
+        * \param   dim is the direction along which the line lies (x -> 0, y -> 1, z -> 2)
+        * \param   line is the serial number of the line within the local core
+        * \param   pos is the local index of the point along the line
+        *
+        * \return  A TinyVector of the local indices of the point
+        ********************************************************************************************************************************************
+        */
+        inline blitz::TinyVector<int, 3> lineIndex(const int dim, const int line, const int pos) const {
+            blitz::TinyVector<int, 3> index;
+            int d1 = (dim + 1) % 3;
+            int d2 = (dim + 2) % 3;
+            int n2 = stagCore(0).ubound(d2) + 1;
+
+            index(dim) = pos;
+            index(d1) = line / n2;
+            index(d2) = line % n2;
+
+            return index;
+        };
+
+    public:
+        fastdiag(const grid &mesh, const parser &solParam);
+
+        void mgSolve(plainsf &outLHS, const plainsf &inpRHS);
+
+        ~fastdiag() {};
+};
+
+/**
+ ********************************************************************************************************************************************
+ *  \class fastdiag poisson.h "lib/poisson.h"
+ *  \brief The derived class from poisson to solve the Poisson equation directly using fast diagonalisation
+ *
+ *  The 1D second derivative operators on the stretched grid along each direction are diagonalized once at the start.
+ *  Each solve then consists of forward transforms along all directions, a point-wise division by the sum of eigenvalues,
+ *  and backward transforms.
+ *  Since the transforms are dense, the lines of data along x and y are transposed across the ranks of the corresponding
+ *  row and column communicators before the transforms are applied.
+ *  The solver is exact to round-off. It applies to domains with Neumann BC on the walls, and to periodic directions with uniform grids.
+ ********************************************************************************************************************************************
+ */
+
 #endif
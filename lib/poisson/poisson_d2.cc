@@ -58,6 +58,10 @@
  ********************************************************************************************************************************************
  */
 multigrid_d2::multigrid_d2(const grid &mesh, const parser &solParam): poisson(mesh, solParam) {
+    // REGISTER THE GLOBAL REDUCTIONS WITH THE COMMUNICATION PROFILER
+    solveSite = mesh.rankData.registerSite("Reduce multigrid_d2::solve");
+    errorSite = mesh.rankData.registerSite("Reduce multigrid_d2::computeError");
+
     // CREATE THE MPI SUB-ARRAYS NECESSARY TO TRANSFER DATA ACROSS SUB-DOMAINS AT ALL MESH LEVELS
     createMGSubArrays();
 
@@ -91,6 +95,10 @@ void multigrid_d2::computeResidual() {
 void multigrid_d2::smooth(const int smoothCount) {
     tmp(vLevel) = 0.0;
 
+    // PADS UPDATED WITHIN THE SMOOTHING ITERATIONS AT COARSER LEVELS ARE EXCHANGED IN SINGLE PRECISION WHEN REQUESTED
+    // THE LAST UPDATE IS ALWAYS AT FULL PRECISION, AS ITS PADS ARE USED FOR THE RESIDUAL AND PROLONGATION
+    floatExchange = inputParams.floatPads and (vLevel > 0);
+
     for(int n=0; n<smoothCount; ++n) {
         imposeBC();
 
@@ -124,6 +132,7 @@ void multigrid_d2::smooth(const int smoothCount) {
         }
     }
 
+    floatExchange = false;
     imposeBC();
 }
 
@@ -161,7 +170,7 @@ void multigrid_d2::solve() {
             }
         }
 
-        MPI_Allreduce(&localMax, &globalMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        mesh.rankData.allReduce(&localMax, &globalMax, 1, MPI_MAX, solveSite);
 
         if (globalMax < inputParams.mgTolerance) break;
 
@@ -262,8 +271,8 @@ real multigrid_d2::computeError(const int normOrder) {
     int pointCount = mesh.totalPoints;
     switch (normOrder) {
         case 0:     // L-Infinity Norm
-            MPI_Allreduce(&numValLoc, &numValGlo, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
-            MPI_Allreduce(&denValLoc, &denValGlo, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+            mesh.rankData.allReduce(&numValLoc, &numValGlo, 1, MPI_MAX, errorSite);
+            mesh.rankData.allReduce(&denValLoc, &denValGlo, 1, MPI_MAX, errorSite);
 
             if (denValGlo) {
                 residualVal = numValGlo/denValGlo;
@@ -272,8 +281,8 @@ real multigrid_d2::computeError(const int normOrder) {
             }
             break;
         case 1:     // L-1 Norm
-            MPI_Allreduce(&numValLoc, &numValGlo, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
-            MPI_Allreduce(&denValLoc, &denValGlo, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+            mesh.rankData.allReduce(&numValLoc, &numValGlo, 1, MPI_SUM, errorSite);
+            mesh.rankData.allReduce(&denValLoc, &denValGlo, 1, MPI_SUM, errorSite);
 
             if (denValGlo) {
                 residualVal = numValGlo/denValGlo;
@@ -282,8 +291,8 @@ real multigrid_d2::computeError(const int normOrder) {
             }
             break;
         case 2:     // L-2 Norm
-            MPI_Allreduce(&numValLoc, &numValGlo, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
-            MPI_Allreduce(&denValLoc, &denValGlo, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+            mesh.rankData.allReduce(&numValLoc, &numValGlo, 1, MPI_SUM, errorSite);
+            mesh.rankData.allReduce(&denValLoc, &denValGlo, 1, MPI_SUM, errorSite);
 
             if (denValGlo) {
                 residualVal = sqrt(numValGlo/pointCount)/sqrt(denValGlo/pointCount);
@@ -307,6 +316,11 @@ void multigrid_d2::createMGSubArrays() {
     mgSendLft.resize(inputParams.vcDepth + 1);        mgSendRgt.resize(inputParams.vcDepth + 1);
     mgRecvLft.resize(inputParams.vcDepth + 1);        mgRecvRgt.resize(inputParams.vcDepth + 1);
 
+    padSites.assign(inputParams.vcDepth + 1, NULL);
+    padBytes.assign(inputParams.vcDepth + 1, 0.0);
+
+    padLinks.resize(inputParams.vcDepth + 1);
+
     for(int n=0; n<=inputParams.vcDepth; ++n) {
         // CREATE X_MG_ARRAY DATATYPE
         count = stagFull(n).ubound(2) + 2;
@@ -319,6 +333,23 @@ void multigrid_d2::createMGSubArrays() {
         mgRecvLft(n) = -1, 0, -1;
         mgSendRgt(n) = stagCore(n).ubound(0), 0, -1;
         mgRecvRgt(n) = stagCore(n).ubound(0) + 1, 0, -1;
+
+        // REGISTER THE PAD EXCHANGES OF THE LEVEL WITH THE COMMUNICATION PROFILER
+        if (mesh.rankData.profile) {
+            padSites[n] = mesh.rankData.profile->site("Multigrid pads level " + std::to_string(n));
+
+            padBytes[n] = commprof::msgBytes(xMGArray(n), mesh.rankData.faceRanks(0)) + commprof::msgBytes(xMGArray(n), mesh.rankData.faceRanks(1));
+        }
+
+        // LIST THE SAME FACES FOR THE SINGLE PRECISION EXCHANGE OF PADS DURING SMOOTHING
+        if (inputParams.floatPads) {
+            blitz::TinyVector<int, 3> xShape;
+
+            xShape = 1, 1, count;
+
+            addPadLink(n, mgSendLft(n), mgRecvLft(n), xShape, mesh.rankData.faceRanks(0), 2, 1);
+            addPadLink(n, mgSendRgt(n), mgRecvRgt(n), xShape, mesh.rankData.faceRanks(1), 1, 2);
+        }
     }
 }
 
@@ -458,6 +489,16 @@ void multigrid_d2::imposeBC() {
 
 
 void multigrid_d2::updatePads(blitz::Array<blitz::Array<real, 3>, 1> &data) {
+    double tStart = 0.0;
+
+    if (floatExchange) {
+        updatePadsFloat(data);
+
+        return;
+    }
+
+    if (padSites[vLevel]) tStart = MPI_Wtime();
+
     recvRequest = MPI_REQUEST_NULL;
 
     // TRANSFER DATA FROM NEIGHBOURING CELL TO IMPOSE SUB-DOMAIN BOUNDARY CONDITIONS
@@ -468,5 +509,7 @@ void multigrid_d2::updatePads(blitz::Array<blitz::Array<real, 3>, 1> &data) {
     MPI_Send(&(data(vLevel)(mgSendRgt(vLevel))), 1, xMGArray(vLevel), mesh.rankData.faceRanks(1), 1, MPI_COMM_WORLD);
 
     MPI_Waitall(2, recvRequest.dataFirst(), recvStatus.dataFirst());
+
+    if (padSites[vLevel]) padSites[vLevel]->add(padBytes[vLevel], tStart);
 }
 
@@ -58,9 +58,24 @@
  ********************************************************************************************************************************************
  */
 multigrid_d3::multigrid_d3(const grid &mesh, const parser &solParam): poisson(mesh, solParam) {
+    // REGISTER THE GLOBAL REDUCTIONS WITH THE COMMUNICATION PROFILER
+    solveSite = mesh.rankData.registerSite("Reduce multigrid_d3::solve");
+    errorSite = mesh.rankData.registerSite("Reduce multigrid_d3::computeError");
+
     // CREATE THE MPI SUB-ARRAYS NECESSARY TO TRANSFER DATA ACROSS SUB-DOMAINS AT ALL MESH LEVELS
     createMGSubArrays();
 
+    // ALLOCATE THE BRICK LAYOUT OR SUB-BLOCK COPIES OF MULTIGRID DATA WHEN REQUESTED
+    if (not inputParams.gsSmooth) {
+        if (inputParams.brickLayout) {
+            initCoeffs();
+            initBricks();
+        } else if (inputParams.sbSize) {
+            initCoeffs();
+            initSubblocks();
+        }
+    }
+
     // INITIALIZE DIRICHLET BCs WHEN TESTING THE POISSON SOLVER
 #ifdef TEST_POISSON
     initDirichlet();
@@ -71,20 +86,31 @@ multigrid_d3::multigrid_d3(const grid &mesh, const parser &solParam): poisson(me
 void multigrid_d3::computeResidual() {
     tmp(vLevel) = 0.0;
 
+    const aview<const real, 3> L(lhs(vLevel));
+    const aview<const real, 3> R(rhs(vLevel));
+    const aview<real, 3> T(tmp(vLevel));
+
+    const aview<const real, 1> x2(xix2(vLevel)), xx(xixx(vLevel));
+    const aview<const real, 1> y2(ety2(vLevel)), yy(etyy(vLevel));
+    const aview<const real, 1> z2(ztz2(vLevel)), zz(ztzz(vLevel));
+
+    const real hx2 = ihx2(vLevel), h2x = i2hx(vLevel);
+    const real hy2 = ihy2(vLevel), h2y = i2hy(vLevel);
+    const real hz2 = ihz2(vLevel), h2z = i2hz(vLevel);
+
     // Compute Laplacian of the pressure field and subtract it from the RHS of Poisson equation to obtain the residual
     // This residual is temporarily stored into tmp, from which it will be coarsened into rhs array.
-    // Needed update: Substitute the below OpenMP parallel loop with vectorized Blitz operation and check for speed increase.
-#pragma omp parallel for num_threads(inputParams.nThreads) default(none)
+#pragma omp parallel for num_threads(inputParams.nThreads)
     for (int i = 0; i <= xEnd(vLevel); ++i) {
         for (int j = 0; j <= yEnd(vLevel); ++j) {
             for (int k = 0; k <= zEnd(vLevel); ++k) {
-                tmp(vLevel)(i, j, k) =  rhs(vLevel)(i, j, k) -
-                             (xix2(vLevel)(i) * ihx2(vLevel) * (lhs(vLevel)(i + 1, j, k) - 2.0*lhs(vLevel)(i, j, k) + lhs(vLevel)(i - 1, j, k)) +
-                              xixx(vLevel)(i) * i2hx(vLevel) * (lhs(vLevel)(i + 1, j, k) - lhs(vLevel)(i - 1, j, k)) +
-                              ety2(vLevel)(j) * ihy2(vLevel) * (lhs(vLevel)(i, j + 1, k) - 2.0*lhs(vLevel)(i, j, k) + lhs(vLevel)(i, j - 1, k)) +
-                              etyy(vLevel)(j) * i2hy(vLevel) * (lhs(vLevel)(i, j + 1, k) - lhs(vLevel)(i, j - 1, k)) +
-                              ztz2(vLevel)(k) * ihz2(vLevel) * (lhs(vLevel)(i, j, k + 1) - 2.0*lhs(vLevel)(i, j, k) + lhs(vLevel)(i, j, k - 1)) +
-                              ztzz(vLevel)(k) * i2hz(vLevel) * (lhs(vLevel)(i, j, k + 1) - lhs(vLevel)(i, j, k - 1)));
+                T(i, j, k) =  R(i, j, k) -
+                             (x2(i) * hx2 * (L(i + 1, j, k) - 2.0*L(i, j, k) + L(i - 1, j, k)) +
+                              xx(i) * h2x * (L(i + 1, j, k) - L(i - 1, j, k)) +
+                              y2(j) * hy2 * (L(i, j + 1, k) - 2.0*L(i, j, k) + L(i, j - 1, k)) +
+                              yy(j) * h2y * (L(i, j + 1, k) - L(i, j - 1, k)) +
+                              z2(k) * hz2 * (L(i, j, k + 1) - 2.0*L(i, j, k) + L(i, j, k - 1)) +
+                              zz(k) * h2z * (L(i, j, k + 1) - L(i, j, k - 1)));
             }
         }
     }
@@ -96,9 +122,53 @@ void multigrid_d3::computeResidual() {
 void multigrid_d3::smooth(const int smoothCount) {
     tmp(vLevel) = 0.0;
 
+    // PADS UPDATED WITHIN THE SMOOTHING ITERATIONS AT COARSER LEVELS ARE EXCHANGED IN SINGLE PRECISION WHEN REQUESTED
+    // THE LAST UPDATE OF EACH SMOOTHER IS ALWAYS AT FULL PRECISION, AS ITS PADS ARE USED FOR THE RESIDUAL AND PROLONGATION
+    floatExchange = inputParams.floatPads and (vLevel > 0);
+
+    // JACOBI SMOOTHING ON DATA STORED IN BRICK LAYOUT
+    if (inputParams.brickLayout and (not inputParams.gsSmooth)) {
+        brickSmooth(smoothCount);
+
+        return;
+    }
+
+    // JACOBI SMOOTHING ON SUB-BLOCKS OF THE SUB-DOMAIN, UPDATED AS INDEPENDENT TASKS BY THE THREADS
+    if (inputParams.sbSize and (not inputParams.gsSmooth)) {
+        subblockSmooth(smoothCount);
+
+        return;
+    }
+
+    // TEMPORALLY BLOCKED JACOBI SMOOTHING, WITH BCs AND SUB-DOMAIN PADS UPDATED ONCE PER BLOCK OF ITERATIONS
+    if ((inputParams.tBlock > 1) and (not inputParams.gsSmooth)) {
+        for (int n=0; n<smoothCount; n += inputParams.tBlock) {
+            imposeBC();
+
+            blockedSmooth(std::min(inputParams.tBlock, smoothCount - n));
+        }
+
+        floatExchange = false;
+        imposeBC();
+
+        return;
+    }
+
+    const aview<const real, 1> x2(xix2(vLevel)), xx(xixx(vLevel));
+    const aview<const real, 1> y2(ety2(vLevel)), yy(etyy(vLevel));
+    const aview<const real, 1> z2(ztz2(vLevel)), zz(ztzz(vLevel));
+
+    const real hx2 = ihx2(vLevel), h2x = i2hx(vLevel);
+    const real hy2 = ihy2(vLevel), h2y = i2hy(vLevel);
+    const real hz2 = ihz2(vLevel), h2z = i2hz(vLevel);
+
     for(int n=0; n<smoothCount; ++n) {
         imposeBC();
 
+        // THE VIEWS ARE MADE AFTER EVERY SWAP OF tmp AND lhs
+        const aview<real, 3> L(lhs(vLevel));
+        const aview<const real, 3> R(rhs(vLevel));
+
         // WARNING: When using the gauss-seidel smoothing as written below, the edges of interior sub-domains after MPI decomposition will not have the updated values
         // As a result, the serial and parallel results will not match when using gauss-seidel smoothing
         if (inputParams.gsSmooth) {
@@ -106,29 +176,31 @@ void multigrid_d3::smooth(const int smoothCount) {
             for (int i = 0; i <= xEnd(vLevel); ++i) {
                 for (int j = 0; j <= yEnd(vLevel); ++j) {
                     for (int k = 0; k <= zEnd(vLevel); ++k) {
-                        lhs(vLevel)(i, j, k) = (xix2(vLevel)(i) * ihx2(vLevel) * (lhs(vLevel)(i + 1, j, k) + lhs(vLevel)(i - 1, j, k)) +
-                                                xixx(vLevel)(i) * i2hx(vLevel) * (lhs(vLevel)(i + 1, j, k) - lhs(vLevel)(i - 1, j, k)) +
-                                                ety2(vLevel)(j) * ihy2(vLevel) * (lhs(vLevel)(i, j + 1, k) + lhs(vLevel)(i, j - 1, k)) +
-                                                etyy(vLevel)(j) * i2hy(vLevel) * (lhs(vLevel)(i, j + 1, k) - lhs(vLevel)(i, j - 1, k)) +
-                                                ztz2(vLevel)(k) * ihz2(vLevel) * (lhs(vLevel)(i, j, k + 1) + lhs(vLevel)(i, j, k - 1)) +
-                                                ztzz(vLevel)(k) * i2hz(vLevel) * (lhs(vLevel)(i, j, k + 1) - lhs(vLevel)(i, j, k - 1)) -
-                                                 rhs(vLevel)(i, j, k)) / (2.0 * (ihx2(vLevel)*xix2(vLevel)(i) + ihy2(vLevel)*ety2(vLevel)(j) + ihz2(vLevel)*ztz2(vLevel)(k)));
+                        L(i, j, k) = (x2(i) * hx2 * (L(i + 1, j, k) + L(i - 1, j, k)) +
+                                      xx(i) * h2x * (L(i + 1, j, k) - L(i - 1, j, k)) +
+                                      y2(j) * hy2 * (L(i, j + 1, k) + L(i, j - 1, k)) +
+                                      yy(j) * h2y * (L(i, j + 1, k) - L(i, j - 1, k)) +
+                                      z2(k) * hz2 * (L(i, j, k + 1) + L(i, j, k - 1)) +
+                                      zz(k) * h2z * (L(i, j, k + 1) - L(i, j, k - 1)) -
+                                       R(i, j, k)) / (2.0 * (hx2*x2(i) + hy2*y2(j) + hz2*z2(k)));
                     }
                 }
             }
         } else {
+            const aview<real, 3> T(tmp(vLevel));
+
             // JACOBI ITERATIVE SMOOTHING
-#pragma omp parallel for num_threads(inputParams.nThreads) default(none)
+#pragma omp parallel for num_threads(inputParams.nThreads)
             for (int i = 0; i <= xEnd(vLevel); ++i) {
                 for (int j = 0; j <= yEnd(vLevel); ++j) {
                     for (int k = 0; k <= zEnd(vLevel); ++k) {
-                        tmp(vLevel)(i, j, k) = (xix2(vLevel)(i) * ihx2(vLevel) * (lhs(vLevel)(i + 1, j, k) + lhs(vLevel)(i - 1, j, k)) +
-                                                xixx(vLevel)(i) * i2hx(vLevel) * (lhs(vLevel)(i + 1, j, k) - lhs(vLevel)(i - 1, j, k)) +
-                                                ety2(vLevel)(j) * ihy2(vLevel) * (lhs(vLevel)(i, j + 1, k) + lhs(vLevel)(i, j - 1, k)) +
-                                                etyy(vLevel)(j) * i2hy(vLevel) * (lhs(vLevel)(i, j + 1, k) - lhs(vLevel)(i, j - 1, k)) +
-                                                ztz2(vLevel)(k) * ihz2(vLevel) * (lhs(vLevel)(i, j, k + 1) + lhs(vLevel)(i, j, k - 1)) +
-                                                ztzz(vLevel)(k) * i2hz(vLevel) * (lhs(vLevel)(i, j, k + 1) - lhs(vLevel)(i, j, k - 1)) -
-                                                 rhs(vLevel)(i, j, k)) / (2.0 * (ihx2(vLevel)*xix2(vLevel)(i) + ihy2(vLevel)*ety2(vLevel)(j) + ihz2(vLevel)*ztz2(vLevel)(k)));
+                        T(i, j, k) = (x2(i) * hx2 * (L(i + 1, j, k) + L(i - 1, j, k)) +
+                                      xx(i) * h2x * (L(i + 1, j, k) - L(i - 1, j, k)) +
+                                      y2(j) * hy2 * (L(i, j + 1, k) + L(i, j - 1, k)) +
+                                      yy(j) * h2y * (L(i, j + 1, k) - L(i, j - 1, k)) +
+                                      z2(k) * hz2 * (L(i, j, k + 1) + L(i, j, k - 1)) +
+                                      zz(k) * h2z * (L(i, j, k + 1) - L(i, j, k - 1)) -
+                                       R(i, j, k)) / (2.0 * (hx2*x2(i) + hy2*y2(j) + hz2*z2(k)));
                     }
                 }
             }
@@ -137,6 +209,151 @@ void multigrid_d3::smooth(const int smoothCount) {
         }
     }
 
+    floatExchange = false;
+    imposeBC();
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to perform a block of temporally blocked Jacobi smoothing iterations
+ *
+ *          All the iterations of the block are applied together in a wavefront along the X direction, so that each YZ plane
+ *          is updated to all iteration levels while the planes it depends on are still in cache.
+ *          The arrays lhs and tmp hold alternate iteration levels at the current V-cycle level.
+ *          Since the pads are not updated within a block, the sub-domain boundaries see data that lags by up to
+ *          the number of iterations in the block, which is acceptable for a smoother.
+ *
+ * \param   iterCount is the number of Jacobi iterations to be performed in the block
+ ********************************************************************************************************************************************
+ */
+void multigrid_d3::blockedSmooth(const int iterCount) {
+    // Both arrays must have the same pad values, as they are read alternately
+    tmp(vLevel) = lhs(vLevel);
+
+    const aview<real, 3> L(lhs(vLevel));
+    const aview<real, 3> T(tmp(vLevel));
+    const aview<const real, 3> R(rhs(vLevel));
+
+    const aview<const real, 1> x2(xix2(vLevel)), xx(xixx(vLevel));
+    const aview<const real, 1> y2(ety2(vLevel)), yy(etyy(vLevel));
+    const aview<const real, 1> z2(ztz2(vLevel)), zz(ztzz(vLevel));
+
+    const real hx2 = ihx2(vLevel), h2x = i2hx(vLevel);
+    const real hy2 = ihy2(vLevel), h2y = i2hy(vLevel);
+    const real hz2 = ihz2(vLevel), h2z = i2hz(vLevel);
+
+#pragma omp parallel num_threads(inputParams.nThreads)
+    {
+        for (int w = 0; w <= xEnd(vLevel) + iterCount - 1; ++w) {
+            for (int t = 0; t < iterCount; ++t) {
+                int i = w - t;
+                if (i < 0 or i > xEnd(vLevel)) continue;
+
+                const aview<real, 3> &src = (t % 2)? T: L;
+                const aview<real, 3> &dst = (t % 2)? L: T;
+
+#pragma omp for
+                for (int j = 0; j <= yEnd(vLevel); ++j) {
+                    for (int k = 0; k <= zEnd(vLevel); ++k) {
+                        dst(i, j, k) = (x2(i) * hx2 * (src(i + 1, j, k) + src(i - 1, j, k)) +
+                                        xx(i) * h2x * (src(i + 1, j, k) - src(i - 1, j, k)) +
+                                        y2(j) * hy2 * (src(i, j + 1, k) + src(i, j - 1, k)) +
+                                        yy(j) * h2y * (src(i, j + 1, k) - src(i, j - 1, k)) +
+                                        z2(k) * hz2 * (src(i, j, k + 1) + src(i, j, k - 1)) +
+                                        zz(k) * h2z * (src(i, j, k + 1) - src(i, j, k - 1)) -
+                                         R(i, j, k)) / (2.0 * (hx2*x2(i) + hy2*y2(j) + hz2*z2(k)));
+                    }
+                }
+            }
+        }
+    }
+
+    // After an odd number of iterations, the latest level is in tmp
+    if (iterCount % 2) swap(tmp, lhs);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to perform Jacobi smoothing iterations on data stored in brick layout
+ *
+ *          The lhs and rhs arrays at the current V-cycle level are copied into brick layout once, and all the iterations are
+ *          performed on the bricks.
+ *          Between iterations, only the outermost layers of the core are written back to lhs so that imposeBC() can update
+ *          the pads through MPI transfer and boundary conditions, after which the pads are read back into the bricks.
+ *          The result is identical to the Jacobi iterations in smooth(), up to round-off.
+ *
+ * \param   smoothCount is the number of Jacobi iterations to be performed
+ ********************************************************************************************************************************************
+ */
+void multigrid_d3::brickSmooth(const int smoothCount) {
+    brick &lhsB = lhsBrick[vLevel];
+    brick &tmpB = tmpBrick[vLevel];
+
+    rhsBrick[vLevel].fromArray(rhs(vLevel), stagCore(vLevel));
+
+    imposeBC();
+    lhsB.fromArray(lhs(vLevel), stagFull(vLevel));
+
+    for(int n=0; n<smoothCount; ++n) {
+        if (n) {
+            lhsB.writeFaces(lhs(vLevel), stagCore(vLevel));
+            imposeBC();
+            lhsB.readPads(lhs(vLevel), stagCore(vLevel));
+        }
+
+        tmpB.jacobiSweep(lhsB, rhsBrick[vLevel], stagCore(vLevel), bCoeffM[vLevel], bCoeffP[vLevel], bCoeffD[vLevel], inputParams.nThreads);
+
+        lhsB.swap(tmpB);
+    }
+
+    lhsB.toArray(lhs(vLevel), stagCore(vLevel));
+
+    floatExchange = false;
+    imposeBC();
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to perform Jacobi smoothing iterations on data split into sub-blocks
+ *
+ *          The lhs and rhs arrays at the current V-cycle level are copied into the sub-blocks once, and all the iterations are
+ *          performed on the sub-blocks.
+ *          Between iterations, the halos between sub-blocks are exchanged by memory copies.
+ *          Only the faces of sub-blocks on the sub-domain boundary are written back to lhs so that imposeBC() can update
+ *          the pads through MPI transfer and boundary conditions, after which the pads are read back into these sub-blocks.
+ *          The result is identical to the Jacobi iterations in smooth(), up to round-off.
+ *
+ * \param   smoothCount is the number of Jacobi iterations to be performed
+ ********************************************************************************************************************************************
+ */
+void multigrid_d3::subblockSmooth(const int smoothCount) {
+    subblock &lhsS = lhsBlocks[vLevel];
+    subblock &tmpS = tmpBlocks[vLevel];
+
+    rhsBlocks[vLevel].fromArray(rhs(vLevel));
+
+    imposeBC();
+    lhsS.fromArray(lhs(vLevel));
+
+    for(int n=0; n<smoothCount; ++n) {
+        if (n) {
+            lhsS.writeFaces(lhs(vLevel));
+            imposeBC();
+            lhsS.readPads(lhs(vLevel));
+            lhsS.syncHalos(inputParams.nThreads);
+        }
+
+        tmpS.jacobiSweep(lhsS, rhsBlocks[vLevel], bCoeffM[vLevel], bCoeffP[vLevel], bCoeffD[vLevel], inputParams.nThreads);
+
+        lhsS.swap(tmpS);
+    }
+
+    lhsS.toArray(lhs(vLevel));
+
+    floatExchange = false;
     imposeBC();
 }
 
@@ -145,6 +362,17 @@ void multigrid_d3::solve() {
     int iterCount = 0;
     real tempValue, localMax, globalMax;
 
+    const aview<real, 3> L(lhs(vLevel));
+    const aview<const real, 3> R(rhs(vLevel));
+
+    const aview<const real, 1> x2(xix2(vLevel)), xx(xixx(vLevel));
+    const aview<const real, 1> y2(ety2(vLevel)), yy(etyy(vLevel));
+    const aview<const real, 1> z2(ztz2(vLevel)), zz(ztzz(vLevel));
+
+    const real hx2 = ihx2(vLevel), h2x = i2hx(vLevel);
+    const real hy2 = ihy2(vLevel), h2y = i2hy(vLevel);
+    const real hz2 = ihz2(vLevel), h2z = i2hz(vLevel);
+
     while (true) {
         imposeBC();
 
@@ -152,13 +380,13 @@ void multigrid_d3::solve() {
         for (int i = 0; i <= xEnd(vLevel); ++i) {
             for (int j = 0; j <= yEnd(vLevel); ++j) {
                 for (int k = 0; k <= zEnd(vLevel); ++k) {
-                    lhs(vLevel)(i, j, k) = (xix2(vLevel)(i) * ihx2(vLevel) * (lhs(vLevel)(i + 1, j, k) + lhs(vLevel)(i - 1, j, k)) +
-                                            xixx(vLevel)(i) * i2hx(vLevel) * (lhs(vLevel)(i + 1, j, k) - lhs(vLevel)(i - 1, j, k)) +
-                                            ety2(vLevel)(j) * ihy2(vLevel) * (lhs(vLevel)(i, j + 1, k) + lhs(vLevel)(i, j - 1, k)) +
-                                            etyy(vLevel)(j) * i2hy(vLevel) * (lhs(vLevel)(i, j + 1, k) - lhs(vLevel)(i, j - 1, k)) +
-                                            ztz2(vLevel)(k) * ihz2(vLevel) * (lhs(vLevel)(i, j, k + 1) + lhs(vLevel)(i, j, k - 1)) +
-                                            ztzz(vLevel)(k) * i2hz(vLevel) * (lhs(vLevel)(i, j, k + 1) - lhs(vLevel)(i, j, k - 1)) -
-                                             rhs(vLevel)(i, j, k)) / (2.0 * (ihx2(vLevel)*xix2(vLevel)(i) + ihy2(vLevel)*ety2(vLevel)(j) + ihz2(vLevel)*ztz2(vLevel)(k)));
+                    L(i, j, k) = (x2(i) * hx2 * (L(i + 1, j, k) + L(i - 1, j, k)) +
+                                  xx(i) * h2x * (L(i + 1, j, k) - L(i - 1, j, k)) +
+                                  y2(j) * hy2 * (L(i, j + 1, k) + L(i, j - 1, k)) +
+                                  yy(j) * h2y * (L(i, j + 1, k) - L(i, j - 1, k)) +
+                                  z2(k) * hz2 * (L(i, j, k + 1) + L(i, j, k - 1)) +
+                                  zz(k) * h2z * (L(i, j, k + 1) - L(i, j, k - 1)) -
+                                   R(i, j, k)) / (2.0 * (hx2*x2(i) + hy2*y2(j) + hz2*z2(k)));
                 }
             }
         }
@@ -168,13 +396,13 @@ void multigrid_d3::solve() {
         for (int i = 0; i <= xEnd(vLevel); ++i) {
             for (int j = 0; j <= yEnd(vLevel); ++j) {
                 for (int k = 0; k <= zEnd(vLevel); ++k) {
-                    tempValue = fabs(rhs(vLevel)(i, j, k) -
-                               (xix2(vLevel)(i) * ihx2(vLevel) * (lhs(vLevel)(i + 1, j, k) - 2.0*lhs(vLevel)(i, j, k) + lhs(vLevel)(i - 1, j, k)) +
-                                xixx(vLevel)(i) * i2hx(vLevel) * (lhs(vLevel)(i + 1, j, k) - lhs(vLevel)(i - 1, j, k)) +
-                                ety2(vLevel)(j) * ihy2(vLevel) * (lhs(vLevel)(i, j + 1, k) - 2.0*lhs(vLevel)(i, j, k) + lhs(vLevel)(i, j - 1, k)) +
-                                etyy(vLevel)(j) * i2hy(vLevel) * (lhs(vLevel)(i, j + 1, k) - lhs(vLevel)(i, j - 1, k)) +
-                                ztz2(vLevel)(k) * ihz2(vLevel) * (lhs(vLevel)(i, j, k + 1) - 2.0*lhs(vLevel)(i, j, k) + lhs(vLevel)(i, j, k - 1)) +
-                                ztzz(vLevel)(k) * i2hz(vLevel) * (lhs(vLevel)(i, j, k + 1) - lhs(vLevel)(i, j, k - 1))));
+                    tempValue = fabs(R(i, j, k) -
+                               (x2(i) * hx2 * (L(i + 1, j, k) - 2.0*L(i, j, k) + L(i - 1, j, k)) +
+                                xx(i) * h2x * (L(i + 1, j, k) - L(i - 1, j, k)) +
+                                y2(j) * hy2 * (L(i, j + 1, k) - 2.0*L(i, j, k) + L(i, j - 1, k)) +
+                                yy(j) * h2y * (L(i, j + 1, k) - L(i, j - 1, k)) +
+                                z2(k) * hz2 * (L(i, j, k + 1) - 2.0*L(i, j, k) + L(i, j, k - 1)) +
+                                zz(k) * h2z * (L(i, j, k + 1) - L(i, j, k - 1))));
 
                     if (tempValue > localMax)
                         localMax = tempValue;
@@ -182,7 +410,7 @@ void multigrid_d3::solve() {
             }
         }
 
-        MPI_Allreduce(&localMax, &globalMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        mesh.rankData.allReduce(&localMax, &globalMax, 1, MPI_MAX, solveSite);
 
         if (globalMax < inputParams.mgTolerance) break;
 
@@ -295,8 +523,8 @@ real multigrid_d3::computeError(const int normOrder) {
     int pointCount = mesh.totalPoints;
     switch (normOrder) {
         case 0:     // L-Infinity Norm
-            MPI_Allreduce(&numValLoc, &numValGlo, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
-            MPI_Allreduce(&denValLoc, &denValGlo, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+            mesh.rankData.allReduce(&numValLoc, &numValGlo, 1, MPI_MAX, errorSite);
+            mesh.rankData.allReduce(&denValLoc, &denValGlo, 1, MPI_MAX, errorSite);
 
             if (denValGlo) {
                 residualVal = numValGlo/denValGlo;
@@ -305,8 +533,8 @@ real multigrid_d3::computeError(const int normOrder) {
             }
             break;
         case 1:     // L-1 Norm
-            MPI_Allreduce(&numValLoc, &numValGlo, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
-            MPI_Allreduce(&denValLoc, &denValGlo, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+            mesh.rankData.allReduce(&numValLoc, &numValGlo, 1, MPI_SUM, errorSite);
+            mesh.rankData.allReduce(&denValLoc, &denValGlo, 1, MPI_SUM, errorSite);
 
             if (denValGlo) {
                 residualVal = numValGlo/denValGlo;
@@ -315,8 +543,8 @@ real multigrid_d3::computeError(const int normOrder) {
             }
             break;
         case 2:     // L-2 Norm
-            MPI_Allreduce(&numValLoc, &numValGlo, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
-            MPI_Allreduce(&denValLoc, &denValGlo, 1, MPI_FP_REAL, MPI_SUM, MPI_COMM_WORLD);
+            mesh.rankData.allReduce(&numValLoc, &numValGlo, 1, MPI_SUM, errorSite);
+            mesh.rankData.allReduce(&denValLoc, &denValGlo, 1, MPI_SUM, errorSite);
 
             if (denValGlo) {
                 residualVal = sqrt(numValGlo/pointCount)/sqrt(denValGlo/pointCount);
@@ -330,8 +558,83 @@ real multigrid_d3::computeError(const int normOrder) {
 }
 
 
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to allocate the brick layout copies of multigrid data
+ *
+ *          The bricks at each V-cycle level span the full staggered sub-domain including pads, same as the lhs array.
+ ********************************************************************************************************************************************
+ */
+void multigrid_d3::initBricks() {
+    for (int n=0; n<=inputParams.vcDepth; ++n) {
+        lhsBrick.push_back(brick(stagFull(n).lbound(), stagFull(n).ubound()));
+        tmpBrick.push_back(brick(stagFull(n).lbound(), stagFull(n).ubound()));
+        rhsBrick.push_back(brick(stagFull(n).lbound(), stagFull(n).ubound()));
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to allocate the copies of multigrid data split into sub-blocks
+ *
+ *          The staggered core of the sub-domain at each V-cycle level is split into sub-blocks of the size set by the user.
+ *          At coarse levels where the core is smaller than a sub-block, the sub-domain is held in a single sub-block.
+ ********************************************************************************************************************************************
+ */
+void multigrid_d3::initSubblocks() {
+    for (int n=0; n<=inputParams.vcDepth; ++n) {
+        lhsBlocks.push_back(subblock(stagCore(n), inputParams.sbSize));
+        tmpBlocks.push_back(subblock(stagCore(n), inputParams.sbSize));
+        rhsBlocks.push_back(subblock(stagCore(n), inputParams.sbSize));
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the coefficients used to smooth the brick layout and sub-block copies of multigrid data
+ *
+ *          The Laplacian is split into coefficients of the left and right neighbours and the diagonal along each direction,
+ *          as needed by brick::jacobiSweep and subblock::jacobiSweep.
+ ********************************************************************************************************************************************
+ */
+void multigrid_d3::initCoeffs() {
+    for (int n=0; n<=inputParams.vcDepth; ++n) {
+        blitz::Array<blitz::Array<real, 1>, 1> cM(3), cP(3), cD(3);
+        for (int dim=0; dim<3; ++dim) {
+            cM(dim).resize(stagFull(n).ubound(dim) - stagFull(n).lbound(dim) + 1);
+            cM(dim).reindexSelf(stagFull(n).lbound(dim));
+
+            cP(dim).resize(cM(dim).shape());
+            cP(dim).reindexSelf(stagFull(n).lbound(dim));
+
+            cD(dim).resize(cM(dim).shape());
+            cD(dim).reindexSelf(stagFull(n).lbound(dim));
+        }
+
+        cM(0) = xix2(n)*ihx2(n) - xixx(n)*i2hx(n);
+        cP(0) = xix2(n)*ihx2(n) + xixx(n)*i2hx(n);
+        cD(0) = 2.0*ihx2(n)*xix2(n);
+
+        cM(1) = ety2(n)*ihy2(n) - etyy(n)*i2hy(n);
+        cP(1) = ety2(n)*ihy2(n) + etyy(n)*i2hy(n);
+        cD(1) = 2.0*ihy2(n)*ety2(n);
+
+        cM(2) = ztz2(n)*ihz2(n) - ztzz(n)*i2hz(n);
+        cP(2) = ztz2(n)*ihz2(n) + ztzz(n)*i2hz(n);
+        cD(2) = 2.0*ihz2(n)*ztz2(n);
+
+        bCoeffM.push_back(cM);
+        bCoeffP.push_back(cP);
+        bCoeffD.push_back(cD);
+    }
+}
+
+
 void multigrid_d3::createMGSubArrays() {
     int count, length, stride;
+    int yStore, zStore;
 
     recvStatus.resize(4);
     recvRequest.resize(4);
@@ -350,6 +653,11 @@ void multigrid_d3::createMGSubArrays() {
     mgSendRgtFrn.resize(inputParams.vcDepth + 1);       mgSendLftBak.resize(inputParams.vcDepth + 1);
     mgRecvRgtFrn.resize(inputParams.vcDepth + 1);       mgRecvLftBak.resize(inputParams.vcDepth + 1);
 
+    padSites.assign(inputParams.vcDepth + 1, NULL);
+    padBytes.assign(inputParams.vcDepth + 1, 0.0);
+
+    padLinks.resize(inputParams.vcDepth + 1);
+
     /***************************************************************************************************
     * Previously xMGArray and yMGArray were defined only if npX > 1 or npY > 1 respectively.
     * This condition remained as a hidden bug in the code for the long time
@@ -359,16 +667,22 @@ void multigrid_d3::createMGSubArrays() {
     \**************************************************************************************************/
 
     for(int n=0; n<=inputParams.vcDepth; n++) {
+        // SIZES OF THE STORAGE OF ARRAYS ALONG Y AND Z, INCLUDING THE EXTRA POINTS SET IN THE GRID CLASS
+        yStore = stagFull(n).ubound(1) + 2 + mesh.allocPads(1);
+        zStore = stagFull(n).ubound(2) + 2 + mesh.allocPads(2);
+
         // CREATE X_MG_ARRAY DATATYPE
-        count = (stagFull(n).ubound(2) + 2)*(stagFull(n).ubound(1) + 2);
+        count = stagFull(n).ubound(1) + 2;
+        length = stagFull(n).ubound(2) + 2;
+        stride = zStore;
 
-        MPI_Type_contiguous(count, MPI_FP_REAL, &xMGArray(n));
+        MPI_Type_vector(count, length, stride, MPI_FP_REAL, &xMGArray(n));
         MPI_Type_commit(&xMGArray(n));
 
         // CREATE Y_MG_ARRAY DATATYPE
         count = stagFull(n).ubound(0) + 2;
         length = stagFull(n).ubound(2) + 2;
-        stride = (stagFull(n).ubound(2) + 2)*(stagFull(n).ubound(1) + 2);
+        stride = zStore*yStore;
 
         MPI_Type_vector(count, length, stride, MPI_FP_REAL, &yMGArray(n));
         MPI_Type_commit(&yMGArray(n));
@@ -399,6 +713,35 @@ void multigrid_d3::createMGSubArrays() {
         mgRecvRgtFrn(n) = stagCore(n).ubound(0) + 1, -1, -1;
         mgSendLftBak(n) =  0, stagCore(n).ubound(1), -1;
         mgRecvLftBak(n) = -1, stagCore(n).ubound(1) + 1, -1;
+
+        // REGISTER THE PAD EXCHANGES OF THE LEVEL WITH THE COMMUNICATION PROFILER
+        if (mesh.rankData.profile) {
+            padSites[n] = mesh.rankData.profile->site("Multigrid pads level " + std::to_string(n));
+
+            padBytes[n] = commprof::msgBytes(xMGArray(n), mesh.rankData.faceRanks(0)) + commprof::msgBytes(xMGArray(n), mesh.rankData.faceRanks(1)) +
+                          commprof::msgBytes(yMGArray(n), mesh.rankData.faceRanks(2)) + commprof::msgBytes(yMGArray(n), mesh.rankData.faceRanks(3));
+            for (int i=0; i<4; i++) padBytes[n] += commprof::msgBytes(zMGArray(n), mesh.rankData.edgeRanks(i));
+        }
+
+        // LIST THE SAME FACES AND EDGES FOR THE SINGLE PRECISION EXCHANGE OF PADS DURING SMOOTHING
+        // THE EDGES USE SEPARATE TAGS AS THEY ARE EXCHANGED TOGETHER WITH THE FACES
+        if (inputParams.floatPads) {
+            blitz::TinyVector<int, 3> xShape, yShape, zShape;
+
+            xShape = 1, stagFull(n).ubound(1) + 2, stagFull(n).ubound(2) + 2;
+            yShape = stagFull(n).ubound(0) + 2, 1, stagFull(n).ubound(2) + 2;
+            zShape = 1, 1, stagFull(n).ubound(2) + 2;
+
+            addPadLink(n, mgSendLft(n), mgRecvLft(n), xShape, mesh.rankData.faceRanks(0), 2, 1);
+            addPadLink(n, mgSendRgt(n), mgRecvRgt(n), xShape, mesh.rankData.faceRanks(1), 1, 2);
+            addPadLink(n, mgSendFrn(n), mgRecvFrn(n), yShape, mesh.rankData.faceRanks(2), 4, 3);
+            addPadLink(n, mgSendBak(n), mgRecvBak(n), yShape, mesh.rankData.faceRanks(3), 3, 4);
+
+            addPadLink(n, mgSendLftFrn(n), mgRecvLftFrn(n), zShape, mesh.rankData.edgeRanks(0), 8, 5);
+            addPadLink(n, mgSendLftBak(n), mgRecvLftBak(n), zShape, mesh.rankData.edgeRanks(1), 7, 6);
+            addPadLink(n, mgSendRgtFrn(n), mgRecvRgtFrn(n), zShape, mesh.rankData.edgeRanks(2), 6, 7);
+            addPadLink(n, mgSendRgtBak(n), mgRecvRgtBak(n), zShape, mesh.rankData.edgeRanks(3), 5, 8);
+        }
     }
 }
 
@@ -545,6 +888,16 @@ void multigrid_d3::imposeBC() {
 
 
 void multigrid_d3::updatePads(blitz::Array<blitz::Array<real, 3>, 1> &data) {
+    double tStart = 0.0;
+
+    if (floatExchange) {
+        updatePadsFloat(data);
+
+        return;
+    }
+
+    if (padSites[vLevel]) tStart = MPI_Wtime();
+
     recvRequest = MPI_REQUEST_NULL;
 
     // TRANSFER DATA ACROSS FACES FROM NEIGHBOURING CELLS TO IMPOSE SUB-DOMAIN BOUNDARY CONDITIONS
@@ -572,5 +925,7 @@ void multigrid_d3::updatePads(blitz::Array<blitz::Array<real, 3>, 1> &data) {
     MPI_Send(&(data(vLevel)(mgSendRgtBak(vLevel))), 1, zMGArray(vLevel), mesh.rankData.edgeRanks(3), 1, MPI_COMM_WORLD);
 
     MPI_Waitall(4, recvRequest.dataFirst(), recvStatus.dataFirst());
+
+    if (padSites[vLevel]) padSites[vLevel]->add(padBytes[vLevel], tStart);
 }
 
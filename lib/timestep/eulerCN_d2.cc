@@ -56,8 +56,7 @@
  ********************************************************************************************************************************************
  */
 eulerCN_d2::eulerCN_d2(const grid &mesh, const real &sTime, const real &dt, tseries &tsIO, vfield &V, sfield &P):
-    timestep(mesh, sTime, dt, tsIO, V, P),
-    mgSolver(mesh, mesh.inputParams)
+    timestep(mesh, sTime, dt, tsIO, V, P)
 {
     setCoefficients();
 
@@ -66,6 +65,22 @@ eulerCN_d2::eulerCN_d2(const grid &mesh, const real &sTime, const real &dt, tser
     // This can eat away a lot of core hours unnecessarily.
     // It remains to be seen if this upper limit is safe.
     maxIterations = int(std::pow(std::log(mesh.coreSize(0)*mesh.coreSize(1)*mesh.coreSize(2)), 3));
+
+    // Register the residual reductions of the implicit solvers with the communication profiler
+    vxSite = mesh.rankData.registerSite("Reduce eulerCN_d2::solveVx");
+    vzSite = mesh.rankData.registerSite("Reduce eulerCN_d2::solveVz");
+    tSite = mesh.rankData.registerSite("Reduce eulerCN_d2::solveT");
+
+    // Initialize the solver for the pressure Poisson equation
+    if (mesh.inputParams.pSolver == 1) {
+        if (mesh.rankData.rank == 0) {
+            std::cout << "Using direct fast diagonalisation solver for the pressure Poisson equation\n" << std::endl;
+        }
+
+        mgSolver = new fastdiag(mesh, mesh.inputParams);
+    } else {
+        mgSolver = new multigrid_d2(mesh, mesh.inputParams);
+    }
 }
 
 
@@ -82,6 +97,9 @@ eulerCN_d2::eulerCN_d2(const grid &mesh, const real &sTime, const real &dt, tser
 void eulerCN_d2::timeAdvance(vfield &V, sfield &P) {
     static plainvf nseRHS(mesh);
 
+    // Advance the time-integrated BCs, like the convective outflow BC, to the current time-step
+    V.advanceBCs(dt);
+
     nseRHS = 0.0;
 
     // Compute the diffusion term of momentum equation
@@ -90,15 +108,20 @@ void eulerCN_d2::timeAdvance(vfield &V, sfield &P) {
     nseRHS *= nu/2;
 
     // Compute the non-linear term and subtract it from the RHS
-    V.computeNLin(V, nseRHS);
+    if (slAdvect) {
+        // Trace the grid nodes back to their departure points and subtract the semi-Lagrangian advection term
+        slAdvect->trace(V, dt);
+        slAdvect->advect(V, nseRHS);
+    } else {
+        V.computeNLin(V, nseRHS);
+    }
 
     // Add the velocity forcing term
     V.vForcing->addForcing(nseRHS);
 
-    // Subtract the pressure gradient term
-    pressureGradient = 0.0;
-    P.gradient(pressureGradient);
-    nseRHS -= pressureGradient;
+    // Subtract the pressure gradient term, which is maintained across time-steps and recomputed from P only periodically
+    refreshGradP(P);
+    nseRHS -= gradP;
 
     // Multiply the entire RHS with dt and add the velocity of previous time-step to advance by explicit Euler method
     nseRHS *= dt;
@@ -122,7 +145,7 @@ void eulerCN_d2::timeAdvance(vfield &V, sfield &P) {
 #endif
 
     // Using the calculated mgRHS, evaluate pressure correction (Pp) using multi-grid method
-    mgSolver.mgSolve(Pp, mgRHS);
+    mgSolver->mgSolve(Pp, mgRHS);
 
     // Synchronise the pressure correction term across processors
     Pp.syncData();
@@ -137,8 +160,11 @@ void eulerCN_d2::timeAdvance(vfield &V, sfield &P) {
     // Add the pressure correction term to the pressure field of previous time-step, P
     P += Pp;
 
-    // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
+    // Update the pressure gradient by adding the gradient of pressure correction
     Pp.gradient(pressureGradient);
+    gradP += pressureGradient;
+
+    // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
     pressureGradient *= dt;
     V -= pressureGradient;
 
@@ -169,6 +195,10 @@ void eulerCN_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
     // CURRENTLY IT IS AVAILABLE ONLY FOR THE 2D SCALAR SOLVER
     bool nlinSwitch = true;
 
+    // Advance the time-integrated BCs, like the convective outflow BC, to the current time-step
+    V.advanceBCs(dt);
+    T.advanceBCs(dt);
+
     nseRHS = 0.0;
     tmpRHS = 0.0;
 
@@ -183,11 +213,21 @@ void eulerCN_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
     tmpRHS *= kappa/2;
 
     // Compute the non-linear term and subtract it from the RHS of momentum equation
-    V.computeNLin(V, nseRHS);
+    if (slAdvect) {
+        // Trace the grid nodes back to their departure points and subtract the semi-Lagrangian advection term
+        slAdvect->trace(V, dt);
+        slAdvect->advect(V, nseRHS);
+    } else {
+        V.computeNLin(V, nseRHS);
+    }
 
     if (nlinSwitch) {
         // Compute the non-linear term and subtract it from the RHS of scalar equation
-        T.computeNLin(V, tmpRHS);
+        if (slAdvect) {
+            slAdvect->advect(T, tmpRHS);
+        } else {
+            T.computeNLin(V, tmpRHS);
+        }
 
     } else {
         // EVEN WHEN NON-LINEAR TERM IS TURNED OFF, THE MEAN FLOW EFFECTS STILL REMAIN
@@ -207,10 +247,9 @@ void eulerCN_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
     // Add the scalar forcing term
     T.tForcing->addForcing(tmpRHS);
 
-    // Subtract the pressure gradient term from momentum equation
-    pressureGradient = 0.0;
-    P.gradient(pressureGradient);
-    nseRHS -= pressureGradient;
+    // Subtract the pressure gradient term from momentum equation, which is maintained across time-steps and recomputed from P only periodically
+    refreshGradP(P);
+    nseRHS -= gradP;
 
     // Multiply the entire RHS with dt and add the velocity of previous time-step to advance by explicit Euler method
     nseRHS *= dt;
@@ -221,13 +260,16 @@ void eulerCN_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
     tmpRHS += T;
 
     // Synchronize both the RHS terms across all processors by updating their sub-domain pads
+    // The pads of tmpRHS are updated while the velocity is being computed, if the progress thread is used for communication
     nseRHS.syncData();
-    tmpRHS.syncData();
+    tmpRHS.syncStart();
 
     // Using the RHS term computed, compute the guessed velocity of CN method iteratively (and store it in V)
     solveVx(V, nseRHS);
     solveVz(V, nseRHS);
 
+    tmpRHS.syncFinish();
+
     // Using the RHS term computed, compute the temperature at next time-step iteratively (and store it in T)
     solveT(T, tmpRHS);
 
@@ -236,7 +278,7 @@ void eulerCN_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
     mgRHS *= 1.0/dt;
 
     // Using the calculated mgRHS, evaluate pressure correction (Pp) using multi-grid method
-    mgSolver.mgSolve(Pp, mgRHS);
+    mgSolver->mgSolve(Pp, mgRHS);
 
     // Synchronise the pressure correction term across processors
     Pp.syncData();
@@ -244,8 +286,11 @@ void eulerCN_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
     // Add the pressure correction term to the pressure field of previous time-step, P
     P += Pp;
 
-    // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
+    // Update the pressure gradient by adding the gradient of pressure correction
     Pp.gradient(pressureGradient);
+    gradP += pressureGradient;
+
+    // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
     pressureGradient *= dt;
     V -= pressureGradient;
 
@@ -311,7 +356,7 @@ void eulerCN_d2::solveVx(vfield &V, plainvf &nseRHS) {
         tempVx(core) = abs(tempVx(core) - nseRHS.Vx(core));
 
         locMax = blitz::max(tempVx(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, vxSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -379,7 +424,7 @@ void eulerCN_d2::solveVz(vfield &V, plainvf &nseRHS) {
         tempVz(core) = abs(tempVz(core) - nseRHS.Vz(core));
 
         locMax = blitz::max(tempVz(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, vzSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -447,7 +492,7 @@ void eulerCN_d2::solveT(sfield &T, plainsf &tmpRHS) {
         tempT(core) = abs(tempT(core) - tmpRHS.F(core));
 
         locMax = blitz::max(tempT(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, tSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -482,3 +527,8 @@ void eulerCN_d2::setCoefficients() {
     ihx2 = 1.0/hx2;
     ihz2 = 1.0/hz2;
 };
+
+
+eulerCN_d2::~eulerCN_d2() {
+    delete mgSolver;
+}
@@ -56,17 +56,31 @@
  ********************************************************************************************************************************************
  */
 eulerCN_d3::eulerCN_d3(const grid &mesh, const real &sTime, const real &dt, tseries &tsIO, vfield &V, sfield &P):
-    timestep(mesh, sTime, dt, tsIO, V, P),
-    mgSolver(mesh, mesh.inputParams)
+    timestep(mesh, sTime, dt, tsIO, V, P)
 {
-    setCoefficients();
-
     // This upper limit on max iterations is an arbitrarily chosen function.
     // Using Nx x Ny x Nz as the upper limit may cause the run to freeze for very long time.
     // This can eat away a lot of core hours unnecessarily.
     // It remains to be seen if this upper limit is safe.
     maxIterations = int(std::pow(std::log(mesh.coreSize(0)*mesh.coreSize(1)*mesh.coreSize(2)), 3));
 
+    // Register the residual reductions of the implicit solvers with the communication profiler
+    vxSite = mesh.rankData.registerSite("Reduce eulerCN_d3::solveVx");
+    vySite = mesh.rankData.registerSite("Reduce eulerCN_d3::solveVy");
+    vzSite = mesh.rankData.registerSite("Reduce eulerCN_d3::solveVz");
+    tSite = mesh.rankData.registerSite("Reduce eulerCN_d3::solveT");
+
+    // Initialize the solver for the pressure Poisson equation
+    if (mesh.inputParams.pSolver == 1) {
+        if (mesh.rankData.rank == 0) {
+            std::cout << "Using direct fast diagonalisation solver for the pressure Poisson equation\n" << std::endl;
+        }
+
+        mgSolver = new fastdiag(mesh, mesh.inputParams);
+    } else {
+        mgSolver = new multigrid_d3(mesh, mesh.inputParams);
+    }
+
     // If LES switch is enabled, initialize LES model
     if (mesh.inputParams.lesModel) {
         if (mesh.rankData.rank == 0) {
@@ -92,6 +106,9 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P) {
     static plainvf nseRHS(mesh);
     real subgridKE;
 
+    // Advance the time-integrated BCs, like the convective outflow BC, to the current time-step
+    V.advanceBCs(dt);
+
     nseRHS = 0.0;
 
     // Compute the diffusion term of momentum equation
@@ -100,7 +117,13 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P) {
     nseRHS *= nu/2;
 
     // Compute the non-linear term and subtract it from the RHS
-    V.computeNLin(V, nseRHS);
+    if (slAdvect) {
+        // Trace the grid nodes back to their departure points and subtract the semi-Lagrangian advection term
+        slAdvect->trace(V, dt);
+        slAdvect->advect(V, nseRHS);
+    } else {
+        V.computeNLin(V, nseRHS);
+    }
 
     // Add the velocity forcing term
     V.vForcing->addForcing(nseRHS);
@@ -111,10 +134,9 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P) {
         tsWriter.subgridEnergy = subgridKE;
     }
 
-    // Subtract the pressure gradient term
-    pressureGradient = 0.0;
-    P.gradient(pressureGradient);
-    nseRHS -= pressureGradient;
+    // Subtract the pressure gradient term, which is maintained across time-steps and recomputed from P only periodically
+    refreshGradP(P);
+    nseRHS -= gradP;
 
     // Multiply the entire RHS with dt and add the velocity of previous time-step to advance by explicit Euler method
     nseRHS *= dt;
@@ -128,6 +150,9 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P) {
     solveVy(V, nseRHS);
     solveVz(V, nseRHS);
 
+    // Integrate the Coriolis term exactly by rotating the horizontal components of the guessed velocity, if enabled
+    if (V.vForcing->rotRate != 0.0) rotateVelocity(V, dt);
+
     // Calculate the rhs for the poisson solver (mgRHS) using the divergence of guessed velocity in V
     V.divergence(mgRHS);
     mgRHS *= 1.0/dt;
@@ -139,7 +164,7 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P) {
 #endif
 
     // Using the calculated mgRHS, evaluate pressure correction (Pp) using multi-grid method
-    mgSolver.mgSolve(Pp, mgRHS);
+    mgSolver->mgSolve(Pp, mgRHS);
 
     // Synchronise the pressure correction term across processors
     Pp.syncData();
@@ -154,8 +179,11 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P) {
     // Add the pressure correction term to the pressure field of previous time-step, P
     P += Pp;
 
-    // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
+    // Update the pressure gradient by adding the gradient of pressure correction
     Pp.gradient(pressureGradient);
+    gradP += pressureGradient;
+
+    // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
     pressureGradient *= dt;
     V -= pressureGradient;
 
@@ -179,9 +207,13 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P) {
  */
 void eulerCN_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
     static plainvf nseRHS(mesh);
-    static plainsf tmpRHS(mesh);
+    static plainsf tmpRHS(*tMesh);
     real subgridKE;
 
+    // Advance the time-integrated BCs, like the convective outflow BC, to the current time-step
+    V.advanceBCs(dt);
+    T.advanceBCs(dt);
+
     nseRHS = 0.0;
     tmpRHS = 0.0;
 
@@ -196,10 +228,16 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
     tmpRHS *= kappa/2;
 
     // Compute the non-linear term and subtract it from the RHS of momentum equation
-    V.computeNLin(V, nseRHS);
+    if (slAdvect) {
+        // Trace the grid nodes back to their departure points and subtract the semi-Lagrangian advection term
+        slAdvect->trace(V, dt);
+        slAdvect->advect(V, nseRHS);
+    } else {
+        V.computeNLin(V, nseRHS);
+    }
 
     // Compute the non-linear term and subtract it from the RHS of scalar equation
-    T.computeNLin(V, tmpRHS);
+    computeScalarNLin(V, T, tmpRHS, dt);
 
     // Add the velocity forcing term
     V.vForcing->addForcing(nseRHS);
@@ -219,10 +257,9 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
         tsWriter.subgridEnergy = subgridKE;
     }
 
-    // Subtract the pressure gradient term from momentum equation
-    pressureGradient = 0.0;
-    P.gradient(pressureGradient);
-    nseRHS -= pressureGradient;
+    // Subtract the pressure gradient term from momentum equation, which is maintained across time-steps and recomputed from P only periodically
+    refreshGradP(P);
+    nseRHS -= gradP;
 
     // Multiply the entire RHS with dt and add the velocity of previous time-step to advance by explicit Euler method
     nseRHS *= dt;
@@ -233,14 +270,20 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
     tmpRHS += T;
 
     // Synchronize both the RHS terms across all processors by updating their sub-domain pads
+    // The pads of tmpRHS are updated while the velocity is being computed, if the progress thread is used for communication
     nseRHS.syncData();
-    tmpRHS.syncData();
+    tmpRHS.syncStart();
 
     // Using the RHS term computed, compute the guessed velocity of CN method iteratively (and store it in V)
     solveVx(V, nseRHS);
     solveVy(V, nseRHS);
     solveVz(V, nseRHS);
 
+    // Integrate the Coriolis term exactly by rotating the horizontal components of the guessed velocity, if enabled
+    if (V.vForcing->rotRate != 0.0) rotateVelocity(V, dt);
+
+    tmpRHS.syncFinish();
+
     // Using the RHS term computed, compute the temperature at next time-step iteratively (and store it in T)
     solveT(T, tmpRHS);
 
@@ -249,7 +292,7 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
     mgRHS *= 1.0/dt;
 
     // Using the calculated mgRHS, evaluate pressure correction (Pp) using multi-grid method
-    mgSolver.mgSolve(Pp, mgRHS);
+    mgSolver->mgSolve(Pp, mgRHS);
 
     // Synchronise the pressure correction term across processors
     Pp.syncData();
@@ -257,8 +300,11 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
     // Add the pressure correction term to the pressure field of previous time-step, P
     P += Pp;
 
-    // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
+    // Update the pressure gradient by adding the gradient of pressure correction
     Pp.gradient(pressureGradient);
+    gradP += pressureGradient;
+
+    // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
     pressureGradient *= dt;
     V -= pressureGradient;
 
@@ -270,6 +316,9 @@ void eulerCN_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
 
     // Impose boundary conditions on the updated temperature field, T
     T.imposeBCs();
+
+    // Restrict the temperature on to the grid of the velocity, if it is solved on a refined grid
+    restrictScalar(T);
 }
 
 
@@ -293,45 +342,14 @@ void eulerCN_d3::solveVx(vfield &V, plainvf &nseRHS) {
     static blitz::Array<real, 3> tempVx(V.Vx.F.lbound(), V.Vx.F.shape());
 
     while (true) {
-#pragma omp parallel for num_threads(mesh.inputParams.nThreads) default(none) shared(V) shared(nseRHS) shared(tempVx)
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVx(iX, iY, iZ) = ((ihx2 * mesh.xix2(iX) * (V.Vx.F(iX+1, iY, iZ) + V.Vx.F(iX-1, iY, iZ)) +
-                                           i2hx * mesh.xixx(iX) * (V.Vx.F(iX+1, iY, iZ) - V.Vx.F(iX-1, iY, iZ)) +
-                                           ihy2 * mesh.ety2(iY) * (V.Vx.F(iX, iY+1, iZ) + V.Vx.F(iX, iY-1, iZ)) +
-                                           i2hy * mesh.etyy(iY) * (V.Vx.F(iX, iY+1, iZ) - V.Vx.F(iX, iY-1, iZ)) +
-                                           ihz2 * mesh.ztz2(iZ) * (V.Vx.F(iX, iY, iZ+1) + V.Vx.F(iX, iY, iZ-1)) +
-                                           i2hz * mesh.ztzz(iZ) * (V.Vx.F(iX, iY, iZ+1) - V.Vx.F(iX, iY, iZ-1))) *
-                            dt * nu / 2.0 + nseRHS.Vx(iX, iY, iZ)) /
-                     (1.0 + dt * nu * (ihx2 * mesh.xix2(iX) + ihy2 * mesh.ety2(iY) + ihz2 * mesh.ztz2(iZ)));
-                }
-            }
-        }
+        jacobiIterate(mesh, V.Vx.F, tempVx, nseRHS.Vx, 0.5*dt*nu);
 
         V.Vx.F = tempVx;
 
         V.imposeVxBC();
 
-#pragma omp parallel for num_threads(mesh.inputParams.nThreads) default(none) shared(V) shared(tempVx)
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVx(iX, iY, iZ) = V.Vx.F(iX, iY, iZ) - 0.5 * dt * nu * (
-                              mesh.xix2(iX) * (V.Vx.F(iX+1, iY, iZ) - 2.0 * V.Vx.F(iX, iY, iZ) + V.Vx.F(iX-1, iY, iZ)) * ihx2 +
-                              mesh.xixx(iX) * (V.Vx.F(iX+1, iY, iZ) - V.Vx.F(iX-1, iY, iZ)) * i2hx +
-                              mesh.ety2(iY) * (V.Vx.F(iX, iY+1, iZ) - 2.0 * V.Vx.F(iX, iY, iZ) + V.Vx.F(iX, iY-1, iZ)) * ihy2 +
-                              mesh.etyy(iY) * (V.Vx.F(iX, iY+1, iZ) - V.Vx.F(iX, iY-1, iZ)) * i2hy +
-                              mesh.ztz2(iZ) * (V.Vx.F(iX, iY, iZ+1) - 2.0 * V.Vx.F(iX, iY, iZ) + V.Vx.F(iX, iY, iZ-1)) * ihz2 +
-                              mesh.ztzz(iZ) * (V.Vx.F(iX, iY, iZ+1) - V.Vx.F(iX, iY, iZ-1)) * i2hz);
-                }
-            }
-        }
-
-        tempVx(core) = abs(tempVx(core) - nseRHS.Vx(core));
-
-        locMax = blitz::max(tempVx(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        locMax = jacobiResidual(mesh, V.Vx.F, nseRHS.Vx, 0.5*dt*nu);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, vxSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -368,45 +386,14 @@ void eulerCN_d3::solveVy(vfield &V, plainvf &nseRHS) {
     static blitz::Array<real, 3> tempVy(V.Vy.F.lbound(), V.Vy.F.shape());
 
     while (true) {
-#pragma omp parallel for num_threads(mesh.inputParams.nThreads) default(none) shared(V) shared(nseRHS) shared(tempVy)
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVy(iX, iY, iZ) = ((ihx2 * mesh.xix2(iX) * (V.Vy.F(iX+1, iY, iZ) + V.Vy.F(iX-1, iY, iZ)) +
-                                           i2hx * mesh.xixx(iX) * (V.Vy.F(iX+1, iY, iZ) - V.Vy.F(iX-1, iY, iZ)) +
-                                           ihy2 * mesh.ety2(iY) * (V.Vy.F(iX, iY+1, iZ) + V.Vy.F(iX, iY-1, iZ)) +
-                                           i2hy * mesh.etyy(iY) * (V.Vy.F(iX, iY+1, iZ) - V.Vy.F(iX, iY-1, iZ)) +
-                                           ihz2 * mesh.ztz2(iZ) * (V.Vy.F(iX, iY, iZ+1) + V.Vy.F(iX, iY, iZ-1)) +
-                                           i2hz * mesh.ztzz(iZ) * (V.Vy.F(iX, iY, iZ+1) - V.Vy.F(iX, iY, iZ-1))) *
-                            dt * nu / 2.0 + nseRHS.Vy(iX, iY, iZ)) /
-                     (1.0 + dt * nu * (ihx2 * mesh.xix2(iX) + ihy2 * mesh.ety2(iY) + ihz2 * mesh.ztz2(iZ)));
-                }
-            }
-        }
+        jacobiIterate(mesh, V.Vy.F, tempVy, nseRHS.Vy, 0.5*dt*nu);
 
         V.Vy.F = tempVy;
 
         V.imposeVyBC();
 
-#pragma omp parallel for num_threads(mesh.inputParams.nThreads) default(none) shared(V) shared(tempVy)
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVy(iX, iY, iZ) = V.Vy.F(iX, iY, iZ) - 0.5 * dt * nu * (
-                              mesh.xix2(iX) * (V.Vy.F(iX+1, iY, iZ) - 2.0 * V.Vy.F(iX, iY, iZ) + V.Vy.F(iX-1, iY, iZ)) * ihx2 +
-                              mesh.xixx(iX) * (V.Vy.F(iX+1, iY, iZ) - V.Vy.F(iX-1, iY, iZ)) * i2hx +
-                              mesh.ety2(iY) * (V.Vy.F(iX, iY+1, iZ) - 2.0 * V.Vy.F(iX, iY, iZ) + V.Vy.F(iX, iY-1, iZ)) * ihy2 +
-                              mesh.etyy(iY) * (V.Vy.F(iX, iY+1, iZ) - V.Vy.F(iX, iY-1, iZ)) * i2hy +
-                              mesh.ztz2(iZ) * (V.Vy.F(iX, iY, iZ+1) - 2.0 * V.Vy.F(iX, iY, iZ) + V.Vy.F(iX, iY, iZ-1)) * ihz2 +
-                              mesh.ztzz(iZ) * (V.Vy.F(iX, iY, iZ+1) - V.Vy.F(iX, iY, iZ-1)) * i2hz);
-                }
-            }
-        }
-
-        tempVy(core) = abs(tempVy(core) - nseRHS.Vy(core));
-
-        locMax = blitz::max(tempVy(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        locMax = jacobiResidual(mesh, V.Vy.F, nseRHS.Vy, 0.5*dt*nu);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, vySite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -443,45 +430,14 @@ void eulerCN_d3::solveVz(vfield &V, plainvf &nseRHS) {
     static blitz::Array<real, 3> tempVz(V.Vz.F.lbound(), V.Vz.F.shape());
 
     while (true) {
-#pragma omp parallel for num_threads(mesh.inputParams.nThreads) default(none) shared(V) shared(nseRHS) shared(tempVz)
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVz(iX, iY, iZ) = ((ihx2 * mesh.xix2(iX) * (V.Vz.F(iX+1, iY, iZ) + V.Vz.F(iX-1, iY, iZ)) +
-                                           i2hx * mesh.xixx(iX) * (V.Vz.F(iX+1, iY, iZ) - V.Vz.F(iX-1, iY, iZ)) +
-                                           ihy2 * mesh.ety2(iY) * (V.Vz.F(iX, iY+1, iZ) + V.Vz.F(iX, iY-1, iZ)) +
-                                           i2hy * mesh.etyy(iY) * (V.Vz.F(iX, iY+1, iZ) - V.Vz.F(iX, iY-1, iZ)) +
-                                           ihz2 * mesh.ztz2(iZ) * (V.Vz.F(iX, iY, iZ+1) + V.Vz.F(iX, iY, iZ-1)) +
-                                           i2hz * mesh.ztzz(iZ) * (V.Vz.F(iX, iY, iZ+1) - V.Vz.F(iX, iY, iZ-1))) *
-                            dt * nu / 2.0 + nseRHS.Vz(iX, iY, iZ)) /
-                     (1.0 + dt * nu * (ihx2 * mesh.xix2(iX) + ihy2 * mesh.ety2(iY) + ihz2 * mesh.ztz2(iZ)));
-                }
-            }
-        }
+        jacobiIterate(mesh, V.Vz.F, tempVz, nseRHS.Vz, 0.5*dt*nu);
 
         V.Vz.F = tempVz;
 
         V.imposeVzBC();
 
-#pragma omp parallel for num_threads(mesh.inputParams.nThreads) default(none) shared(V) shared(tempVz)
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVz(iX, iY, iZ) = V.Vz.F(iX, iY, iZ) - 0.5 * dt * nu * (
-                              mesh.xix2(iX) * (V.Vz.F(iX+1, iY, iZ) - 2.0 * V.Vz.F(iX, iY, iZ) + V.Vz.F(iX-1, iY, iZ)) * ihx2 +
-                              mesh.xixx(iX) * (V.Vz.F(iX+1, iY, iZ) - V.Vz.F(iX-1, iY, iZ)) * i2hx +
-                              mesh.ety2(iY) * (V.Vz.F(iX, iY+1, iZ) - 2.0 * V.Vz.F(iX, iY, iZ) + V.Vz.F(iX, iY-1, iZ)) * ihy2 +
-                              mesh.etyy(iY) * (V.Vz.F(iX, iY+1, iZ) - V.Vz.F(iX, iY-1, iZ)) * i2hy +
-                              mesh.ztz2(iZ) * (V.Vz.F(iX, iY, iZ+1) - 2.0 * V.Vz.F(iX, iY, iZ) + V.Vz.F(iX, iY, iZ-1)) * ihz2 +
-                              mesh.ztzz(iZ) * (V.Vz.F(iX, iY, iZ+1) - V.Vz.F(iX, iY, iZ-1)) * i2hz);
-                }
-            }
-        }
-
-        tempVz(core) = abs(tempVz(core) - nseRHS.Vz(core));
-
-        locMax = blitz::max(tempVz(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        locMax = jacobiResidual(mesh, V.Vz.F, nseRHS.Vz, 0.5*dt*nu);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, vzSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -505,45 +461,14 @@ void eulerCN_d3::solveT(sfield &T, plainsf &tmpRHS) {
     static blitz::Array<real, 3> tempT(T.F.F.lbound(), T.F.F.shape());
 
     while (true) {
-#pragma omp parallel for num_threads(mesh.inputParams.nThreads) default(none) shared(T) shared(tmpRHS) shared(tempT)
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempT(iX, iY, iZ) = ((ihx2 * mesh.xix2(iX) * (T.F.F(iX+1, iY, iZ) + T.F.F(iX-1, iY, iZ)) +
-                                          i2hx * mesh.xixx(iX) * (T.F.F(iX+1, iY, iZ) - T.F.F(iX-1, iY, iZ)) +
-                                          ihy2 * mesh.ety2(iY) * (T.F.F(iX, iY+1, iZ) + T.F.F(iX, iY-1, iZ)) +
-                                          i2hy * mesh.etyy(iY) * (T.F.F(iX, iY+1, iZ) - T.F.F(iX, iY-1, iZ)) +
-                                          ihz2 * mesh.ztz2(iZ) * (T.F.F(iX, iY, iZ+1) + T.F.F(iX, iY, iZ-1)) +
-                                          i2hz * mesh.ztzz(iZ) * (T.F.F(iX, iY, iZ+1) - T.F.F(iX, iY, iZ-1))) *
-                        dt * kappa / 2.0 + tmpRHS.F(iX, iY, iZ)) /
-                 (1.0 + dt * kappa * (ihx2 * mesh.xix2(iX) + ihy2 * mesh.ety2(iY) + ihz2 * mesh.ztz2(iZ)));
-                }
-            }
-        }
+        jacobiIterate(*tMesh, T.F.F, tempT, tmpRHS.F, 0.5*dt*kappa);
 
         T.F.F = tempT;
 
         T.imposeBCs();
 
-#pragma omp parallel for num_threads(mesh.inputParams.nThreads) default(none) shared(T) shared(tempT)
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempT(iX, iY, iZ) = T.F.F(iX, iY, iZ) - 0.5 * dt * kappa * (
-                           mesh.xix2(iX) * (T.F.F(iX+1, iY, iZ) - 2.0 * T.F.F(iX, iY, iZ) + T.F.F(iX-1, iY, iZ)) * ihx2 +
-                           mesh.xixx(iX) * (T.F.F(iX+1, iY, iZ) - T.F.F(iX-1, iY, iZ)) * i2hx +
-                           mesh.ety2(iY) * (T.F.F(iX, iY+1, iZ) - 2.0 * T.F.F(iX, iY, iZ) + T.F.F(iX, iY-1, iZ)) * ihy2 +
-                           mesh.etyy(iY) * (T.F.F(iX, iY+1, iZ) - T.F.F(iX, iY-1, iZ)) * i2hy +
-                           mesh.ztz2(iZ) * (T.F.F(iX, iY, iZ+1) - 2.0 * T.F.F(iX, iY, iZ) + T.F.F(iX, iY, iZ-1)) * ihz2 +
-                           mesh.ztzz(iZ) * (T.F.F(iX, iY, iZ+1) - T.F.F(iX, iY, iZ-1)) * i2hz);
-                }
-            }
-        }
-
-        tempT(core) = abs(tempT(core) - tmpRHS.F(core));
-
-        locMax = blitz::max(tempT(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        locMax = jacobiResidual(*tMesh, T.F.F, tmpRHS.F, 0.5*dt*kappa);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, tSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -560,24 +485,6 @@ void eulerCN_d3::solveT(sfield &T, plainsf &tmpRHS) {
 }
 
 
-/**
- ********************************************************************************************************************************************
- * \brief   Function to set the coefficients used for solving the implicit equations of U, V and W
- *
- *          The function assigns values to the variables \ref hx, \ref hy, etc.
- *          These coefficients are repeatedly used at many places in the iterative solver for implicit calculation of velocities.
- ********************************************************************************************************************************************
- */
-void eulerCN_d3::setCoefficients() {
-    real hx2 = pow(mesh.dXi, 2.0);
-    real hy2 = pow(mesh.dEt, 2.0);
-    real hz2 = pow(mesh.dZt, 2.0);
-
-    i2hx = 0.5/mesh.dXi;
-    i2hy = 0.5/mesh.dEt;
-    i2hz = 0.5/mesh.dZt;
-
-    ihx2 = 1.0/hx2;
-    ihy2 = 1.0/hy2;
-    ihz2 = 1.0/hz2;
-};
+eulerCN_d3::~eulerCN_d3() {
+    delete mgSolver;
+}
@@ -56,8 +56,7 @@
  ********************************************************************************************************************************************
  */
 lsRK3_d2::lsRK3_d2(const grid &mesh, const real &sTime, const real &dt, tseries &tsIO, vfield &V, sfield &P):
-    timestep(mesh, sTime, dt, tsIO, V, P),
-    mgSolver(mesh, mesh.inputParams)
+    timestep(mesh, sTime, dt, tsIO, V, P)
 {
     setCoefficients();
 
@@ -67,6 +66,22 @@ lsRK3_d2::lsRK3_d2(const grid &mesh, const real &sTime, const real &dt, tseries
     // It remains to be seen if this upper limit is safe.
     maxIterations = int(std::pow(std::log(mesh.coreSize(0)*mesh.coreSize(1)*mesh.coreSize(2)), 3));
 
+    // Register the residual reductions of the implicit solvers with the communication profiler
+    vxSite = mesh.rankData.registerSite("Reduce lsRK3_d2::solveVx");
+    vzSite = mesh.rankData.registerSite("Reduce lsRK3_d2::solveVz");
+    tSite = mesh.rankData.registerSite("Reduce lsRK3_d2::solveT");
+
+    // Initialize the solver for the pressure Poisson equation
+    if (mesh.inputParams.pSolver == 1) {
+        if (mesh.rankData.rank == 0) {
+            std::cout << "Using direct fast diagonalisation solver for the pressure Poisson equation\n" << std::endl;
+        }
+
+        mgSolver = new fastdiag(mesh, mesh.inputParams);
+    } else {
+        mgSolver = new multigrid_d2(mesh, mesh.inputParams);
+    }
+
     // These coefficients are taken from references [2], [3] and [4] of the Journal references in README
     alphRK3 = 4.0/15.0, 1.0/15.0, 1.0/6.0;
     betaRK3 = 4.0/15.0, 1.0/15.0, 1.0/6.0;
@@ -92,6 +107,9 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P) {
     static plainvf tempVF(mesh);
 
     for (rkLev = 0; rkLev < 3; rkLev++) {
+        // Advance the time-integrated BCs, like the convective outflow BC, to the current sub-step
+        V.advanceBCs((alphRK3(rkLev) + betaRK3(rkLev))*dt);
+
         nseRHS = 0.0;
 
         // Add the contribution from previous sub-step non-linear term
@@ -108,10 +126,9 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P) {
         // Add the velocity forcing term
         V.vForcing->addForcing(tempVF);
 
-        // Subtract the pressure gradient term
-        pressureGradient = 0.0;
-        P.gradient(pressureGradient);
-        tempVF -= pressureGradient;
+        // Subtract the pressure gradient term, which is maintained across sub-steps and recomputed from P only periodically
+        if (rkLev == 0) refreshGradP(P);
+        tempVF -= gradP;
 
         // Add the forcing and pressure gradient terms to the RHS with weights
         nseRHS = nseRHS.multAdd(tempVF, alphRK3(rkLev) + betaRK3(rkLev));
@@ -119,7 +136,18 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P) {
         tempVF = 0.0;
 
         // Compute the non-linear term for current sub-step
-        V.computeNLin(V, tempVF);
+        if (slAdvect) {
+            // With semi-Lagrangian advection, the grid nodes are traced back over the interval of the current sub-step
+            slAdvect->trace(V, (alphRK3(rkLev) + betaRK3(rkLev))*dt);
+            slAdvect->advect(V, tempVF);
+
+            // The traced update spans the whole sub-step, and is hence added directly to the RHS instead of through the RK3 weights.
+            // Only the remaining explicit terms are weighted by gammRK3, and carried over to the next sub-step with zetaRK3
+            nseRHS = nseRHS.multAdd(tempVF, alphRK3(rkLev) + betaRK3(rkLev));
+            tempVF = 0.0;
+        } else {
+            V.computeNLin(V, tempVF);
+        }
 
         // Add non-linear term to RHS
         nseRHS = nseRHS.multAdd(tempVF, gammRK3(rkLev));
@@ -140,7 +168,7 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P) {
         mgRHS *= 1.0/((alphRK3(rkLev) + betaRK3(rkLev))*dt);
 
         // Using the calculated mgRHS, evaluate pressure correction (Pp) using multi-grid method
-        mgSolver.mgSolve(Pp, mgRHS);
+        mgSolver->mgSolve(Pp, mgRHS);
 
         // Synchronise the pressure correction term across processors
         Pp.syncData();
@@ -148,8 +176,11 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P) {
         // Add the pressure correction term to the pressure field of previous time-step, P
         P += Pp;
 
-        // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
+        // Update the pressure gradient by adding the gradient of pressure correction
         Pp.gradient(pressureGradient);
+        gradP += pressureGradient;
+
+        // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
         pressureGradient *= (alphRK3(rkLev) + betaRK3(rkLev))*dt;
         V -= pressureGradient;
 
@@ -182,6 +213,10 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
     static plainsf tempSF(mesh);
 
     for (rkLev = 0; rkLev < 3; rkLev++) {
+        // Advance the time-integrated BCs, like the convective outflow BC, to the current sub-step
+        V.advanceBCs((alphRK3(rkLev) + betaRK3(rkLev))*dt);
+        T.advanceBCs((alphRK3(rkLev) + betaRK3(rkLev))*dt);
+
         nseRHS = 0.0;
         tmpRHS = 0.0;
 
@@ -208,10 +243,9 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
         V.vForcing->addForcing(tempVF);
         T.tForcing->addForcing(tempSF);
 
-        // Subtract the pressure gradient term
-        pressureGradient = 0.0;
-        P.gradient(pressureGradient);
-        tempVF -= pressureGradient;
+        // Subtract the pressure gradient term, which is maintained across sub-steps and recomputed from P only periodically
+        if (rkLev == 0) refreshGradP(P);
+        tempVF -= gradP;
 
         // Add the forcing and pressure gradient terms to the RHS with weights
         nseRHS = nseRHS.multAdd(tempVF, alphRK3(rkLev) + betaRK3(rkLev));
@@ -221,8 +255,22 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
         tempSF = 0.0;
 
         // Compute the non-linear terms for current sub-step
-        V.computeNLin(V, tempVF);
-        T.computeNLin(V, tempSF);
+        if (slAdvect) {
+            // With semi-Lagrangian advection, the grid nodes are traced back over the interval of the current sub-step
+            slAdvect->trace(V, (alphRK3(rkLev) + betaRK3(rkLev))*dt);
+            slAdvect->advect(V, tempVF);
+            slAdvect->advect(T, tempSF);
+
+            // The traced update spans the whole sub-step, and is hence added directly to the RHS instead of through the RK3 weights.
+            // Only the remaining explicit terms are weighted by gammRK3, and carried over to the next sub-step with zetaRK3
+            nseRHS = nseRHS.multAdd(tempVF, alphRK3(rkLev) + betaRK3(rkLev));
+            tmpRHS = tmpRHS.multAdd(tempSF, alphRK3(rkLev) + betaRK3(rkLev));
+            tempVF = 0.0;
+            tempSF = 0.0;
+        } else {
+            V.computeNLin(V, tempVF);
+            T.computeNLin(V, tempSF);
+        }
 
         // Add non-linear terms
         nseRHS = nseRHS.multAdd(tempVF, gammRK3(rkLev));
@@ -237,13 +285,16 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
         tmpRHS += T;
 
         // Synchronize both the RHS terms across all processors by updating their sub-domain pads
+        // The pads of tmpRHS are updated while the velocity is being computed, if the progress thread is used for communication
         nseRHS.syncData();
-        tmpRHS.syncData();
+        tmpRHS.syncStart();
 
         // Using the RHS term computed, compute the guessed velocity of CN method iteratively (and store it in V)
         solveVx(V, nseRHS, betaRK3(rkLev));
         solveVz(V, nseRHS, betaRK3(rkLev));
 
+        tmpRHS.syncFinish();
+
         // Using the RHS term computed, compute the temperature at next time-step iteratively (and store it in T)
         solveT(T, tmpRHS, betaRK3(rkLev));
 
@@ -252,7 +303,7 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
         mgRHS *= 1.0/((alphRK3(rkLev) + betaRK3(rkLev))*dt);
 
         // Using the calculated mgRHS, evaluate pressure correction (Pp) using multi-grid method
-        mgSolver.mgSolve(Pp, mgRHS);
+        mgSolver->mgSolve(Pp, mgRHS);
 
         // Synchronise the pressure correction term across processors
         Pp.syncData();
@@ -260,8 +311,11 @@ void lsRK3_d2::timeAdvance(vfield &V, sfield &P, sfield &T) {
         // Add the pressure correction term to the pressure field of previous time-step, P
         P += Pp;
 
-        // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
+        // Update the pressure gradient by adding the gradient of pressure correction
         Pp.gradient(pressureGradient);
+        gradP += pressureGradient;
+
+        // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
         pressureGradient *= (alphRK3(rkLev) + betaRK3(rkLev))*dt;
         V -= pressureGradient;
 
@@ -326,7 +380,7 @@ void lsRK3_d2::solveVx(vfield &V, plainvf &nseRHS, real beta) {
         tempVx(core) = abs(tempVx(core) - nseRHS.Vx(core));
 
         locMax = blitz::max(tempVx(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, vxSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -392,7 +446,7 @@ void lsRK3_d2::solveVz(vfield &V, plainvf &nseRHS, real beta) {
         tempVz(core) = abs(tempVz(core) - nseRHS.Vz(core));
 
         locMax = blitz::max(tempVz(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, vzSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -458,7 +512,7 @@ void lsRK3_d2::solveT(sfield &T, plainsf &tmpRHS, real beta) {
         tempT(core) = abs(tempT(core) - tmpRHS.F(core));
 
         locMax = blitz::max(tempT(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, tSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -493,3 +547,8 @@ void lsRK3_d2::setCoefficients() {
     ihx2 = 1.0/hx2;
     ihz2 = 1.0/hz2;
 };
+
+
+lsRK3_d2::~lsRK3_d2() {
+    delete mgSolver;
+}
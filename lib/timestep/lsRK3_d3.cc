@@ -56,17 +56,31 @@
  ********************************************************************************************************************************************
  */
 lsRK3_d3::lsRK3_d3(const grid &mesh, const real &sTime, const real &dt, tseries &tsIO, vfield &V, sfield &P):
-    timestep(mesh, sTime, dt, tsIO, V, P),
-    mgSolver(mesh, mesh.inputParams)
+    timestep(mesh, sTime, dt, tsIO, V, P)
 {
-    setCoefficients();
-
     // This upper limit on max iterations is an arbitrarily chosen function.
     // Using Nx x Ny x Nz as the upper limit may cause the run to freeze for very long time.
     // This can eat away a lot of core hours unnecessarily.
     // It remains to be seen if this upper limit is safe.
     maxIterations = int(std::pow(std::log(mesh.coreSize(0)*mesh.coreSize(1)*mesh.coreSize(2)), 3));
 
+    // Register the residual reductions of the implicit solvers with the communication profiler
+    vxSite = mesh.rankData.registerSite("Reduce lsRK3_d3::solveVx");
+    vySite = mesh.rankData.registerSite("Reduce lsRK3_d3::solveVy");
+    vzSite = mesh.rankData.registerSite("Reduce lsRK3_d3::solveVz");
+    tSite = mesh.rankData.registerSite("Reduce lsRK3_d3::solveT");
+
+    // Initialize the solver for the pressure Poisson equation
+    if (mesh.inputParams.pSolver == 1) {
+        if (mesh.rankData.rank == 0) {
+            std::cout << "Using direct fast diagonalisation solver for the pressure Poisson equation\n" << std::endl;
+        }
+
+        mgSolver = new fastdiag(mesh, mesh.inputParams);
+    } else {
+        mgSolver = new multigrid_d3(mesh, mesh.inputParams);
+    }
+
     // These coefficients are taken from references [2], [3] and [4] of the Journal references in README
     alphRK3 = 4.0/15.0, 1.0/15.0, 1.0/6.0;
     betaRK3 = 4.0/15.0, 1.0/15.0, 1.0/6.0;
@@ -108,6 +122,9 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P) {
     real subgridKE;
 
     for (rkLev = 0; rkLev < 3; rkLev++) {
+        // Advance the time-integrated BCs, like the convective outflow BC, to the current sub-step
+        V.advanceBCs((alphRK3(rkLev) + betaRK3(rkLev))*dt);
+
         nseRHS = 0.0;
 
         // Add the contribution from previous sub-step non-linear term
@@ -124,10 +141,9 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P) {
         // Add the velocity forcing term
         V.vForcing->addForcing(tempVF);
 
-        // Subtract the pressure gradient term
-        pressureGradient = 0.0;
-        P.gradient(pressureGradient);
-        tempVF -= pressureGradient;
+        // Subtract the pressure gradient term, which is maintained across sub-steps and recomputed from P only periodically
+        if (rkLev == 0) refreshGradP(P);
+        tempVF -= gradP;
 
         // Add the forcing and pressure gradient terms to the RHS with weights
         nseRHS = nseRHS.multAdd(tempVF, alphRK3(rkLev) + betaRK3(rkLev));
@@ -135,7 +151,18 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P) {
         tempVF = 0.0;
 
         // Compute the non-linear term for current sub-step
-        V.computeNLin(V, tempVF);
+        if (slAdvect) {
+            // With semi-Lagrangian advection, the grid nodes are traced back over the interval of the current sub-step
+            slAdvect->trace(V, (alphRK3(rkLev) + betaRK3(rkLev))*dt);
+            slAdvect->advect(V, tempVF);
+
+            // The traced update spans the whole sub-step, and is hence added directly to the RHS instead of through the RK3 weights.
+            // Only the remaining explicit terms are weighted by gammRK3, and carried over to the next sub-step with zetaRK3
+            nseRHS = nseRHS.multAdd(tempVF, alphRK3(rkLev) + betaRK3(rkLev));
+            tempVF = 0.0;
+        } else {
+            V.computeNLin(V, tempVF);
+        }
 
         // Add sub-grid stress contribution from LES Model, if enabled
         if (mesh.inputParams.lesModel and solTime > 5*mesh.inputParams.tStp) {
@@ -158,12 +185,15 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P) {
         solveVy(V, nseRHS, betaRK3(rkLev));
         solveVz(V, nseRHS, betaRK3(rkLev));
 
+        // Integrate the Coriolis term exactly over the sub-step by rotating the horizontal components of the guessed velocity, if enabled
+        if (V.vForcing->rotRate != 0.0) rotateVelocity(V, (alphRK3(rkLev) + betaRK3(rkLev))*dt);
+
         // Calculate the rhs for the poisson solver (mgRHS) using the divergence of guessed velocity in V
         V.divergence(mgRHS);
         mgRHS *= 1.0/((alphRK3(rkLev) + betaRK3(rkLev))*dt);
 
         // Using the calculated mgRHS, evaluate pressure correction (Pp) using multi-grid method
-        mgSolver.mgSolve(Pp, mgRHS);
+        mgSolver->mgSolve(Pp, mgRHS);
 
         // Synchronise the pressure correction term across processors
         Pp.syncData();
@@ -171,8 +201,11 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P) {
         // Add the pressure correction term to the pressure field of previous time-step, P
         P += Pp;
 
-        // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
+        // Update the pressure gradient by adding the gradient of pressure correction
         Pp.gradient(pressureGradient);
+        gradP += pressureGradient;
+
+        // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
         pressureGradient *= (alphRK3(rkLev) + betaRK3(rkLev))*dt;
         V -= pressureGradient;
 
@@ -201,12 +234,16 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
     static plainvf nseRHS(mesh);
     static plainvf tempVF(mesh);
 
-    static plainsf tmpRHS(mesh);
-    static plainsf tempSF(mesh);
+    static plainsf tmpRHS(*tMesh);
+    static plainsf tempSF(*tMesh);
 
     real subgridKE;
 
     for (rkLev = 0; rkLev < 3; rkLev++) {
+        // Advance the time-integrated BCs, like the convective outflow BC, to the current sub-step
+        V.advanceBCs((alphRK3(rkLev) + betaRK3(rkLev))*dt);
+        T.advanceBCs((alphRK3(rkLev) + betaRK3(rkLev))*dt);
+
         nseRHS = 0.0;
         tmpRHS = 0.0;
 
@@ -233,10 +270,9 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
         V.vForcing->addForcing(tempVF);
         T.tForcing->addForcing(tempSF);
 
-        // Subtract the pressure gradient term
-        pressureGradient = 0.0;
-        P.gradient(pressureGradient);
-        tempVF -= pressureGradient;
+        // Subtract the pressure gradient term, which is maintained across sub-steps and recomputed from P only periodically
+        if (rkLev == 0) refreshGradP(P);
+        tempVF -= gradP;
 
         // Add the forcing and pressure gradient terms to the RHS with weights
         nseRHS = nseRHS.multAdd(tempVF, alphRK3(rkLev) + betaRK3(rkLev));
@@ -246,8 +282,25 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
         tempSF = 0.0;
 
         // Compute the non-linear terms for current sub-step
-        V.computeNLin(V, tempVF);
-        T.computeNLin(V, tempSF);
+        if (slAdvect) {
+            // With semi-Lagrangian advection, the grid nodes are traced back over the interval of the current sub-step
+            slAdvect->trace(V, (alphRK3(rkLev) + betaRK3(rkLev))*dt);
+            slAdvect->advect(V, tempVF);
+        } else {
+            V.computeNLin(V, tempVF);
+        }
+
+        // The scalar is advected after the velocity, so that the semi-Lagrangian scheme can reuse its departure points
+        computeScalarNLin(V, T, tempSF, (alphRK3(rkLev) + betaRK3(rkLev))*dt);
+
+        // With semi-Lagrangian advection, the traced updates span the whole sub-step, and are hence added directly to the RHS
+        // instead of through the RK3 weights. Only the remaining explicit terms are weighted by gammRK3, and carried over with zetaRK3
+        if (slAdvect) {
+            nseRHS = nseRHS.multAdd(tempVF, alphRK3(rkLev) + betaRK3(rkLev));
+            tmpRHS = tmpRHS.multAdd(tempSF, alphRK3(rkLev) + betaRK3(rkLev));
+            tempVF = 0.0;
+            tempSF = 0.0;
+        }
 
         // Add sub-grid stress contribution from LES Model to the non-linear term, if enabled
         if (mesh.inputParams.lesModel and solTime > 5*mesh.inputParams.tStp) {
@@ -274,14 +327,20 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
         tmpRHS += T;
 
         // Synchronize both the RHS terms across all processors by updating their sub-domain pads
+        // The pads of tmpRHS are updated while the velocity is being computed, if the progress thread is used for communication
         nseRHS.syncData();
-        tmpRHS.syncData();
+        tmpRHS.syncStart();
 
         // Using the RHS term computed, compute the guessed velocity of CN method iteratively (and store it in V)
         solveVx(V, nseRHS, betaRK3(rkLev));
         solveVy(V, nseRHS, betaRK3(rkLev));
         solveVz(V, nseRHS, betaRK3(rkLev));
 
+        // Integrate the Coriolis term exactly over the sub-step by rotating the horizontal components of the guessed velocity, if enabled
+        if (V.vForcing->rotRate != 0.0) rotateVelocity(V, (alphRK3(rkLev) + betaRK3(rkLev))*dt);
+
+        tmpRHS.syncFinish();
+
         // Using the RHS term computed, compute the temperature at next time-step iteratively (and store it in T)
         solveT(T, tmpRHS, betaRK3(rkLev));
 
@@ -290,7 +349,7 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
         mgRHS *= 1.0/((alphRK3(rkLev) + betaRK3(rkLev))*dt);
 
         // Using the calculated mgRHS, evaluate pressure correction (Pp) using multi-grid method
-        mgSolver.mgSolve(Pp, mgRHS);
+        mgSolver->mgSolve(Pp, mgRHS);
 
         // Synchronise the pressure correction term across processors
         Pp.syncData();
@@ -298,8 +357,11 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
         // Add the pressure correction term to the pressure field of previous time-step, P
         P += Pp;
 
-        // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
+        // Update the pressure gradient by adding the gradient of pressure correction
         Pp.gradient(pressureGradient);
+        gradP += pressureGradient;
+
+        // Finally get the velocity field at end of time-step by subtracting the gradient of pressure correction from V
         pressureGradient *= (alphRK3(rkLev) + betaRK3(rkLev))*dt;
         V -= pressureGradient;
 
@@ -311,6 +373,9 @@ void lsRK3_d3::timeAdvance(vfield &V, sfield &P, sfield &T) {
 
         // Impose boundary conditions on the updated temperature field, T
         T.imposeBCs();
+
+        // Restrict the temperature on to the grid of the velocity, if it is solved on a refined grid
+        restrictScalar(T);
     }
 }
 
@@ -335,43 +400,18 @@ void lsRK3_d3::solveVx(vfield &V, plainvf &nseRHS, real beta) {
     static blitz::Array<real, 3> tempVx(V.Vx.F.lbound(), V.Vx.F.shape());
 
     while (true) {
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVx(iX, iY, iZ) = ((ihx2 * mesh.xix2(iX) * (V.Vx.F(iX+1, iY, iZ) + V.Vx.F(iX-1, iY, iZ)) +
-                                           i2hx * mesh.xixx(iX) * (V.Vx.F(iX+1, iY, iZ) - V.Vx.F(iX-1, iY, iZ)) +
-                                           ihy2 * mesh.ety2(iY) * (V.Vx.F(iX, iY+1, iZ) + V.Vx.F(iX, iY-1, iZ)) +
-                                           i2hy * mesh.etyy(iY) * (V.Vx.F(iX, iY+1, iZ) - V.Vx.F(iX, iY-1, iZ)) +
-                                           ihz2 * mesh.ztz2(iZ) * (V.Vx.F(iX, iY, iZ+1) + V.Vx.F(iX, iY, iZ-1)) +
-                                           i2hz * mesh.ztzz(iZ) * (V.Vx.F(iX, iY, iZ+1) - V.Vx.F(iX, iY, iZ-1))) *
-                            dt * nu * beta + nseRHS.Vx(iX, iY, iZ)) /
-               (1.0 + 2.0 * dt * nu * beta * (ihx2 * mesh.xix2(iX) + ihy2 * mesh.ety2(iY) + ihz2 * mesh.ztz2(iZ)));
-                }
-            }
-        }
+        if (mesh.inputParams.tBlock > 1) {
+            blockedJacobi(mesh, V.Vx.F, tempVx, nseRHS.Vx, dt*nu*beta);
+        } else {
+            jacobiIterate(mesh, V.Vx.F, tempVx, nseRHS.Vx, dt*nu*beta);
 
-        V.Vx.F = tempVx;
-
-        V.imposeVxBC();
-
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVx(iX, iY, iZ) = V.Vx.F(iX, iY, iZ) - beta * dt * nu * (
-                              mesh.xix2(iX) * (V.Vx.F(iX+1, iY, iZ) - 2.0 * V.Vx.F(iX, iY, iZ) + V.Vx.F(iX-1, iY, iZ)) * ihx2 +
-                              mesh.xixx(iX) * (V.Vx.F(iX+1, iY, iZ) - V.Vx.F(iX-1, iY, iZ)) * i2hx +
-                              mesh.ety2(iY) * (V.Vx.F(iX, iY+1, iZ) - 2.0 * V.Vx.F(iX, iY, iZ) + V.Vx.F(iX, iY-1, iZ)) * ihy2 +
-                              mesh.etyy(iY) * (V.Vx.F(iX, iY+1, iZ) - V.Vx.F(iX, iY-1, iZ)) * i2hy +
-                              mesh.ztz2(iZ) * (V.Vx.F(iX, iY, iZ+1) - 2.0 * V.Vx.F(iX, iY, iZ) + V.Vx.F(iX, iY, iZ-1)) * ihz2 +
-                              mesh.ztzz(iZ) * (V.Vx.F(iX, iY, iZ+1) - V.Vx.F(iX, iY, iZ-1)) * i2hz);
-                }
-            }
+            V.Vx.F = tempVx;
         }
 
-        tempVx(core) = abs(tempVx(core) - nseRHS.Vx(core));
+        V.imposeVxBC();
 
-        locMax = blitz::max(tempVx(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        locMax = jacobiResidual(mesh, V.Vx.F, nseRHS.Vx, dt*nu*beta);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, vxSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -408,43 +448,18 @@ void lsRK3_d3::solveVy(vfield &V, plainvf &nseRHS, real beta) {
     static blitz::Array<real, 3> tempVy(V.Vy.F.lbound(), V.Vy.F.shape());
 
     while (true) {
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVy(iX, iY, iZ) = ((ihx2 * mesh.xix2(iX) * (V.Vy.F(iX+1, iY, iZ) + V.Vy.F(iX-1, iY, iZ)) +
-                                           i2hx * mesh.xixx(iX) * (V.Vy.F(iX+1, iY, iZ) - V.Vy.F(iX-1, iY, iZ)) +
-                                           ihy2 * mesh.ety2(iY) * (V.Vy.F(iX, iY+1, iZ) + V.Vy.F(iX, iY-1, iZ)) +
-                                           i2hy * mesh.etyy(iY) * (V.Vy.F(iX, iY+1, iZ) - V.Vy.F(iX, iY-1, iZ)) +
-                                           ihz2 * mesh.ztz2(iZ) * (V.Vy.F(iX, iY, iZ+1) + V.Vy.F(iX, iY, iZ-1)) +
-                                           i2hz * mesh.ztzz(iZ) * (V.Vy.F(iX, iY, iZ+1) - V.Vy.F(iX, iY, iZ-1))) *
-                            dt * nu * beta + nseRHS.Vy(iX, iY, iZ)) /
-               (1.0 + 2.0 * dt * nu * beta * (ihx2 * mesh.xix2(iX) + ihy2 * mesh.ety2(iY) + ihz2 * mesh.ztz2(iZ)));
-                }
-            }
-        }
-
-        V.Vy.F = tempVy;
+        if (mesh.inputParams.tBlock > 1) {
+            blockedJacobi(mesh, V.Vy.F, tempVy, nseRHS.Vy, dt*nu*beta);
+        } else {
+            jacobiIterate(mesh, V.Vy.F, tempVy, nseRHS.Vy, dt*nu*beta);
 
-        V.imposeVyBC();
-
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVy(iX, iY, iZ) = V.Vy.F(iX, iY, iZ) - beta * dt * nu * (
-                              mesh.xix2(iX) * (V.Vy.F(iX+1, iY, iZ) - 2.0 * V.Vy.F(iX, iY, iZ) + V.Vy.F(iX-1, iY, iZ)) * ihx2 +
-                              mesh.xixx(iX) * (V.Vy.F(iX+1, iY, iZ) - V.Vy.F(iX-1, iY, iZ)) * i2hx +
-                              mesh.ety2(iY) * (V.Vy.F(iX, iY+1, iZ) - 2.0 * V.Vy.F(iX, iY, iZ) + V.Vy.F(iX, iY-1, iZ)) * ihy2 +
-                              mesh.etyy(iY) * (V.Vy.F(iX, iY+1, iZ) - V.Vy.F(iX, iY-1, iZ)) * i2hy +
-                              mesh.ztz2(iZ) * (V.Vy.F(iX, iY, iZ+1) - 2.0 * V.Vy.F(iX, iY, iZ) + V.Vy.F(iX, iY, iZ-1)) * ihz2 +
-                              mesh.ztzz(iZ) * (V.Vy.F(iX, iY, iZ+1) - V.Vy.F(iX, iY, iZ-1)) * i2hz);
-                }
-            }
+            V.Vy.F = tempVy;
         }
 
-        tempVy(core) = abs(tempVy(core) - nseRHS.Vy(core));
+        V.imposeVyBC();
 
-        locMax = blitz::max(tempVy(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        locMax = jacobiResidual(mesh, V.Vy.F, nseRHS.Vy, dt*nu*beta);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, vySite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -481,43 +496,18 @@ void lsRK3_d3::solveVz(vfield &V, plainvf &nseRHS, real beta) {
     static blitz::Array<real, 3> tempVz(V.Vz.F.lbound(), V.Vz.F.shape());
 
     while (true) {
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVz(iX, iY, iZ) = ((ihx2 * mesh.xix2(iX) * (V.Vz.F(iX+1, iY, iZ) + V.Vz.F(iX-1, iY, iZ)) +
-                                           i2hx * mesh.xixx(iX) * (V.Vz.F(iX+1, iY, iZ) - V.Vz.F(iX-1, iY, iZ)) +
-                                           ihy2 * mesh.ety2(iY) * (V.Vz.F(iX, iY+1, iZ) + V.Vz.F(iX, iY-1, iZ)) +
-                                           i2hy * mesh.etyy(iY) * (V.Vz.F(iX, iY+1, iZ) - V.Vz.F(iX, iY-1, iZ)) +
-                                           ihz2 * mesh.ztz2(iZ) * (V.Vz.F(iX, iY, iZ+1) + V.Vz.F(iX, iY, iZ-1)) +
-                                           i2hz * mesh.ztzz(iZ) * (V.Vz.F(iX, iY, iZ+1) - V.Vz.F(iX, iY, iZ-1))) *
-                            dt * nu * beta + nseRHS.Vz(iX, iY, iZ)) /
-               (1.0 + 2.0 * dt * nu * beta * (ihx2 * mesh.xix2(iX) + ihy2 * mesh.ety2(iY) + ihz2 * mesh.ztz2(iZ)));
-                }
-            }
-        }
-
-        V.Vz.F = tempVz;
+        if (mesh.inputParams.tBlock > 1) {
+            blockedJacobi(mesh, V.Vz.F, tempVz, nseRHS.Vz, dt*nu*beta);
+        } else {
+            jacobiIterate(mesh, V.Vz.F, tempVz, nseRHS.Vz, dt*nu*beta);
 
-        V.imposeVzBC();
-
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempVz(iX, iY, iZ) = V.Vz.F(iX, iY, iZ) - beta * dt * nu * (
-                              mesh.xix2(iX) * (V.Vz.F(iX+1, iY, iZ) - 2.0 * V.Vz.F(iX, iY, iZ) + V.Vz.F(iX-1, iY, iZ)) * ihx2 +
-                              mesh.xixx(iX) * (V.Vz.F(iX+1, iY, iZ) - V.Vz.F(iX-1, iY, iZ)) * i2hx +
-                              mesh.ety2(iY) * (V.Vz.F(iX, iY+1, iZ) - 2.0 * V.Vz.F(iX, iY, iZ) + V.Vz.F(iX, iY-1, iZ)) * ihy2 +
-                              mesh.etyy(iY) * (V.Vz.F(iX, iY+1, iZ) - V.Vz.F(iX, iY-1, iZ)) * i2hy +
-                              mesh.ztz2(iZ) * (V.Vz.F(iX, iY, iZ+1) - 2.0 * V.Vz.F(iX, iY, iZ) + V.Vz.F(iX, iY, iZ-1)) * ihz2 +
-                              mesh.ztzz(iZ) * (V.Vz.F(iX, iY, iZ+1) - V.Vz.F(iX, iY, iZ-1)) * i2hz);
-                }
-            }
+            V.Vz.F = tempVz;
         }
 
-        tempVz(core) = abs(tempVz(core) - nseRHS.Vz(core));
+        V.imposeVzBC();
 
-        locMax = blitz::max(tempVz(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        locMax = jacobiResidual(mesh, V.Vz.F, nseRHS.Vz, dt*nu*beta);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, vzSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -541,43 +531,18 @@ void lsRK3_d3::solveT(sfield &T, plainsf &tmpRHS, real beta) {
     static blitz::Array<real, 3> tempT(T.F.F.lbound(), T.F.F.shape());
 
     while (true) {
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempT(iX, iY, iZ) = ((ihx2 * mesh.xix2(iX) * (T.F.F(iX+1, iY, iZ) + T.F.F(iX-1, iY, iZ)) +
-                                          i2hx * mesh.xixx(iX) * (T.F.F(iX+1, iY, iZ) - T.F.F(iX-1, iY, iZ)) +
-                                          ihy2 * mesh.ety2(iY) * (T.F.F(iX, iY+1, iZ) + T.F.F(iX, iY-1, iZ)) +
-                                          i2hy * mesh.etyy(iY) * (T.F.F(iX, iY+1, iZ) - T.F.F(iX, iY-1, iZ)) +
-                                          ihz2 * mesh.ztz2(iZ) * (T.F.F(iX, iY, iZ+1) + T.F.F(iX, iY, iZ-1)) +
-                                          i2hz * mesh.ztzz(iZ) * (T.F.F(iX, iY, iZ+1) - T.F.F(iX, iY, iZ-1))) *
-                        dt * kappa * beta + tmpRHS.F(iX, iY, iZ)) /
-           (1.0 + 2.0 * dt * kappa * beta * (ihx2 * mesh.xix2(iX) + ihy2 * mesh.ety2(iY) + ihz2 * mesh.ztz2(iZ)));
-                }
-            }
-        }
-
-        T.F.F = tempT;
+        if (mesh.inputParams.tBlock > 1) {
+            blockedJacobi(*tMesh, T.F.F, tempT, tmpRHS.F, dt*kappa*beta);
+        } else {
+            jacobiIterate(*tMesh, T.F.F, tempT, tmpRHS.F, dt*kappa*beta);
 
-        T.imposeBCs();
-
-        for (int iX = xSt; iX <= xEn; iX++) {
-            for (int iY = ySt; iY <= yEn; iY++) {
-                for (int iZ = zSt; iZ <= zEn; iZ++) {
-                    tempT(iX, iY, iZ) = T.F.F(iX, iY, iZ) - beta * dt * kappa * (
-                           mesh.xix2(iX) * (T.F.F(iX+1, iY, iZ) - 2.0 * T.F.F(iX, iY, iZ) + T.F.F(iX-1, iY, iZ)) * ihx2 +
-                           mesh.xixx(iX) * (T.F.F(iX+1, iY, iZ) - T.F.F(iX-1, iY, iZ)) * i2hx +
-                           mesh.ety2(iY) * (T.F.F(iX, iY+1, iZ) - 2.0 * T.F.F(iX, iY, iZ) + T.F.F(iX, iY-1, iZ)) * ihy2 +
-                           mesh.etyy(iY) * (T.F.F(iX, iY+1, iZ) - T.F.F(iX, iY-1, iZ)) * i2hy +
-                           mesh.ztz2(iZ) * (T.F.F(iX, iY, iZ+1) - 2.0 * T.F.F(iX, iY, iZ) + T.F.F(iX, iY, iZ-1)) * ihz2 +
-                           mesh.ztzz(iZ) * (T.F.F(iX, iY, iZ+1) - T.F.F(iX, iY, iZ-1)) * i2hz);
-                }
-            }
+            T.F.F = tempT;
         }
 
-        tempT(core) = abs(tempT(core) - tmpRHS.F(core));
+        T.imposeBCs();
 
-        locMax = blitz::max(tempT(core));
-        MPI_Allreduce(&locMax, &gloMax, 1, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+        locMax = jacobiResidual(*tMesh, T.F.F, tmpRHS.F, dt*kappa*beta);
+        mesh.rankData.allReduce(&locMax, &gloMax, 1, MPI_MAX, tSite);
 
         if (gloMax < mesh.inputParams.cnTolerance) break;
 
@@ -596,22 +561,77 @@ void lsRK3_d3::solveT(sfield &T, plainsf &tmpRHS, real beta) {
 
 /**
  ********************************************************************************************************************************************
- * \brief   Function to set the coefficients used for solving the implicit equations of U, V and W
+ * \brief   Function to perform temporally blocked Jacobi iterations for the implicit diffusion equation
  *
- *          The function assigns values to the variables \ref hx, \ref hy, etc.
- *          These coefficients are repeatedly used at many places in the iterative solver for implicit calculation of velocities.
+ *          The number of iterations set by the user are applied together in a wavefront along the X direction.
+ *          Each YZ plane is updated to all the iteration levels while the few planes it depends on are still in cache,
+ *          so that the whole array is streamed through memory only once for all the iterations.
+ *          The two arrays hold alternate iteration levels, and a plane of a level is overwritten only after the planes
+ *          of the next level that depend on it have been computed.
+ *          The boundary and sub-domain pads are not updated between the iterations of a block, and the caller
+ *          imposes BCs and checks the residual after each block, so that the converged solution is unchanged.
+ *
+ * \param   gData is a const reference to the grid on which the field being solved for is defined
+ * \param   F is a reference to the array of the field being solved for, which holds the result at the end
+ * \param   tmpF is a reference to the temporary array of the same size as F
+ * \param   rhs is a const reference to the array holding the RHS of the implicit equation
+ * \param   dCoeff is the product of the time-step, diffusion constant and RK coefficient for the implicit diffusion term
  ********************************************************************************************************************************************
  */
-void lsRK3_d3::setCoefficients() {
-    real hx2 = pow(mesh.dXi, 2.0);
-    real hy2 = pow(mesh.dEt, 2.0);
-    real hz2 = pow(mesh.dZt, 2.0);
-
-    i2hx = 0.5/mesh.dXi;
-    i2hy = 0.5/mesh.dEt;
-    i2hz = 0.5/mesh.dZt;
-
-    ihx2 = 1.0/hx2;
-    ihy2 = 1.0/hy2;
-    ihz2 = 1.0/hz2;
-};
+void lsRK3_d3::blockedJacobi(const grid &gData, blitz::Array<real, 3> &F, blitz::Array<real, 3> &tmpF, const blitz::Array<real, 3> &rhs, const real dCoeff) {
+    const int nLev = gData.inputParams.tBlock;
+
+    // Both arrays must have the same pad values, as they are read alternately
+    tmpF = F;
+
+    const aview<real, 3> L(F);
+    const aview<real, 3> T(tmpF);
+    const aview<const real, 3> R(rhs);
+
+    const real ihx2 = 1.0/(gData.dXi*gData.dXi), i2hx = 0.5/gData.dXi;
+    const real ihy2 = 1.0/(gData.dEt*gData.dEt), i2hy = 0.5/gData.dEt;
+    const real ihz2 = 1.0/(gData.dZt*gData.dZt), i2hz = 0.5/gData.dZt;
+
+    const int xSt = gData.coreDomain.lbound(0), xEn = gData.coreDomain.ubound(0);
+    const int ySt = gData.coreDomain.lbound(1), yEn = gData.coreDomain.ubound(1);
+    const int zSt = gData.coreDomain.lbound(2), zEn = gData.coreDomain.ubound(2);
+
+    const aview<const real, 1> x2(gData.xix2), xx(gData.xixx);
+    const aview<const real, 1> y2(gData.ety2), yy(gData.etyy);
+    const aview<const real, 1> z2(gData.ztz2), zz(gData.ztzz);
+
+#pragma omp parallel num_threads(gData.inputParams.nThreads)
+    {
+        for (int wX = xSt; wX <= xEn + nLev - 1; wX++) {
+            for (int tLev = 0; tLev < nLev; tLev++) {
+                int iX = wX - tLev;
+                if (iX < xSt or iX > xEn) continue;
+
+                const aview<real, 3> &src = (tLev % 2)? T: L;
+                const aview<real, 3> &dst = (tLev % 2)? L: T;
+
+#pragma omp for
+                for (int iY = ySt; iY <= yEn; iY++) {
+                    for (int iZ = zSt; iZ <= zEn; iZ++) {
+                        dst(iX, iY, iZ) = ((ihx2 * x2(iX) * (src(iX+1, iY, iZ) + src(iX-1, iY, iZ)) +
+                                            i2hx * xx(iX) * (src(iX+1, iY, iZ) - src(iX-1, iY, iZ)) +
+                                            ihy2 * y2(iY) * (src(iX, iY+1, iZ) + src(iX, iY-1, iZ)) +
+                                            i2hy * yy(iY) * (src(iX, iY+1, iZ) - src(iX, iY-1, iZ)) +
+                                            ihz2 * z2(iZ) * (src(iX, iY, iZ+1) + src(iX, iY, iZ-1)) +
+                                            i2hz * zz(iZ) * (src(iX, iY, iZ+1) - src(iX, iY, iZ-1))) *
+                            dCoeff + R(iX, iY, iZ)) /
+               (1.0 + 2.0 * dCoeff * (ihx2 * x2(iX) + ihy2 * y2(iY) + ihz2 * z2(iZ)));
+                    }
+                }
+            }
+        }
+    }
+
+    // After an odd number of iterations, the latest level is in the temporary array
+    if (nLev % 2) F = tmpF;
+}
+
+
+lsRK3_d3::~lsRK3_d3() {
+    delete mgSolver;
+}
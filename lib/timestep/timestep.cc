@@ -61,7 +61,8 @@ timestep::timestep(const grid &mesh, const real &sTime, const real &dt, tseries
     Pp(mesh),
     mgRHS(mesh),
     tsWriter(tsIO),
-    pressureGradient(mesh)
+    pressureGradient(mesh),
+    gradP(mesh)
 {
     // Below flags may be turned on for debugging/dignostic runs only
     bool viscSwitch = false;
@@ -113,6 +114,23 @@ timestep::timestep(const grid &mesh, const real &sTime, const real &dt, tseries
 
     tsWriter.mDiff = nu;
     tsWriter.tDiff = kappa;
+
+    // THE SEMI-LAGRANGIAN SCHEME IS CREATED ONLY WHEN CHOSEN AS ADVECTION SCHEME, AND THE FINITE-DIFFERENCE TERMS OF vfield AND sfield ARE USED OTHERWISE
+    slAdvect = NULL;
+    if (mesh.inputParams.aScheme == 2) slAdvect = new semilag(mesh);
+
+    // BY DEFAULT, THE SCALAR IS SOLVED ON THE SAME GRID AS THE VELOCITY, AND setScalarGrid HAS TO BE CALLED TO REFINE IT
+    tMesh = &mesh;
+    tRefine = NULL;
+    tV = NULL;
+    tCoarse = NULL;
+    tAdvect = NULL;
+
+    // THE PROFILER COUNTERS OF THE IMPLICIT SOLVERS ARE REGISTERED BY THE DERIVED CLASSES, AND vySite REMAINS NULL IN 2D
+    vxSite = vySite = vzSite = tSite = NULL;
+
+    // THE PRESSURE GRADIENT IS COMPUTED FROM THE PRESSURE FIELD IN THE FIRST TIME-STEP, WHICH ALSO COVERS PRESSURE READ FROM RESTART FILES
+    gradAge = 0;
 }
 
 
@@ -137,3 +155,260 @@ void timestep::timeAdvance(vfield &V, sfield &P) { };
  ********************************************************************************************************************************************
  */
 void timestep::timeAdvance(vfield &V, sfield &P, sfield &T) { };
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to recompute the gradient of pressure from the pressure field at regular intervals
+ *
+ *          Since the pressure is updated as \f$ P = P + P' \f$ after each projection, its gradient can also be updated
+ *          by adding the gradient of pressure correction, which is anyway computed to correct the velocity.
+ *          This saves one full computation of the gradient in every time-step or sub-step.
+ *          The boundary conditions of the pressure correction and the pressure are consistent, and hence the two
+ *          differ only by the accumulated round-off, which is removed by recomputing the gradient from the pressure
+ *          field after the number of time-steps set in the YAML file.
+ *          The function must be called once at the start of each time-step.
+ *
+ * \param   P is a reference to the pressure scalar field
+ ********************************************************************************************************************************************
+ */
+void timestep::refreshGradP(sfield &P) {
+    if (gradAge == 0) {
+        gradP = 0.0;
+        P.gradient(gradP);
+    }
+
+    gradAge = (gradAge + 1) % mesh.inputParams.gpRefresh;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to integrate the Coriolis term exactly over a given interval
+ *
+ *          Over an interval \f$ \tau \f$, the Coriolis term alone rotates the horizontal velocity by an angle \f$ f\tau \f$,
+ *          where \f$ f \f$ is the rate of rotation set by the velocity forcing.
+ *          The rotation is applied to the guessed velocity before the pressure correction, so that the divergence it
+ *          introduces is removed by the projection.
+ *          Unlike the explicit Coriolis term, the rotation is stable for any time-step, so that the time-step is limited
+ *          by advection alone even when the period of inertial waves is much shorter.
+ *          Since the rotation is applied point-wise, the pads of the velocity field remain consistent with the core.
+ *
+ * \param   V is a reference to the velocity vector field whose horizontal components are rotated
+ * \param   tau is the interval over which the Coriolis term is integrated
+ ********************************************************************************************************************************************
+ */
+void timestep::rotateVelocity(vfield &V, const real tau) {
+    const real cosTh = cos(V.vForcing->rotRate*tau);
+    const real sinTh = sin(V.vForcing->rotRate*tau);
+
+    const aview<real, 3> U(V.Vx.F), W(V.Vy.F);
+
+#pragma omp parallel for num_threads(mesh.inputParams.nThreads)
+    for (int iX = U.lbound(0); iX <= U.ubound(0); iX++) {
+        for (int iY = U.lbound(1); iY <= U.ubound(1); iY++) {
+            for (int iZ = U.lbound(2); iZ <= U.ubound(2); iZ++) {
+                const real uOld = U(iX, iY, iZ);
+
+                U(iX, iY, iZ) = cosTh*uOld + sinTh*W(iX, iY, iZ);
+                W(iX, iY, iZ) = cosTh*W(iX, iY, iZ) - sinTh*uOld;
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to set a refined grid on which the scalar field is solved
+ *
+ *          The scalar field passed to the timeAdvance function must be defined on the grid sMesh after this function is called.
+ *          The velocity is interpolated from mesh on to sMesh to compute the advection term of the scalar, and the scalar is
+ *          restricted back on to mesh after each (sub-)step, so that coarseT always holds the scalar at the end of the step.
+ *          This allows the buoyancy force and all I/O to use coarseT, while the thin boundary layers and fine filaments of
+ *          a weakly diffusive scalar are resolved on sMesh.
+ *
+ * \param   sMesh is a const reference to the refined grid on which the scalar is solved
+ * \param   coarseT is a reference to the scalar field on mesh into which the solution is restricted
+ ********************************************************************************************************************************************
+ */
+void timestep::setScalarGrid(const grid &sMesh, sfield &coarseT) {
+    tMesh = &sMesh;
+    tCoarse = &coarseT;
+
+    tRefine = new refine(mesh, sMesh);
+    tV = new vfield(sMesh, "V");
+
+    if (slAdvect) tAdvect = new semilag(sMesh);
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the advection term of the scalar equation
+ *
+ *          When the scalar is solved on a refined grid, the velocity is first interpolated on to it, and the advection term
+ *          is computed with this velocity.
+ *          With the semi-Lagrangian scheme, the nodes of the refined grid are traced back separately over the given interval.
+ *          Otherwise, the departure points already traced for the velocity over the same interval are used.
+ *
+ * \param   V is a const reference to the velocity field on mesh
+ * \param   T is a reference to the scalar field being advected
+ * \param   H is a reference to the plain scalar field from which the advection term is subtracted
+ * \param   tau is the interval over which the semi-Lagrangian scheme traces the nodes back
+ ********************************************************************************************************************************************
+ */
+void timestep::computeScalarNLin(const vfield &V, sfield &T, plainsf &H, const real tau) {
+    if (tRefine) {
+        tRefine->prolong(V.Vx.F, tV->Vx.F);
+        tRefine->prolong(V.Vy.F, tV->Vy.F);
+        tRefine->prolong(V.Vz.F, tV->Vz.F);
+
+        // THE FIRST LAYER OF PADS IS SET BY THE INTERPOLATION, AND DEEPER PADS ARE NEEDED ONLY BY THE SEMI-LAGRANGIAN SCHEME
+        if (tAdvect) {
+            tV->syncData();
+
+            tAdvect->trace(*tV, tau);
+            tAdvect->advect(T, H);
+        } else {
+            T.computeNLin(*tV, H);
+        }
+    } else {
+        if (slAdvect) {
+            slAdvect->advect(T, H);
+        } else {
+            T.computeNLin(V, H);
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to restrict the scalar field solved on the refined grid on to mesh
+ *
+ *          The function does nothing if the scalar is solved on mesh itself.
+ *          The boundary conditions of the restricted field are imposed after the transfer.
+ *
+ * \param   T is a reference to the scalar field solved on the refined grid
+ ********************************************************************************************************************************************
+ */
+void timestep::restrictScalar(sfield &T) {
+    if (tRefine) {
+        tRefine->coarsen(T.F.F, tCoarse->F.F);
+        tCoarse->imposeBCs();
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to perform one Jacobi iteration for the implicit diffusion equation
+ *
+ *          The new estimate of the solution is computed over the core from the current estimate in F, and written into tmpF.
+ *          The arrays are accessed through views so that the stencil reduces to simple offsets from a pointer.
+ *
+ * \param   gData is a const reference to the grid on which the field being solved for is defined
+ * \param   F is a const reference to the array holding the current estimate of the field being solved for
+ * \param   tmpF is a reference to the array into which the new estimate is written
+ * \param   rhs is a const reference to the array holding the RHS of the implicit equation
+ * \param   dCoeff is the factor multiplying the Laplacian in the implicit equation
+ ********************************************************************************************************************************************
+ */
+void timestep::jacobiIterate(const grid &gData, const blitz::Array<real, 3> &F, blitz::Array<real, 3> &tmpF, const blitz::Array<real, 3> &rhs, const real dCoeff) {
+    const aview<const real, 3> src(F);
+    const aview<real, 3> dst(tmpF);
+    const aview<const real, 3> R(rhs);
+
+    const real ihx2 = 1.0/(gData.dXi*gData.dXi), i2hx = 0.5/gData.dXi;
+    const real ihy2 = 1.0/(gData.dEt*gData.dEt), i2hy = 0.5/gData.dEt;
+    const real ihz2 = 1.0/(gData.dZt*gData.dZt), i2hz = 0.5/gData.dZt;
+
+    const int xSt = gData.coreDomain.lbound(0), xEn = gData.coreDomain.ubound(0);
+    const int ySt = gData.coreDomain.lbound(1), yEn = gData.coreDomain.ubound(1);
+    const int zSt = gData.coreDomain.lbound(2), zEn = gData.coreDomain.ubound(2);
+
+    const aview<const real, 1> x2(gData.xix2), xx(gData.xixx);
+    const aview<const real, 1> y2(gData.ety2), yy(gData.etyy);
+    const aview<const real, 1> z2(gData.ztz2), zz(gData.ztzz);
+
+#pragma omp parallel for num_threads(gData.inputParams.nThreads)
+    for (int iX = xSt; iX <= xEn; iX++) {
+        for (int iY = ySt; iY <= yEn; iY++) {
+            for (int iZ = zSt; iZ <= zEn; iZ++) {
+                dst(iX, iY, iZ) = ((ihx2 * x2(iX) * (src(iX+1, iY, iZ) + src(iX-1, iY, iZ)) +
+                                    i2hx * xx(iX) * (src(iX+1, iY, iZ) - src(iX-1, iY, iZ)) +
+                                    ihy2 * y2(iY) * (src(iX, iY+1, iZ) + src(iX, iY-1, iZ)) +
+                                    i2hy * yy(iY) * (src(iX, iY+1, iZ) - src(iX, iY-1, iZ)) +
+                                    ihz2 * z2(iZ) * (src(iX, iY, iZ+1) + src(iX, iY, iZ-1)) +
+                                    i2hz * zz(iZ) * (src(iX, iY, iZ+1) - src(iX, iY, iZ-1))) *
+                    dCoeff + R(iX, iY, iZ)) /
+       (1.0 + 2.0 * dCoeff * (ihx2 * x2(iX) + ihy2 * y2(iY) + ihz2 * z2(iZ)));
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the maximum error in the solution of the implicit diffusion equation
+ *
+ *          The residual of the implicit equation is computed over the core of the local sub-domain, and its maximum
+ *          absolute value is found in the same loop, without storing the residual in a temporary array.
+ *          The global maximum has to be found by the caller through MPI reduction.
+ *
+ * \param   gData is a const reference to the grid on which the field being solved for is defined
+ * \param   F is a const reference to the array holding the current estimate of the field being solved for
+ * \param   rhs is a const reference to the array holding the RHS of the implicit equation
+ * \param   dCoeff is the factor multiplying the Laplacian in the implicit equation
+ *
+ * \return  The maximum absolute value of the residual in the local sub-domain
+ ********************************************************************************************************************************************
+ */
+real timestep::jacobiResidual(const grid &gData, const blitz::Array<real, 3> &F, const blitz::Array<real, 3> &rhs, const real dCoeff) {
+    real maxError = 0.0;
+
+    const aview<const real, 3> src(F);
+    const aview<const real, 3> R(rhs);
+
+    const real ihx2 = 1.0/(gData.dXi*gData.dXi), i2hx = 0.5/gData.dXi;
+    const real ihy2 = 1.0/(gData.dEt*gData.dEt), i2hy = 0.5/gData.dEt;
+    const real ihz2 = 1.0/(gData.dZt*gData.dZt), i2hz = 0.5/gData.dZt;
+
+    const int xSt = gData.coreDomain.lbound(0), xEn = gData.coreDomain.ubound(0);
+    const int ySt = gData.coreDomain.lbound(1), yEn = gData.coreDomain.ubound(1);
+    const int zSt = gData.coreDomain.lbound(2), zEn = gData.coreDomain.ubound(2);
+
+    const aview<const real, 1> x2(gData.xix2), xx(gData.xixx);
+    const aview<const real, 1> y2(gData.ety2), yy(gData.etyy);
+    const aview<const real, 1> z2(gData.ztz2), zz(gData.ztzz);
+
+#pragma omp parallel for num_threads(gData.inputParams.nThreads) reduction(max: maxError)
+    for (int iX = xSt; iX <= xEn; iX++) {
+        for (int iY = ySt; iY <= yEn; iY++) {
+            for (int iZ = zSt; iZ <= zEn; iZ++) {
+                const real error = fabs(src(iX, iY, iZ) - dCoeff * (
+                          x2(iX) * (src(iX+1, iY, iZ) - 2.0 * src(iX, iY, iZ) + src(iX-1, iY, iZ)) * ihx2 +
+                          xx(iX) * (src(iX+1, iY, iZ) - src(iX-1, iY, iZ)) * i2hx +
+                          y2(iY) * (src(iX, iY+1, iZ) - 2.0 * src(iX, iY, iZ) + src(iX, iY-1, iZ)) * ihy2 +
+                          yy(iY) * (src(iX, iY+1, iZ) - src(iX, iY-1, iZ)) * i2hy +
+                          z2(iZ) * (src(iX, iY, iZ+1) - 2.0 * src(iX, iY, iZ) + src(iX, iY, iZ-1)) * ihz2 +
+                          zz(iZ) * (src(iX, iY, iZ+1) - src(iX, iY, iZ-1)) * i2hz) - R(iX, iY, iZ));
+
+                if (error > maxError) maxError = error;
+            }
+        }
+    }
+
+    return maxError;
+}
+
+
+timestep::~timestep() {
+    if (slAdvect) delete slAdvect;
+
+    if (tRefine) delete tRefine;
+    if (tV) delete tV;
+    if (tAdvect) delete tAdvect;
+}
@@ -47,6 +47,8 @@
 #include "tseries.h"
 #include "force.h"
 #include "les.h"
+#include "semilag.h"
+#include "refine.h"
 
 class timestep {
     public:
@@ -57,6 +59,10 @@ class timestep {
         virtual void timeAdvance(vfield &V, sfield &P);
         virtual void timeAdvance(vfield &V, sfield &P, sfield &T);
 
+        void setScalarGrid(const grid &sMesh, sfield &coarseT);
+
+        virtual ~timestep();
+
     protected:
         // Const references to the time and time-step variables in the main solver.
         // These values can only be read by this class and not modified
@@ -80,6 +86,42 @@ class timestep {
 
         /** Plain vector field which stores the pressure gradient term. */
         plainvf pressureGradient;
+
+        /** Gradient of the pressure field, kept across time-steps by adding the gradient of the pressure correction after each projection */
+        plainvf gradP;
+
+        /** Number of time-steps since gradP was last computed from the pressure field */
+        int gradAge;
+
+        /** Semi-Lagrangian scheme used in place of the finite-difference advection terms, if enabled in the YAML file. NULL otherwise */
+        semilag *slAdvect;
+
+        /** Grid on which the scalar field is solved. It is the same as mesh, unless a refined grid is set for the scalar */
+        const grid *tMesh;
+
+        /** Transfers data between mesh and tMesh when the scalar is solved on a refined grid. NULL otherwise */
+        refine *tRefine;
+
+        /** Velocity field interpolated on to the refined grid of the scalar, used to compute its advection term */
+        vfield *tV;
+
+        /** Scalar field on mesh, into which the scalar solved on the refined grid is restricted after each (sub-)step */
+        sfield *tCoarse;
+
+        /** Semi-Lagrangian scheme on the refined grid of the scalar, if enabled in the YAML file. NULL otherwise */
+        semilag *tAdvect;
+
+        /** Counters of the profiler under which the residual reductions of the implicit solvers are recorded. NULL if profiling is disabled */
+        commprof::counter *vxSite, *vySite, *vzSite, *tSite;
+
+        void refreshGradP(sfield &P);
+        void rotateVelocity(vfield &V, const real tau);
+
+        void computeScalarNLin(const vfield &V, sfield &T, plainsf &H, const real tau);
+        void restrictScalar(sfield &T);
+
+        void jacobiIterate(const grid &gData, const blitz::Array<real, 3> &F, blitz::Array<real, 3> &tmpF, const blitz::Array<real, 3> &rhs, const real dCoeff);
+        real jacobiResidual(const grid &gData, const blitz::Array<real, 3> &F, const blitz::Array<real, 3> &rhs, const real dCoeff);
 };
 
 /**
@@ -97,6 +139,8 @@ class eulerCN_d2: public timestep {
         void timeAdvance(vfield &V, sfield &P);
         void timeAdvance(vfield &V, sfield &P, sfield &T);
 
+        ~eulerCN_d2();
+
     private:
         /** Maximum number of iterations for the iterative solvers solveVx, solveVy and solveVz */
         int maxIterations;
@@ -104,7 +148,7 @@ class eulerCN_d2: public timestep {
         real ihx2, ihz2;
         real i2hx, i2hz;
 
-        multigrid_d2 mgSolver;
+        poisson *mgSolver;
 
         void solveVx(vfield &V, plainvf &nseRHS);
         void solveVz(vfield &V, plainvf &nseRHS);
@@ -129,14 +173,13 @@ class eulerCN_d3: public timestep {
         void timeAdvance(vfield &V, sfield &P);
         void timeAdvance(vfield &V, sfield &P, sfield &T);
 
+        ~eulerCN_d3();
+
     private:
         /** Maximum number of iterations for the iterative solvers solveVx, solveVy and solveVz */
         int maxIterations;
 
-        real ihx2, ihy2, ihz2;
-        real i2hx, i2hy, i2hz;
-
-        multigrid_d3 mgSolver;
+        poisson *mgSolver;
 
         les *sgsLES;
 
@@ -145,8 +188,6 @@ class eulerCN_d3: public timestep {
         void solveVz(vfield &V, plainvf &nseRHS);
 
         void solveT(sfield &T, plainsf &tmpRHS);
-
-        void setCoefficients();
 };
 
 /**
@@ -164,6 +205,8 @@ class lsRK3_d2: public timestep {
         void timeAdvance(vfield &V, sfield &P);
         void timeAdvance(vfield &V, sfield &P, sfield &T);
 
+        ~lsRK3_d2();
+
     private:
         /** Maximum number of iterations for the iterative solvers solveVx, solveVy and solveVz */
         int maxIterations;
@@ -173,7 +216,7 @@ class lsRK3_d2: public timestep {
 
         blitz::TinyVector<real, 3> alphRK3, betaRK3, zetaRK3, gammRK3;
 
-        multigrid_d2 mgSolver;
+        poisson *mgSolver;
 
         void solveVx(vfield &V, plainvf &nseRHS, real beta);
         void solveVz(vfield &V, plainvf &nseRHS, real beta);
@@ -198,16 +241,15 @@ class lsRK3_d3: public timestep {
         void timeAdvance(vfield &V, sfield &P);
         void timeAdvance(vfield &V, sfield &P, sfield &T);
 
+        ~lsRK3_d3();
+
     private:
         /** Maximum number of iterations for the iterative solvers solveVx, solveVy and solveVz */
         int maxIterations;
 
-        real ihx2, ihy2, ihz2;
-        real i2hx, i2hy, i2hz;
-
         blitz::TinyVector<real, 3> alphRK3, betaRK3, zetaRK3, gammRK3;
 
-        multigrid_d3 mgSolver;
+        poisson *mgSolver;
 
         les *sgsLES;
 
@@ -217,7 +259,7 @@ class lsRK3_d3: public timestep {
 
         void solveT(sfield &T, plainsf &tmpRHS, real beta);
 
-        void setCoefficients();
+        void blockedJacobi(const grid &gData, blitz::Array<real, 3> &F, blitz::Array<real, 3> &tmpF, const blitz::Array<real, 3> &rhs, const real dCoeff);
 };
 
 /**
@@ -0,0 +1,305 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file brickBench.cc
+ *
+ *  \brief Benchmark of stencil kernels on data stored in the default row-major layout and in the brick layout.
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include <iostream>
+#include <iomanip>
+#include "parallel.h"
+#include "parser.h"
+#include "grid.h"
+#include "brick.h"
+
+// NUMBER OF TIMES EACH KERNEL IS CALLED TO MEASURE ITS AVERAGE TIME
+static const int benchCount = 20;
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the derivative of a row-major array along one direction
+ *
+ *          The same expression as brick::centralDiff is used, so that only the memory layout differs between the two.
+ *
+ * \param   F is a const reference to the array to be differentiated
+ * \param   out is a reference to the array into which the derivative is written
+ * \param   core is the RectDomain object specifying the points at which the derivative is computed
+ * \param   dim is the direction along which the derivative is computed
+ * \param   c1 is the coefficient of the central difference along dim
+ * \param   c2 is the coefficient of the second difference along dim
+ * \param   nThreads is the number of OpenMP threads used by the kernel
+ ********************************************************************************************************************************************
+ */
+static void rowMajorDiff(const blitz::Array<real, 3> &F, blitz::Array<real, 3> &out, const blitz::RectDomain<3> &core, const int dim,
+                         const blitz::Array<real, 1> &c1, const blitz::Array<real, 1> &c2, const int nThreads) {
+    const int di = (dim == 0), dj = (dim == 1), dk = (dim == 2);
+
+#pragma omp parallel for num_threads(nThreads)
+    for (int i = core.lbound(0); i <= core.ubound(0); ++i) {
+        for (int j = core.lbound(1); j <= core.ubound(1); ++j) {
+            for (int k = core.lbound(2); k <= core.ubound(2); ++k) {
+                const int l = di*i + dj*j + dk*k;
+
+                out(i, j, k) = c2(l)*(F(i + di, j + dj, k + dk) - 2.0*F(i, j, k) + F(i - di, j - dj, k - dk)) +
+                               c1(l)*(F(i + di, j + dj, k + dk) - F(i - di, j - dj, k - dk));
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to perform one Jacobi iteration of the Laplacian on a row-major array
+ *
+ *          The loop is the same as the one used for Jacobi smoothing in multigrid_d3::smooth().
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   lhs is a const reference to the array holding data from the previous iteration
+ * \param   rhs is a const reference to the array holding the right-hand side
+ * \param   out is a reference to the array into which the updated values are written
+ ********************************************************************************************************************************************
+ */
+static void rowMajorJacobi(const grid &mesh, const blitz::Array<real, 3> &lhs, const blitz::Array<real, 3> &rhs, blitz::Array<real, 3> &out) {
+    const real ihx2 = 1.0/(mesh.dXi*mesh.dXi), i2hx = 0.5/mesh.dXi;
+    const real ihy2 = 1.0/(mesh.dEt*mesh.dEt), i2hy = 0.5/mesh.dEt;
+    const real ihz2 = 1.0/(mesh.dZt*mesh.dZt), i2hz = 0.5/mesh.dZt;
+
+#pragma omp parallel for num_threads(mesh.inputParams.nThreads)
+    for (int i = mesh.coreDomain.lbound(0); i <= mesh.coreDomain.ubound(0); ++i) {
+        for (int j = mesh.coreDomain.lbound(1); j <= mesh.coreDomain.ubound(1); ++j) {
+            for (int k = mesh.coreDomain.lbound(2); k <= mesh.coreDomain.ubound(2); ++k) {
+                out(i, j, k) = (mesh.xix2(i) * ihx2 * (lhs(i + 1, j, k) + lhs(i - 1, j, k)) +
+                                mesh.xixx(i) * i2hx * (lhs(i + 1, j, k) - lhs(i - 1, j, k)) +
+                                mesh.ety2(j) * ihy2 * (lhs(i, j + 1, k) + lhs(i, j - 1, k)) +
+                                mesh.etyy(j) * i2hy * (lhs(i, j + 1, k) - lhs(i, j - 1, k)) +
+                                mesh.ztz2(k) * ihz2 * (lhs(i, j, k + 1) + lhs(i, j, k - 1)) +
+                                mesh.ztzz(k) * i2hz * (lhs(i, j, k + 1) - lhs(i, j, k - 1)) -
+                                 rhs(i, j, k)) / (2.0 * (ihx2*mesh.xix2(i) + ihy2*mesh.ety2(j) + ihz2*mesh.ztz2(k)));
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to print the timings of a kernel on both layouts along with the difference between their results
+ *
+ *          The times are maximum over all ranks, and the difference is the maximum absolute difference over all ranks.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   kernelName is the name of the kernel printed in the first column
+ * \param   rmTime is the average time per call of the kernel on the row-major layout in the local rank
+ * \param   bkTime is the average time per call of the kernel on the brick layout in the local rank
+ * \param   outRM is a const reference to the result of the kernel on the row-major layout
+ * \param   outBK is a const reference to the result of the kernel on the brick layout, copied back to a row-major array
+ ********************************************************************************************************************************************
+ */
+static void printResult(const grid &mesh, const std::string kernelName, real rmTime, real bkTime,
+                        const blitz::Array<real, 3> &outRM, const blitz::Array<real, 3> &outBK) {
+    real localVals[3], globalVals[3];
+
+    localVals[0] = rmTime;
+    localVals[1] = bkTime;
+    localVals[2] = blitz::max(fabs(outRM(mesh.coreDomain) - outBK(mesh.coreDomain)));
+
+    MPI_Allreduce(localVals, globalVals, 3, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+
+    if (mesh.rankData.rank == 0) {
+        std::cout << std::left << std::setw(28) << kernelName << std::right << std::scientific << std::setprecision(4)
+                  << std::setw(16) << globalVals[0] << std::setw(16) << globalVals[1]
+                  << std::fixed << std::setprecision(3) << std::setw(12) << globalVals[0]/globalVals[1]
+                  << std::scientific << std::setprecision(4) << std::setw(16) << globalVals[2] << std::endl;
+    }
+}
+
+
+int main() {
+    real tStart, rmTime, bkTime;
+
+    // INITIALIZE MPI
+    MPI_Init(NULL, NULL);
+
+    // ALL PROCESSES READ THE INPUT PARAMETERS
+    parser inputParams;
+
+    // INITIALIZE PARALLELIZATION DATA
+    parallel mpi(inputParams);
+
+#ifdef PLANAR
+    if (mpi.rank == 0) std::cout << "ERROR: The brick layout benchmark is available only for 3D runs. Aborting" << std::endl;
+    MPI_Finalize();
+    exit(0);
+#endif
+
+    // INITIALIZE GRID DATA
+    grid mesh(inputParams, mpi);
+
+    const blitz::RectDomain<3> &core = mesh.coreDomain;
+    const blitz::RectDomain<3> &full = mesh.fullDomain;
+
+    blitz::TinyVector<int, 3> dSize = full.ubound() - full.lbound() + 1;
+    blitz::TinyVector<int, 3> dlBnd = full.lbound();
+
+    blitz::firstIndex i;
+    blitz::secondIndex j;
+    blitz::thirdIndex k;
+
+    // SMOOTH TEST DATA WITH NON-ZERO DERIVATIVES ALONG ALL DIRECTIONS
+    blitz::Array<real, 3> F(dSize), rhs(dSize), outRM(dSize), outBK(dSize);
+    F.reindexSelf(dlBnd);
+    rhs.reindexSelf(dlBnd);
+    outRM.reindexSelf(dlBnd);
+    outBK.reindexSelf(dlBnd);
+
+    F = sin(2.0*M_PI*mesh.x(i)/mesh.xLen)*cos(2.0*M_PI*mesh.y(j)/mesh.yLen)*sin(M_PI*mesh.z(k)/mesh.zLen);
+    rhs = F*F;
+    outRM = 0.0;
+    outBK = 0.0;
+
+    brick fBrick(full.lbound(), full.ubound());
+    brick rBrick(full.lbound(), full.ubound());
+    brick oBrick(full.lbound(), full.ubound());
+
+    fBrick.fromArray(F, full);
+    rBrick.fromArray(rhs, full);
+
+    // COEFFICIENTS OF FIRST AND SECOND DERIVATIVES, AND OF THE JACOBI ITERATION, ALONG EACH DIRECTION
+    const blitz::Array<real, 1> *m1[3] = {&mesh.xi_x, &mesh.et_y, &mesh.zt_z};
+    const blitz::Array<real, 1> *m2[3] = {&mesh.xixx, &mesh.etyy, &mesh.ztzz};
+    const blitz::Array<real, 1> *mS[3] = {&mesh.xix2, &mesh.ety2, &mesh.ztz2};
+    const real h[3] = {mesh.dXi, mesh.dEt, mesh.dZt};
+
+    blitz::Array<blitz::Array<real, 1>, 1> d1C1(3), d1C2(3), d2C1(3), d2C2(3), cM(3), cP(3), cD(3);
+    for (int dim = 0; dim < 3; ++dim) {
+        d1C1(dim).resize(m1[dim]->shape());     d1C1(dim).reindexSelf(m1[dim]->lbound());
+        d1C2(dim).resize(m1[dim]->shape());     d1C2(dim).reindexSelf(m1[dim]->lbound());
+        d2C1(dim).resize(m1[dim]->shape());     d2C1(dim).reindexSelf(m1[dim]->lbound());
+        d2C2(dim).resize(m1[dim]->shape());     d2C2(dim).reindexSelf(m1[dim]->lbound());
+        cM(dim).resize(m1[dim]->shape());       cM(dim).reindexSelf(m1[dim]->lbound());
+        cP(dim).resize(m1[dim]->shape());       cP(dim).reindexSelf(m1[dim]->lbound());
+        cD(dim).resize(m1[dim]->shape());       cD(dim).reindexSelf(m1[dim]->lbound());
+
+        d1C1(dim) = *m1[dim]*0.5/h[dim];
+        d1C2(dim) = 0.0;
+
+        d2C1(dim) = *m2[dim]*0.5/h[dim];
+        d2C2(dim) = *mS[dim]/(h[dim]*h[dim]);
+
+        cM(dim) = *mS[dim]/(h[dim]*h[dim]) - *m2[dim]*0.5/h[dim];
+        cP(dim) = *mS[dim]/(h[dim]*h[dim]) + *m2[dim]*0.5/h[dim];
+        cD(dim) = 2.0*(*mS[dim])/(h[dim]*h[dim]);
+    }
+
+    if (mpi.rank == 0) {
+        std::cout << std::endl << "Average time per call over " << benchCount << " calls, with brick size " << brick::bSize << std::endl << std::endl;
+        std::cout << std::left << std::setw(28) << "Kernel" << std::right << std::setw(16) << "Row-major (s)" << std::setw(16) << "Brick (s)"
+                  << std::setw(12) << "Speed-up" << std::setw(16) << "Max. Difference" << std::endl;
+    }
+
+    // FIRST AND SECOND DERIVATIVES ALONG EACH DIRECTION
+    const std::string dirName[3] = {"X", "Y", "Z"};
+    for (int dim = 0; dim < 3; ++dim) {
+        tStart = MPI_Wtime();
+        for (int n = 0; n < benchCount; ++n) rowMajorDiff(F, outRM, core, dim, d1C1(dim), d1C2(dim), inputParams.nThreads);
+        rmTime = (MPI_Wtime() - tStart)/benchCount;
+
+        tStart = MPI_Wtime();
+        for (int n = 0; n < benchCount; ++n) oBrick.centralDiff(fBrick, core, dim, d1C1(dim), d1C2(dim), inputParams.nThreads);
+        bkTime = (MPI_Wtime() - tStart)/benchCount;
+
+        oBrick.toArray(outBK, core);
+        printResult(mesh, "First derivative along " + dirName[dim], rmTime, bkTime, outRM, outBK);
+    }
+
+    for (int dim = 0; dim < 3; ++dim) {
+        tStart = MPI_Wtime();
+        for (int n = 0; n < benchCount; ++n) rowMajorDiff(F, outRM, core, dim, d2C1(dim), d2C2(dim), inputParams.nThreads);
+        rmTime = (MPI_Wtime() - tStart)/benchCount;
+
+        tStart = MPI_Wtime();
+        for (int n = 0; n < benchCount; ++n) oBrick.centralDiff(fBrick, core, dim, d2C1(dim), d2C2(dim), inputParams.nThreads);
+        bkTime = (MPI_Wtime() - tStart)/benchCount;
+
+        oBrick.toArray(outBK, core);
+        printResult(mesh, "Second derivative along " + dirName[dim], rmTime, bkTime, outRM, outBK);
+    }
+
+    // JACOBI ITERATION OF THE MULTIGRID SMOOTHER
+    tStart = MPI_Wtime();
+    for (int n = 0; n < benchCount; ++n) rowMajorJacobi(mesh, F, rhs, outRM);
+    rmTime = (MPI_Wtime() - tStart)/benchCount;
+
+    tStart = MPI_Wtime();
+    for (int n = 0; n < benchCount; ++n) oBrick.jacobiSweep(fBrick, rBrick, core, cM, cP, cD, inputParams.nThreads);
+    bkTime = (MPI_Wtime() - tStart)/benchCount;
+
+    oBrick.toArray(outBK, core);
+    printResult(mesh, "Multigrid Jacobi sweep", rmTime, bkTime, outRM, outBK);
+
+    // COST OF THE HALO KERNELS AND OF CONVERTING BETWEEN THE TWO LAYOUTS, WHICH IS NOT NEEDED WITH ROW-MAJOR DATA
+    tStart = MPI_Wtime();
+    for (int n = 0; n < benchCount; ++n) {
+        fBrick.writeFaces(outBK, core);
+        fBrick.readPads(F, core);
+    }
+    bkTime = (MPI_Wtime() - tStart)/benchCount;
+
+    tStart = MPI_Wtime();
+    for (int n = 0; n < benchCount; ++n) {
+        fBrick.fromArray(F, full);
+        fBrick.toArray(outBK, full);
+    }
+    rmTime = (MPI_Wtime() - tStart)/benchCount;
+
+    real localVals[2] = {bkTime, rmTime}, globalVals[2];
+    MPI_Allreduce(localVals, globalVals, 2, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+
+    if (mpi.rank == 0) {
+        std::cout << std::endl;
+        std::cout << "Time for halo update of brick layout (faces out, pads in): " << std::scientific << std::setprecision(4) << globalVals[0] << std::endl;
+        std::cout << "Time for full conversion to and from brick layout:         " << std::scientific << std::setprecision(4) << globalVals[1] << std::endl;
+        std::cout << std::endl;
+    }
+
+    // FINALIZE AND CLEAN-UP
+    MPI_Finalize();
+
+    return 0;
+}
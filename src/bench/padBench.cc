@@ -0,0 +1,188 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file padBench.cc
+ *
+ *  \brief Benchmark of a stencil kernel on arrays allocated with and without extra points padded to their storage.
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include <iostream>
+#include <iomanip>
+#include "parallel.h"
+#include "parser.h"
+#include "grid.h"
+#include "aview.h"
+
+// NUMBER OF TIMES THE KERNEL IS CALLED TO MEASURE ITS AVERAGE TIME
+static const int benchCount = 10;
+
+// SIZES OF THE LOCAL BLOCKS ON WHICH THE KERNEL IS TIMED - THE POWERS OF 2 ARE THE SIZES MOST PRONE TO CACHE CONFLICTS
+static const int numBlocks = 3;
+static const int blockSizes[numBlocks] = {128, 256, 512};
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to perform one Jacobi iteration of the 7-point Laplacian on a uniform grid
+ *
+ *          The kernel reads the rows (i, j +/- 1) and planes (i +/- 1, j) of the input array in each iteration of the innermost loop.
+ *          When the storage sizes are powers of 2, these rows map to the same cache sets, which is what the padding is meant to avoid.
+ *
+ * \param   lhs is a const reference to the array holding data from the previous iteration
+ * \param   rhs is a const reference to the array holding the right-hand side
+ * \param   out is a reference to the array into which the updated values are written
+ * \param   n is the number of core points of the block along each direction
+ * \param   nThreads is the number of OpenMP threads used by the kernel
+ ********************************************************************************************************************************************
+ */
+static void jacobiSweep(const blitz::Array<real, 3> &lhs, const blitz::Array<real, 3> &rhs, blitz::Array<real, 3> &out, const int n, const int nThreads) {
+    const aview<const real, 3> L(lhs), R(rhs);
+    const aview<real, 3> T(out);
+
+    const int sX = L.stride(0), sY = L.stride(1);
+    const real h = 1.0/n;
+    const real ih2 = 1.0/(h*h);
+    const real iDiag = 1.0/(6.0*ih2);
+
+#pragma omp parallel for num_threads(nThreads)
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            const real *lRow = L.row(i, j);
+            const real *rRow = R.row(i, j);
+            real *tRow = T.row(i, j);
+
+            for (int k = 0; k < n; ++k) {
+                tRow[k] = (ih2*(lRow[k + sX] + lRow[k - sX] + lRow[k + sY] + lRow[k - sY] + lRow[k + 1] + lRow[k - 1]) - rRow[k])*iDiag;
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to allocate and initialize the arrays of one block with the given padding
+ *
+ * \param   lhs is a reference to the array holding the initial guess
+ * \param   rhs is a reference to the array holding the right-hand side
+ * \param   out is a reference to the array into which the result of the kernel is written
+ * \param   n is the number of core points of the block along each direction
+ * \param   aPads is the number of extra points added to the storage along each direction
+ ********************************************************************************************************************************************
+ */
+static void initBlock(blitz::Array<real, 3> &lhs, blitz::Array<real, 3> &rhs, blitz::Array<real, 3> &out,
+                      const int n, const blitz::TinyVector<int, 3> aPads) {
+    blitz::TinyVector<int, 3> aSize, aLBound;
+
+    // THE BLOCK HAS ONE LAYER OF HALO POINTS ON EACH SIDE
+    aSize = n + 2, n + 2, n + 2;
+    aLBound = -1, -1, -1;
+
+    grid::allocPadded(lhs, aSize, aLBound, aPads);
+    grid::allocPadded(rhs, aSize, aLBound, aPads);
+    grid::allocPadded(out, aSize, aLBound, aPads);
+
+    blitz::firstIndex i;
+    blitz::secondIndex j;
+    blitz::thirdIndex k;
+
+    lhs = sin(M_PI*(i + 1.0)/(n + 1.0))*sin(M_PI*(j + 1.0)/(n + 1.0))*sin(M_PI*(k + 1.0)/(n + 1.0));
+    rhs = lhs*lhs;
+    out = 0.0;
+}
+
+
+int main() {
+    real tStart, localVals[3], globalVals[3];
+
+    // INITIALIZE MPI
+    MPI_Init(NULL, NULL);
+
+    // ALL PROCESSES READ THE INPUT PARAMETERS
+    parser inputParams;
+
+    // INITIALIZE PARALLELIZATION DATA
+    parallel mpi(inputParams);
+
+    // THE PADDING SPECIFIED IN THE INPUT FILE IS USED, AND A DEFAULT VALUE IS USED IF PADDING IS DISABLED IN THE INPUT FILE
+    const int padWidth = inputParams.allocPad > 0 ? inputParams.allocPad : 8;
+
+    blitz::TinyVector<int, 3> noPads, withPads;
+    noPads = 0, 0, 0;
+    withPads = 0, padWidth, padWidth;
+
+    if (mpi.rank == 0) {
+        std::cout << std::endl << "Average time per call over " << benchCount << " calls, with " << padWidth << " points of padding" << std::endl << std::endl;
+        std::cout << std::left << std::setw(16) << "Block size" << std::right << std::setw(16) << "Unpadded (s)" << std::setw(16) << "Padded (s)"
+                  << std::setw(12) << "Speed-up" << std::setw(16) << "Max. Difference" << std::endl;
+    }
+
+    for (int b = 0; b < numBlocks; ++b) {
+        const int n = blockSizes[b];
+
+        blitz::Array<real, 3> lhsU, rhsU, outU;
+        blitz::Array<real, 3> lhsP, rhsP, outP;
+
+        initBlock(lhsU, rhsU, outU, n, noPads);
+        initBlock(lhsP, rhsP, outP, n, withPads);
+
+        tStart = MPI_Wtime();
+        for (int m = 0; m < benchCount; ++m) jacobiSweep(lhsU, rhsU, outU, n, inputParams.nThreads);
+        localVals[0] = (MPI_Wtime() - tStart)/benchCount;
+
+        tStart = MPI_Wtime();
+        for (int m = 0; m < benchCount; ++m) jacobiSweep(lhsP, rhsP, outP, n, inputParams.nThreads);
+        localVals[1] = (MPI_Wtime() - tStart)/benchCount;
+
+        localVals[2] = blitz::max(fabs(outU - outP));
+
+        MPI_Allreduce(localVals, globalVals, 3, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+
+        if (mpi.rank == 0) {
+            std::cout << std::left << std::setw(16) << std::to_string(n) + "^3" << std::right << std::scientific << std::setprecision(4)
+                      << std::setw(16) << globalVals[0] << std::setw(16) << globalVals[1]
+                      << std::fixed << std::setprecision(3) << std::setw(12) << globalVals[0]/globalVals[1]
+                      << std::scientific << std::setprecision(4) << std::setw(16) << globalVals[2] << std::endl;
+        }
+    }
+
+    if (mpi.rank == 0) std::cout << std::endl;
+
+    // FINALIZE AND CLEAN-UP
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,444 @@
+/********************************************************************************************************************************************
+ * Saras
+ * 
+ * Copyright (C) 2019, Mahendra K. Verma
+ *
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     1. Redistributions of source code must retain the above copyright
+ *        notice, this list of conditions and the following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright
+ *        notice, this list of conditions and the following disclaimer in the
+ *        documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the
+ *        names of its contributors may be used to endorse or promote products
+ *        derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ********************************************************************************************************************************************
+ */
+/*! \file viewBench.cc
+ *
+ *  \brief Benchmark of stencil kernels written with blitz array expressions and indexing against those written with array views.
+ *
+ *  \author Roshan Samuel
+ *  \date Nov 2019
+ *  \copyright New BSD License
+ *
+ ********************************************************************************************************************************************
+ */
+
+#include <iostream>
+#include <iomanip>
+#include "parallel.h"
+#include "parser.h"
+#include "grid.h"
+#include "derivative.h"
+#include "aview.h"
+
+// NUMBER OF TIMES EACH KERNEL IS CALLED TO MEASURE ITS AVERAGE TIME
+static const int benchCount = 20;
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the first or second derivative along one direction using blitz array expressions
+ *
+ *          The finite-difference stencils are applied on shifted RectDomain views, the wall points are recomputed with
+ *          2nd order stencils for the 4th order scheme, and the grid derivatives are multiplied in separate passes,
+ *          in the same sequence of whole-array operations that was used by the derivative class before it was ported to views.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   F is a const reference to the array to be differentiated
+ * \param   tmp is a reference to the array used to hold the first derivative when computing the second derivative
+ * \param   out is a reference to the array into which the derivative is written
+ * \param   dim is the direction along which the derivative is computed
+ * \param   second is the flag to compute the second derivative instead of the first
+ ********************************************************************************************************************************************
+ */
+static void blitzDerivative(const grid &mesh, const blitz::Array<real, 3> &F, blitz::Array<sreal, 3> &tmp, blitz::Array<sreal, 3> &out,
+                            const int dim, const bool second) {
+    blitz::firstIndex i;
+    blitz::secondIndex j;
+    blitz::thirdIndex k;
+
+    const blitz::RectDomain<3> &core = mesh.coreDomain;
+    const real h[3] = {mesh.dXi, mesh.dEt, mesh.dZt};
+
+    if (mesh.inputParams.dScheme == 1) {
+        tmp(core) = 0.5*(F(mesh.shift(dim, core, 1)) - F(mesh.shift(dim, core, -1)));
+        if (second) out(core) = F(mesh.shift(dim, core, 1)) - 2.0*F(core) + F(mesh.shift(dim, core, -1));
+
+    } else {
+        tmp(core) = (8.0*(F(mesh.shift(dim, core, 1)) - F(mesh.shift(dim, core, -1))) -
+                         (F(mesh.shift(dim, core, 2)) - F(mesh.shift(dim, core, -2))))/12.0;
+        if (second) out(core) = (16.0*(F(mesh.shift(dim, core, 1)) + F(mesh.shift(dim, core, -1))) -
+                                     (F(mesh.shift(dim, core, 2)) + F(mesh.shift(dim, core, -2))) - 30.0*F(core))/12.0;
+
+        // 2ND ORDER CENTRAL DIFFERENCE AT BOUNDARIES
+        bool atWall[2];
+        atWall[0] = (dim == 2) or (dim == 0 and mesh.rankData.xRank == 0) or (dim == 1 and mesh.rankData.yRank == 0);
+        atWall[1] = (dim == 2) or (dim == 0 and mesh.rankData.xRank == mesh.rankData.npX - 1) or
+                                  (dim == 1 and mesh.rankData.yRank == mesh.rankData.npY - 1);
+
+        for (int n = 0; n < 2; ++n) {
+            if (not atWall[n]) continue;
+
+            blitz::RectDomain<3> wall = core;
+            if (n == 0) wall.ubound()(dim) = core.lbound(dim);
+            else        wall.lbound()(dim) = core.ubound(dim);
+
+            tmp(wall) = 0.5*(F(mesh.shift(dim, wall, 1)) - F(mesh.shift(dim, wall, -1)));
+            if (second) out(wall) = F(mesh.shift(dim, wall, 1)) - 2.0*F(wall) + F(mesh.shift(dim, wall, -1));
+        }
+    }
+
+    tmp(core) /= h[dim];
+    if (second) out(core) /= h[dim]*h[dim];
+
+    switch (dim) {
+        case 0:
+            if (second) out = mesh.xixx(i)*tmp(i, j, k) + mesh.xix2(i)*out(i, j, k);
+            else        out = mesh.xi_x(i)*tmp(i, j, k);
+            break;
+        case 1:
+            if (second) out = mesh.etyy(j)*tmp(i, j, k) + mesh.ety2(j)*out(i, j, k);
+            else        out = mesh.et_y(j)*tmp(i, j, k);
+            break;
+        case 2:
+            if (second) out = mesh.ztzz(k)*tmp(i, j, k) + mesh.ztz2(k)*out(i, j, k);
+            else        out = mesh.zt_z(k)*tmp(i, j, k);
+            break;
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to perform one Jacobi iteration of the multigrid smoother by indexing blitz arrays
+ *
+ *          The loop is the same as the one used for Jacobi smoothing in multigrid_d3::smooth() before it was ported to views.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   lhs is a const reference to the array holding data from the previous iteration
+ * \param   rhs is a const reference to the array holding the right-hand side
+ * \param   out is a reference to the array into which the updated values are written
+ ********************************************************************************************************************************************
+ */
+static void blitzSmooth(const grid &mesh, const blitz::Array<real, 3> &lhs, const blitz::Array<real, 3> &rhs, blitz::Array<real, 3> &out) {
+    const real ihx2 = 1.0/(mesh.dXi*mesh.dXi), i2hx = 0.5/mesh.dXi;
+    const real ihy2 = 1.0/(mesh.dEt*mesh.dEt), i2hy = 0.5/mesh.dEt;
+    const real ihz2 = 1.0/(mesh.dZt*mesh.dZt), i2hz = 0.5/mesh.dZt;
+
+#pragma omp parallel for num_threads(mesh.inputParams.nThreads)
+    for (int i = 0; i <= mesh.coreDomain.ubound(0); ++i) {
+        for (int j = 0; j <= mesh.coreDomain.ubound(1); ++j) {
+            for (int k = 0; k <= mesh.coreDomain.ubound(2); ++k) {
+                out(i, j, k) = (mesh.xix2(i) * ihx2 * (lhs(i + 1, j, k) + lhs(i - 1, j, k)) +
+                                mesh.xixx(i) * i2hx * (lhs(i + 1, j, k) - lhs(i - 1, j, k)) +
+                                mesh.ety2(j) * ihy2 * (lhs(i, j + 1, k) + lhs(i, j - 1, k)) +
+                                mesh.etyy(j) * i2hy * (lhs(i, j + 1, k) - lhs(i, j - 1, k)) +
+                                mesh.ztz2(k) * ihz2 * (lhs(i, j, k + 1) + lhs(i, j, k - 1)) +
+                                mesh.ztzz(k) * i2hz * (lhs(i, j, k + 1) - lhs(i, j, k - 1)) -
+                                 rhs(i, j, k)) / (2.0 * (ihx2*mesh.xix2(i) + ihy2*mesh.ety2(j) + ihz2*mesh.ztz2(k)));
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to perform one Jacobi iteration of the multigrid smoother through array views
+ *
+ *          The loop is the same as the one used for Jacobi smoothing in multigrid_d3::smooth().
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   lhs is a const reference to the array holding data from the previous iteration
+ * \param   rhs is a const reference to the array holding the right-hand side
+ * \param   out is a reference to the array into which the updated values are written
+ ********************************************************************************************************************************************
+ */
+static void viewSmooth(const grid &mesh, const blitz::Array<real, 3> &lhs, const blitz::Array<real, 3> &rhs, blitz::Array<real, 3> &out) {
+    const real hx2 = 1.0/(mesh.dXi*mesh.dXi), h2x = 0.5/mesh.dXi;
+    const real hy2 = 1.0/(mesh.dEt*mesh.dEt), h2y = 0.5/mesh.dEt;
+    const real hz2 = 1.0/(mesh.dZt*mesh.dZt), h2z = 0.5/mesh.dZt;
+
+    const aview<const real, 3> L(lhs);
+    const aview<const real, 3> R(rhs);
+    const aview<real, 3> T(out);
+
+    const aview<const real, 1> x2(mesh.xix2), xx(mesh.xixx);
+    const aview<const real, 1> y2(mesh.ety2), yy(mesh.etyy);
+    const aview<const real, 1> z2(mesh.ztz2), zz(mesh.ztzz);
+
+#pragma omp parallel for num_threads(mesh.inputParams.nThreads)
+    for (int i = 0; i <= mesh.coreDomain.ubound(0); ++i) {
+        for (int j = 0; j <= mesh.coreDomain.ubound(1); ++j) {
+            for (int k = 0; k <= mesh.coreDomain.ubound(2); ++k) {
+                T(i, j, k) = (x2(i) * hx2 * (L(i + 1, j, k) + L(i - 1, j, k)) +
+                              xx(i) * h2x * (L(i + 1, j, k) - L(i - 1, j, k)) +
+                              y2(j) * hy2 * (L(i, j + 1, k) + L(i, j - 1, k)) +
+                              yy(j) * h2y * (L(i, j + 1, k) - L(i, j - 1, k)) +
+                              z2(k) * hz2 * (L(i, j, k + 1) + L(i, j, k - 1)) +
+                              zz(k) * h2z * (L(i, j, k + 1) - L(i, j, k - 1)) -
+                               R(i, j, k)) / (2.0 * (hx2*x2(i) + hy2*y2(j) + hz2*z2(k)));
+            }
+        }
+    }
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the maximum residual of the implicit diffusion equation with blitz arrays
+ *
+ *          The residual is written into a temporary array by indexing blitz arrays, after which its maximum absolute value
+ *          is found with blitz reductions, as was done in the Jacobi solvers of the time-stepping classes before they
+ *          were ported to views.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   F is a const reference to the array holding the current estimate of the solution
+ * \param   rhs is a const reference to the array holding the RHS of the implicit equation
+ * \param   tmp is a reference to the array used to hold the residual
+ * \param   dCoeff is the factor multiplying the Laplacian in the implicit equation
+ *
+ * \return  The maximum absolute value of the residual in the local sub-domain
+ ********************************************************************************************************************************************
+ */
+static real blitzResidual(const grid &mesh, const blitz::Array<real, 3> &F, const blitz::Array<real, 3> &rhs, blitz::Array<real, 3> &tmp, const real dCoeff) {
+    const real ihx2 = 1.0/(mesh.dXi*mesh.dXi), i2hx = 0.5/mesh.dXi;
+    const real ihy2 = 1.0/(mesh.dEt*mesh.dEt), i2hy = 0.5/mesh.dEt;
+    const real ihz2 = 1.0/(mesh.dZt*mesh.dZt), i2hz = 0.5/mesh.dZt;
+
+    const blitz::RectDomain<3> &core = mesh.coreDomain;
+
+#pragma omp parallel for num_threads(mesh.inputParams.nThreads)
+    for (int iX = 0; iX <= core.ubound(0); iX++) {
+        for (int iY = 0; iY <= core.ubound(1); iY++) {
+            for (int iZ = 0; iZ <= core.ubound(2); iZ++) {
+                tmp(iX, iY, iZ) = F(iX, iY, iZ) - dCoeff * (
+                          mesh.xix2(iX) * (F(iX+1, iY, iZ) - 2.0 * F(iX, iY, iZ) + F(iX-1, iY, iZ)) * ihx2 +
+                          mesh.xixx(iX) * (F(iX+1, iY, iZ) - F(iX-1, iY, iZ)) * i2hx +
+                          mesh.ety2(iY) * (F(iX, iY+1, iZ) - 2.0 * F(iX, iY, iZ) + F(iX, iY-1, iZ)) * ihy2 +
+                          mesh.etyy(iY) * (F(iX, iY+1, iZ) - F(iX, iY-1, iZ)) * i2hy +
+                          mesh.ztz2(iZ) * (F(iX, iY, iZ+1) - 2.0 * F(iX, iY, iZ) + F(iX, iY, iZ-1)) * ihz2 +
+                          mesh.ztzz(iZ) * (F(iX, iY, iZ+1) - F(iX, iY, iZ-1)) * i2hz);
+            }
+        }
+    }
+
+    tmp(core) = abs(tmp(core) - rhs(core));
+
+    return blitz::max(tmp(core));
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to compute the maximum residual of the implicit diffusion equation through array views
+ *
+ *          The residual and its maximum absolute value are computed in a single loop, as in the Jacobi solvers of the
+ *          time-stepping classes.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   F is a const reference to the array holding the current estimate of the solution
+ * \param   rhs is a const reference to the array holding the RHS of the implicit equation
+ * \param   dCoeff is the factor multiplying the Laplacian in the implicit equation
+ *
+ * \return  The maximum absolute value of the residual in the local sub-domain
+ ********************************************************************************************************************************************
+ */
+static real viewResidual(const grid &mesh, const blitz::Array<real, 3> &F, const blitz::Array<real, 3> &rhs, const real dCoeff) {
+    const real ihx2 = 1.0/(mesh.dXi*mesh.dXi), i2hx = 0.5/mesh.dXi;
+    const real ihy2 = 1.0/(mesh.dEt*mesh.dEt), i2hy = 0.5/mesh.dEt;
+    const real ihz2 = 1.0/(mesh.dZt*mesh.dZt), i2hz = 0.5/mesh.dZt;
+
+    const aview<const real, 3> src(F);
+    const aview<const real, 3> R(rhs);
+
+    const aview<const real, 1> x2(mesh.xix2), xx(mesh.xixx);
+    const aview<const real, 1> y2(mesh.ety2), yy(mesh.etyy);
+    const aview<const real, 1> z2(mesh.ztz2), zz(mesh.ztzz);
+
+    real maxError = 0.0;
+
+#pragma omp parallel for num_threads(mesh.inputParams.nThreads) reduction(max: maxError)
+    for (int iX = 0; iX <= mesh.coreDomain.ubound(0); iX++) {
+        for (int iY = 0; iY <= mesh.coreDomain.ubound(1); iY++) {
+            for (int iZ = 0; iZ <= mesh.coreDomain.ubound(2); iZ++) {
+                const real error = fabs(src(iX, iY, iZ) - dCoeff * (
+                          x2(iX) * (src(iX+1, iY, iZ) - 2.0 * src(iX, iY, iZ) + src(iX-1, iY, iZ)) * ihx2 +
+                          xx(iX) * (src(iX+1, iY, iZ) - src(iX-1, iY, iZ)) * i2hx +
+                          y2(iY) * (src(iX, iY+1, iZ) - 2.0 * src(iX, iY, iZ) + src(iX, iY-1, iZ)) * ihy2 +
+                          yy(iY) * (src(iX, iY+1, iZ) - src(iX, iY-1, iZ)) * i2hy +
+                          z2(iZ) * (src(iX, iY, iZ+1) - 2.0 * src(iX, iY, iZ) + src(iX, iY, iZ-1)) * ihz2 +
+                          zz(iZ) * (src(iX, iY, iZ+1) - src(iX, iY, iZ-1)) * i2hz) - R(iX, iY, iZ));
+
+                if (error > maxError) maxError = error;
+            }
+        }
+    }
+
+    return maxError;
+}
+
+
+/**
+ ********************************************************************************************************************************************
+ * \brief   Function to print the timings of a kernel in both versions along with the difference between their results
+ *
+ *          The times are maximum over all ranks, and the difference is the maximum absolute difference over all ranks.
+ *
+ * \param   mesh is a const reference to the global data contained in the grid class
+ * \param   kernelName is the name of the kernel printed in the first column
+ * \param   bzTime is the average time per call of the blitz version of the kernel in the local rank
+ * \param   avTime is the average time per call of the view version of the kernel in the local rank
+ * \param   maxDiff is the maximum absolute difference between the results of the two versions in the local rank
+ ********************************************************************************************************************************************
+ */
+static void printResult(const grid &mesh, const std::string kernelName, real bzTime, real avTime, real maxDiff) {
+    real localVals[3], globalVals[3];
+
+    localVals[0] = bzTime;
+    localVals[1] = avTime;
+    localVals[2] = maxDiff;
+
+    MPI_Allreduce(localVals, globalVals, 3, MPI_FP_REAL, MPI_MAX, MPI_COMM_WORLD);
+
+    if (mesh.rankData.rank == 0) {
+        std::cout << std::left << std::setw(28) << kernelName << std::right << std::scientific << std::setprecision(4)
+                  << std::setw(16) << globalVals[0] << std::setw(16) << globalVals[1]
+                  << std::fixed << std::setprecision(3) << std::setw(12) << globalVals[0]/globalVals[1]
+                  << std::scientific << std::setprecision(4) << std::setw(16) << globalVals[2] << std::endl;
+    }
+}
+
+
+int main() {
+    real tStart, bzTime, avTime;
+
+    // INITIALIZE MPI
+    MPI_Init(NULL, NULL);
+
+    // ALL PROCESSES READ THE INPUT PARAMETERS
+    parser inputParams;
+
+    // INITIALIZE PARALLELIZATION DATA
+    parallel mpi(inputParams);
+
+#ifdef PLANAR
+    if (mpi.rank == 0) std::cout << "ERROR: The array view benchmark is available only for 3D runs. Aborting" << std::endl;
+    MPI_Finalize();
+    exit(0);
+#endif
+
+    // INITIALIZE GRID DATA
+    grid mesh(inputParams, mpi);
+
+    const blitz::RectDomain<3> &core = mesh.coreDomain;
+    const blitz::RectDomain<3> &full = mesh.fullDomain;
+
+    blitz::TinyVector<int, 3> dSize = full.ubound() - full.lbound() + 1;
+    blitz::TinyVector<int, 3> dlBnd = full.lbound();
+
+    blitz::firstIndex i;
+    blitz::secondIndex j;
+    blitz::thirdIndex k;
+
+    // SMOOTH TEST DATA WITH NON-ZERO DERIVATIVES ALONG ALL DIRECTIONS
+    blitz::Array<real, 3> F(dSize), rhs(dSize), outBZ(dSize), outAV(dSize);
+    blitz::Array<sreal, 3> dTmp(dSize), dOutBZ(dSize), dOutAV(dSize);
+    F.reindexSelf(dlBnd);
+    rhs.reindexSelf(dlBnd);
+    outBZ.reindexSelf(dlBnd);
+    outAV.reindexSelf(dlBnd);
+    dTmp.reindexSelf(dlBnd);
+    dOutBZ.reindexSelf(dlBnd);
+    dOutAV.reindexSelf(dlBnd);
+
+    F = sin(2.0*M_PI*mesh.x(i)/mesh.xLen)*cos(2.0*M_PI*mesh.y(j)/mesh.yLen)*sin(M_PI*mesh.z(k)/mesh.zLen);
+    rhs = F*F;
+    outBZ = 0.0;
+    outAV = 0.0;
+    dTmp = 0.0;
+    dOutBZ = 0.0;
+    dOutAV = 0.0;
+
+    derivative der(mesh, F);
+
+    if (mpi.rank == 0) {
+        std::cout << std::endl << "Average time per call over " << benchCount << " calls" << std::endl << std::endl;
+        std::cout << std::left << std::setw(28) << "Kernel" << std::right << std::setw(16) << "Blitz (s)" << std::setw(16) << "View (s)"
+                  << std::setw(12) << "Speed-up" << std::setw(16) << "Max. Difference" << std::endl;
+    }
+
+    // FIRST AND SECOND DERIVATIVES ALONG EACH DIRECTION
+    const std::string dirName[3] = {"X", "Y", "Z"};
+    for (int order = 1; order <= 2; ++order) {
+        for (int dim = 0; dim < 3; ++dim) {
+            tStart = MPI_Wtime();
+            for (int n = 0; n < benchCount; ++n) blitzDerivative(mesh, F, dTmp, dOutBZ, dim, order == 2);
+            bzTime = (MPI_Wtime() - tStart)/benchCount;
+
+            tStart = MPI_Wtime();
+            for (int n = 0; n < benchCount; ++n) {
+                switch (3*(order - 1) + dim) {
+                    case 0: der.calcDerivative1_x(dOutAV); break;
+                    case 1: der.calcDerivative1_y(dOutAV); break;
+                    case 2: der.calcDerivative1_z(dOutAV); break;
+                    case 3: der.calcDerivative2xx(dOutAV); break;
+                    case 4: der.calcDerivative2yy(dOutAV); break;
+                    case 5: der.calcDerivative2zz(dOutAV); break;
+                }
+            }
+            avTime = (MPI_Wtime() - tStart)/benchCount;
+
+            printResult(mesh, (order == 1? "First": "Second") + std::string(" derivative along ") + dirName[dim], bzTime, avTime,
+                        blitz::max(fabs(dOutBZ(core) - dOutAV(core))));
+        }
+    }
+
+    // JACOBI ITERATION OF THE MULTIGRID SMOOTHER
+    tStart = MPI_Wtime();
+    for (int n = 0; n < benchCount; ++n) blitzSmooth(mesh, F, rhs, outBZ);
+    bzTime = (MPI_Wtime() - tStart)/benchCount;
+
+    tStart = MPI_Wtime();
+    for (int n = 0; n < benchCount; ++n) viewSmooth(mesh, F, rhs, outAV);
+    avTime = (MPI_Wtime() - tStart)/benchCount;
+
+    printResult(mesh, "Multigrid Jacobi sweep", bzTime, avTime, blitz::max(fabs(outBZ(core) - outAV(core))));
+
+    // RESIDUAL OF THE IMPLICIT DIFFUSION EQUATION SOLVED BY THE TIME-STEPPING CLASSES
+    const real dCoeff = 0.5*inputParams.tStp;
+    real bzMax = 0.0, avMax = 0.0;
+
+    tStart = MPI_Wtime();
+    for (int n = 0; n < benchCount; ++n) bzMax = blitzResidual(mesh, F, rhs, outBZ, dCoeff);
+    bzTime = (MPI_Wtime() - tStart)/benchCount;
+
+    tStart = MPI_Wtime();
+    for (int n = 0; n < benchCount; ++n) avMax = viewResidual(mesh, F, rhs, dCoeff);
+    avTime = (MPI_Wtime() - tStart)/benchCount;
+
+    printResult(mesh, "Implicit diffusion residual", bzTime, avTime, fabs(bzMax - avMax));
+
+    if (mpi.rank == 0) std::cout << std::endl;
+
+    // FINALIZE AND CLEAN-UP
+    MPI_Finalize();
+
+    return 0;
+}
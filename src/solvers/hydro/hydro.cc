@@ -68,6 +68,9 @@ hydro::hydro(const grid &mesh, const parser &solParam, parallel &mpiParam):
     // and that too in an entirely different part of the code.
     // This issue was found when using gcc 7.5
     plainvf why(mesh);
+
+    // THE TIME-STEPPING METHOD IS CREATED BY THE DERIVED CLASSES WHEN SOLVING
+    ivpSolver = NULL;
 }
 
 
@@ -199,13 +202,29 @@ void hydro::initVForcing() {
  *          The boundary conditions for all the 6 walls (4 in case of 2D simulations) are initialized here.
  *          Out of the different boundary conditions available in the boundary class,
  *          the appropriate BCs are chosen according to the type of problem being solved.
+ *          At the walls set as planes of symmetry in the YAML file, these BCs are replaced by mirror BCs.
  ********************************************************************************************************************************************
  */
 void hydro::initVBCs() {
+    // THE RECYCLED INFLOW OF THE OTHER COMPONENTS SHARES THE COMMUNICATOR AND RESCALING FACTOR OF THE STREAMWISE COMPONENT
+    recycle *uRecycle = NULL;
+
     if (inputParams.probType == 3) {
         // INFLOW AND OUTFLOW BCS
-        V.uLft = new dirichlet(mesh, V.Vx, 0, 1.0);
-        V.uRgt = new neumann(mesh, V.Vx, 1, 0.0);
+        if (inputParams.inflowBC == 1) {
+            // TURBULENT INFLOW RECYCLED FROM DOWNSTREAM, AND RESCALED TO UNIT BULK VELOCITY
+            uRecycle = new recycle(mesh, V.Vx, 0, 1.0);
+            V.uLft = uRecycle;
+        } else {
+            V.uLft = new dirichlet(mesh, V.Vx, 0, 1.0);
+        }
+
+        if (inputParams.outflowBC == 1) {
+            // CONVECTIVE OUTFLOW BC, WITH THE FIELD CONVECTED AT THE INFLOW VELOCITY
+            V.uRgt = new convective(mesh, V.Vx, 1, 1.0);
+        } else {
+            V.uRgt = new neumann(mesh, V.Vx, 1, 0.0);
+        }
     } else {
         // NO-PENETRATION BCS
         V.uLft = new dirichlet(mesh, V.Vx, 0, 0.0);
@@ -237,8 +256,17 @@ void hydro::initVBCs() {
 #ifndef PLANAR
     if (inputParams.probType == 3) {
         // INFLOW AND OUTFLOW BCS
-        V.vLft = new dirichlet(mesh, V.Vy, 0, 0.0);
-        V.vRgt = new neumann(mesh, V.Vy, 1, 0.0);
+        if (inputParams.inflowBC == 1) {
+            V.vLft = new recycle(mesh, V.Vy, 0, *uRecycle);
+        } else {
+            V.vLft = new dirichlet(mesh, V.Vy, 0, 0.0);
+        }
+
+        if (inputParams.outflowBC == 1) {
+            V.vRgt = new convective(mesh, V.Vy, 1, 1.0);
+        } else {
+            V.vRgt = new neumann(mesh, V.Vy, 1, 0.0);
+        }
     } else {
         // NO-SLIP BCS
         V.vLft = new dirichlet(mesh, V.Vy, 0, 0.0);
@@ -262,8 +290,17 @@ void hydro::initVBCs() {
 
     if (inputParams.probType == 3) {
         // INFLOW AND OUTFLOW BCS
-        V.wLft = new dirichlet(mesh, V.Vz, 0, 0.0);
-        V.wRgt = new neumann(mesh, V.Vz, 1, 0.0);
+        if (inputParams.inflowBC == 1) {
+            V.wLft = new recycle(mesh, V.Vz, 0, *uRecycle);
+        } else {
+            V.wLft = new dirichlet(mesh, V.Vz, 0, 0.0);
+        }
+
+        if (inputParams.outflowBC == 1) {
+            V.wRgt = new convective(mesh, V.Vz, 1, 1.0);
+        } else {
+            V.wRgt = new neumann(mesh, V.Vz, 1, 0.0);
+        }
     } else {
         // NO-SLIP BCS
         V.wLft = new dirichlet(mesh, V.Vz, 0, 0.0);
@@ -285,6 +322,119 @@ void hydro::initVBCs() {
         V.wBot = new dirichlet(mesh, V.Vz, 4, 0.0);
         V.wTop = new dirichlet(mesh, V.Vz, 5, 0.0);
     }
+
+    // WALL MODEL BCS FOR THE TANGENTIAL COMPONENTS OF VELOCITY AT STATIONARY NO-SLIP WALLS, WHICH REPLACE THE BCS SET ABOVE
+    // THE MOVING LID OF LDC AND THE INFLOW AND OUTFLOW WALLS RETAIN THEIR BCS
+    if (inputParams.wmFlag) {
+        if ((not inputParams.xPer) and (inputParams.probType != 3)) {
+#ifndef PLANAR
+            delete V.vLft;
+            V.vLft = new wallModel(mesh, V.Vy, 0, V.Vy, V.Vz);
+            delete V.vRgt;
+            V.vRgt = new wallModel(mesh, V.Vy, 1, V.Vy, V.Vz);
+#endif
+            delete V.wLft;
+            V.wLft = new wallModel(mesh, V.Vz, 0, V.Vy, V.Vz);
+            delete V.wRgt;
+            V.wRgt = new wallModel(mesh, V.Vz, 1, V.Vy, V.Vz);
+        }
+
+#ifndef PLANAR
+        if (not inputParams.yPer) {
+            delete V.uFrn;
+            V.uFrn = new wallModel(mesh, V.Vx, 2, V.Vx, V.Vz);
+            delete V.uBak;
+            V.uBak = new wallModel(mesh, V.Vx, 3, V.Vx, V.Vz);
+            delete V.wFrn;
+            V.wFrn = new wallModel(mesh, V.Vz, 2, V.Vx, V.Vz);
+            delete V.wBak;
+            V.wBak = new wallModel(mesh, V.Vz, 3, V.Vx, V.Vz);
+        }
+#endif
+
+        if (not inputParams.zPer) {
+            delete V.uBot;
+            V.uBot = new wallModel(mesh, V.Vx, 4, V.Vx, V.Vy);
+#ifndef PLANAR
+            delete V.vBot;
+            V.vBot = new wallModel(mesh, V.Vy, 4, V.Vx, V.Vy);
+#endif
+            if (inputParams.probType != 1) {
+                delete V.uTop;
+                V.uTop = new wallModel(mesh, V.Vx, 5, V.Vx, V.Vy);
+#ifndef PLANAR
+                delete V.vTop;
+                V.vTop = new wallModel(mesh, V.Vy, 5, V.Vx, V.Vy);
+#endif
+            }
+        }
+    }
+
+    // MIRROR BCS AT PLANES OF SYMMETRY, WHICH REPLACE THE BCS SET ABOVE
+    // THE COMPONENT OF VELOCITY NORMAL TO THE PLANE IS ODD, AND THE TANGENTIAL COMPONENTS ARE EVEN
+    if (inputParams.symPlanes(0)) {
+        delete V.uLft;
+        V.uLft = new symmetry(mesh, V.Vx, 0, true);
+#ifndef PLANAR
+        delete V.vLft;
+        V.vLft = new symmetry(mesh, V.Vy, 0, false);
+#endif
+        delete V.wLft;
+        V.wLft = new symmetry(mesh, V.Vz, 0, false);
+    }
+
+    if (inputParams.symPlanes(1)) {
+        delete V.uRgt;
+        V.uRgt = new symmetry(mesh, V.Vx, 1, true);
+#ifndef PLANAR
+        delete V.vRgt;
+        V.vRgt = new symmetry(mesh, V.Vy, 1, false);
+#endif
+        delete V.wRgt;
+        V.wRgt = new symmetry(mesh, V.Vz, 1, false);
+    }
+
+#ifndef PLANAR
+    if (inputParams.symPlanes(2)) {
+        delete V.uFrn;
+        V.uFrn = new symmetry(mesh, V.Vx, 2, false);
+        delete V.vFrn;
+        V.vFrn = new symmetry(mesh, V.Vy, 2, true);
+        delete V.wFrn;
+        V.wFrn = new symmetry(mesh, V.Vz, 2, false);
+    }
+
+    if (inputParams.symPlanes(3)) {
+        delete V.uBak;
+        V.uBak = new symmetry(mesh, V.Vx, 3, false);
+        delete V.vBak;
+        V.vBak = new symmetry(mesh, V.Vy, 3, true);
+        delete V.wBak;
+        V.wBak = new symmetry(mesh, V.Vz, 3, false);
+    }
+#endif
+
+    if (inputParams.symPlanes(4)) {
+        delete V.uBot;
+        V.uBot = new symmetry(mesh, V.Vx, 4, false);
+#ifndef PLANAR
+        delete V.vBot;
+        V.vBot = new symmetry(mesh, V.Vy, 4, false);
+#endif
+        delete V.wBot;
+        V.wBot = new symmetry(mesh, V.Vz, 4, true);
+    }
+
+    if (inputParams.symPlanes(5)) {
+        delete V.uTop;
+        V.uTop = new symmetry(mesh, V.Vx, 5, false);
+#ifndef PLANAR
+        delete V.vTop;
+        V.vTop = new symmetry(mesh, V.Vy, 5, false);
+#endif
+        delete V.wTop;
+        V.wTop = new symmetry(mesh, V.Vz, 5, true);
+    }
 };
 
 
@@ -295,6 +445,7 @@ void hydro::initVBCs() {
  *          The boundary conditions for all the 6 walls (4 in case of 2D simulations) are initialized here.
  *          Out of the different boundary conditions available in the boundary class,
  *          the appropriate BCs are chosen according to the type of problem being solved.
+ *          At the walls set as planes of symmetry in the YAML file, these BCs are replaced by mirror BCs.
  ********************************************************************************************************************************************
  */
 void hydro::initPBCs() {
@@ -318,6 +469,8 @@ void hydro::initPBCs() {
     
     if (inputParams.probType == 3) {
         // INFLOW AND OUTFLOW BCS
+        // THE NEUMANN BC AT THE OUTFLOW IS CONSISTENT WITH THE PRESSURE CORRECTION, AND IS RETAINED WITH CONVECTIVE OUTFLOW FOR VELOCITY.
+        // IN THAT CASE, THE POISSON SOLVER REMOVES THE IMBALANCE OF GLOBAL MASS FLUX SO THAT THE NEUMANN PROBLEM REMAINS COMPATIBLE
         P.tLft = new nullBC(mesh, P.F, 0);
         P.tRgt = new neumann(mesh, P.F, 1, 0.0);
     } else {
@@ -341,5 +494,37 @@ void hydro::initPBCs() {
         P.tBot = new neumann(mesh, P.F, 4, 0.0);
         P.tTop = new neumann(mesh, P.F, 5, 0.0);
     }
+
+    // MIRROR BC AT PLANES OF SYMMETRY, WHICH IS CONSISTENT WITH THE NEUMANN BC OF THE PRESSURE CORRECTION FROM THE POISSON SOLVER
+    if (inputParams.symPlanes(0)) {
+        delete P.tLft;
+        P.tLft = new symmetry(mesh, P.F, 0, false);
+    }
+    if (inputParams.symPlanes(1)) {
+        delete P.tRgt;
+        P.tRgt = new symmetry(mesh, P.F, 1, false);
+    }
+#ifndef PLANAR
+    if (inputParams.symPlanes(2)) {
+        delete P.tFrn;
+        P.tFrn = new symmetry(mesh, P.F, 2, false);
+    }
+    if (inputParams.symPlanes(3)) {
+        delete P.tBak;
+        P.tBak = new symmetry(mesh, P.F, 3, false);
+    }
+#endif
+    if (inputParams.symPlanes(4)) {
+        delete P.tBot;
+        P.tBot = new symmetry(mesh, P.F, 4, false);
+    }
+    if (inputParams.symPlanes(5)) {
+        delete P.tTop;
+        P.tTop = new symmetry(mesh, P.F, 5, false);
+    }
 };
 
+
+hydro::~hydro() {
+    if (ivpSolver) delete ivpSolver;
+}
@@ -45,6 +45,8 @@
 
 #include "timestep.h"
 #include "probes.h"
+#include "render.h"
+#include "histogram.h"
 #include "sfield.h"
 #include "vfield.h"
 
@@ -60,7 +62,7 @@ class hydro {
 
         virtual void solvePDE();
 
-        virtual ~hydro() { };
+        virtual ~hydro();
 
     protected:
         /** Integer value for the number of time-steps elapsed - it is incremented by 1 in each time-step. */
@@ -77,6 +79,12 @@ class hydro {
         /** Instance of the \ref probe class to collect data from probes in the domain. */
         probes *dataProbe;
 
+        /** Instance of the \ref render class to render slices of the solution as images during the run. */
+        render *sliceRender;
+
+        /** Instance of the \ref histogram class to compute PDFs of the solution during the run. */
+        histogram *pdfWriter;
+
         /** Instance of the \ref parallel class that holds the MPI-related data like rank, xRank, etc. */
         parallel &mpiData;
 
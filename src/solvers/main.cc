@@ -49,8 +49,10 @@
 int main() {
     struct timeval runStart, runEnd;
 
-    // INITIALIZE MPI
-    MPI_Init(NULL, NULL);
+    // INITIALIZE MPI WITH SUPPORT FOR CALLS FROM MULTIPLE THREADS ONLY IF THE PROGRESS THREAD FOR COMMUNICATION IS ENABLED
+    // THE LEVEL PROVIDED BY THE LIBRARY OVERWRITES THE REQUESTED ONE, AND IS QUERIED AGAIN BY THE PARALLEL CLASS BEFORE STARTING THE THREAD
+    int threadLevel = parser::threadSupport();
+    MPI_Init_thread(NULL, NULL, threadLevel, &threadLevel);
 
     // ALL PROCESSES READ THE INPUT PARAMETERS
     parser inputParams;
@@ -150,6 +152,9 @@ int main() {
         std::cout << "Time taken by simulation: " << run_time << std::endl;
     }
 
+    // WRITE THE STATISTICS OF COMMUNICATION AT EACH CALL SITE IF PROFILING IS ENABLED
+    if (mpi.profile) mpi.profile->writeReport(mpi.rank, mpi.nProc);
+
     // FINALIZE AND CLEAN-UP
     MPI_Finalize();
 
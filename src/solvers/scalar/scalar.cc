@@ -60,7 +60,12 @@
  */
 scalar::scalar(const grid &mesh, const parser &solParam, parallel &mpiParam):
             hydro(mesh, solParam, mpiParam),
-            T(mesh, "T") { }
+            T(mesh, "T")
+{
+    // THE REFINED GRID FOR TEMPERATURE IS CREATED BY THE DERIVED CLASSES, WHEN ENABLED
+    tMesh = NULL;
+    tFine = NULL;
+}
 
 
 /**
@@ -124,28 +129,33 @@ void scalar::initTForcing() {
  *          The temperature boundary conditions for all the 6 walls (4 in case of 2D simulations) are initialized here.
  *          Out of the different boundary conditions available in the boundary class,
  *          the appropriate BCs are chosen according to the type of problem being solved.
+ *          At the walls set as planes of symmetry in the YAML file, these BCs are replaced by mirror BCs.
+ *          The same BCs are imposed on the temperature field on the refined grid, when it is enabled.
+ *
+ * \param   tF is a reference to the temperature field on which the BCs are to be imposed
+ * \param   tGrid is a const reference to the grid on which tF is defined
  ********************************************************************************************************************************************
  */
-void scalar::initTBCs() {
+void scalar::initTBCs(sfield &tF, const grid &tGrid) {
     // ADIABATIC BC FOR RBC, SST AND RRBC
     if (inputParams.probType == 5 || inputParams.probType == 6 || inputParams.probType == 8) {
-        T.tLft = new neumann(mesh, T.F, 0, 0.0);
-        T.tRgt = new neumann(mesh, T.F, 1, 0.0);
+        tF.tLft = new neumann(tGrid, tF.F, 0, 0.0);
+        tF.tRgt = new neumann(tGrid, tF.F, 1, 0.0);
 
     // CONDUCTING BC FOR VERTICAL CONVECTION
     } else if (inputParams.probType == 7) {
-        T.tLft = new dirichlet(mesh, T.F, 0, 1.0);
-        T.tRgt = new dirichlet(mesh, T.F, 1, 0.0);
+        tF.tLft = new dirichlet(tGrid, tF.F, 0, 1.0);
+        tF.tRgt = new dirichlet(tGrid, tF.F, 1, 0.0);
     }
 
 #ifndef PLANAR
-    T.tFrn = new neumann(mesh, T.F, 2, 0.0);
-    T.tBak = new neumann(mesh, T.F, 3, 0.0);
+    tF.tFrn = new neumann(tGrid, tF.F, 2, 0.0);
+    tF.tBak = new neumann(tGrid, tF.F, 3, 0.0);
 #endif
 
     if (inputParams.zPer) {
-        T.tBot = new periodic(mesh, T.F, 4);
-        T.tTop = new periodic(mesh, T.F, 5);
+        tF.tBot = new periodic(tGrid, tF.F, 4);
+        tF.tTop = new periodic(tGrid, tF.F, 5);
     } else {
         // HOT PLATE AT BOTTOM AND COLD PLATE AT TOP FOR RBC AND RRBC
         if (inputParams.probType == 5 || inputParams.probType == 8) {
@@ -153,20 +163,72 @@ void scalar::initTBCs() {
             if (inputParams.nonHgBC) {
 #ifndef PLANAR
                 if (mpiData.rank == 0) std::cout << "Using non-homogeneous boundary condition (heating plate) on bottom wall" << std::endl << std::endl;
-                T.tBot = new hotPlate(mesh, T.F, 4, inputParams.patchRadius);
+                tF.tBot = new hotPlate(tGrid, tF.F, 4, inputParams.patchRadius);
 #else
                 if (mpiData.rank == 0) std::cout << "WARNING: Non-homogenous BC flag is set to true in input paramters for 2D simulation. IGNORING" << std::endl << std::endl;
 #endif
             } else {
-                T.tBot = new dirichlet(mesh, T.F, 4, 1.0);
+                tF.tBot = new dirichlet(tGrid, tF.F, 4, 1.0);
             }
-            T.tTop = new dirichlet(mesh, T.F, 5, 0.0);
+            tF.tTop = new dirichlet(tGrid, tF.F, 5, 0.0);
 
         // COLD PLATE AT BOTTOM AND HOT PLATE AT TOP FOR SST
         } else if (mesh.inputParams.probType == 6) {
-            T.tBot = new dirichlet(mesh, T.F, 4, 0.0);
-            T.tTop = new dirichlet(mesh, T.F, 5, 1.0);
+            tF.tBot = new dirichlet(tGrid, tF.F, 4, 0.0);
+            tF.tTop = new dirichlet(tGrid, tF.F, 5, 1.0);
+        }
+    }
+
+    // WALL MODEL BCS FOR THE HEAT FLUX AT ISOTHERMAL WALLS, WHICH REPLACE THE BCS SET ABOVE
+    if (inputParams.wmFlag) {
+        if (inputParams.probType == 7) {
+            delete tF.tLft;
+            tF.tLft = new wallModel(tGrid, tF.F, 0, V.Vy, V.Vz, 1.0);
+            delete tF.tRgt;
+            tF.tRgt = new wallModel(tGrid, tF.F, 1, V.Vy, V.Vz, 0.0);
         }
+
+        if (not inputParams.zPer) {
+            if ((inputParams.probType == 5 || inputParams.probType == 8) and (not inputParams.nonHgBC)) {
+                delete tF.tBot;
+                tF.tBot = new wallModel(tGrid, tF.F, 4, V.Vx, V.Vy, 1.0);
+                delete tF.tTop;
+                tF.tTop = new wallModel(tGrid, tF.F, 5, V.Vx, V.Vy, 0.0);
+            } else if (inputParams.probType == 6) {
+                delete tF.tBot;
+                tF.tBot = new wallModel(tGrid, tF.F, 4, V.Vx, V.Vy, 0.0);
+                delete tF.tTop;
+                tF.tTop = new wallModel(tGrid, tF.F, 5, V.Vx, V.Vy, 1.0);
+            }
+        }
+    }
+
+    // MIRROR BC AT PLANES OF SYMMETRY, WHICH REPLACES THE BCS SET ABOVE
+    if (inputParams.symPlanes(0)) {
+        delete tF.tLft;
+        tF.tLft = new symmetry(tGrid, tF.F, 0, false);
+    }
+    if (inputParams.symPlanes(1)) {
+        delete tF.tRgt;
+        tF.tRgt = new symmetry(tGrid, tF.F, 1, false);
+    }
+#ifndef PLANAR
+    if (inputParams.symPlanes(2)) {
+        delete tF.tFrn;
+        tF.tFrn = new symmetry(tGrid, tF.F, 2, false);
+    }
+    if (inputParams.symPlanes(3)) {
+        delete tF.tBak;
+        tF.tBak = new symmetry(tGrid, tF.F, 3, false);
+    }
+#endif
+    if (inputParams.symPlanes(4)) {
+        delete tF.tBot;
+        tF.tBot = new symmetry(tGrid, tF.F, 4, false);
+    }
+    if (inputParams.symPlanes(5)) {
+        delete tF.tTop;
+        tF.tTop = new symmetry(tGrid, tF.F, 5, false);
     }
 };
 
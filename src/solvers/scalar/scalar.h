@@ -55,7 +55,13 @@ class scalar: public hydro {
         virtual ~scalar() { };
 
     protected:
-        void initTBCs();
+        /** Refined grid on which the temperature is solved, if the scalar refinement factor in the YAML file exceeds 1. NULL otherwise */
+        grid *tMesh;
+
+        /** Temperature field on the refined grid tMesh. The field T then holds its restriction on mesh. NULL otherwise */
+        sfield *tFine;
+
+        void initTBCs(sfield &tF, const grid &tGrid);
 
         void initVForcing();
         void initTForcing();
@@ -110,7 +110,7 @@ scalar_d2::scalar_d2(const grid &mesh, const parser &solParam, parallel &mpiPara
     // Initialize velocity, pressure and temperature boundary conditions
     initVBCs();
     initPBCs();
-    initTBCs();
+    initTBCs(T, mesh);
 
     // Initialize velocity and temperature forcing fields
     initVForcing();
@@ -124,7 +124,7 @@ scalar_d2::scalar_d2(const grid &mesh, const parser &solParam, parallel &mpiPara
 
 
 void scalar_d2::solvePDE() {
-    real fwTime, prTime, rsTime;
+    real fwTime, prTime, rsTime, rdTime, pdTime;
 
     // Set dt equal to input time step
     dt = inputParams.tStp;
@@ -146,6 +146,11 @@ void scalar_d2::solvePDE() {
         dataProbe = new probes(mesh, writeFields);
     }
 
+    // Initialize slice renderer
+    if (inputParams.renderSlices) {
+        sliceRender = new render(mesh, writeFields);
+    }
+
     // Output file and I/O writer to write time-series of various variables
     tseries tsWriter(mesh, V, time, dt);
 
@@ -159,12 +164,23 @@ void scalar_d2::solvePDE() {
             break;
     }
 
+    // Initialize PDF computation after the time-stepping method has set the diffusion constants
+    if (inputParams.recordPDFs) {
+        pdfWriter = new histogram(mesh, V, T, tsWriter.mDiff, tsWriter.tDiff);
+    }
+
     // FILE WRITING TIME
     fwTime = time;
 
     // FIELD PROBING TIME
     prTime = time;
 
+    // SLICE RENDERING TIME
+    rdTime = time;
+
+    // PDF WRITING TIME
+    pdTime = time;
+
     // RESTART FILE WRITING TIME
     rsTime = time;
 
@@ -188,6 +204,12 @@ void scalar_d2::solvePDE() {
         fCount = int(inputParams.prInt/inputParams.tStp);
         prTime = roundNum(tCount, fCount)*inputParams.tStp;
 
+        fCount = int(inputParams.rdInt/inputParams.tStp);
+        rdTime = roundNum(tCount, fCount)*inputParams.tStp;
+
+        fCount = int(inputParams.pdInt/inputParams.tStp);
+        pdTime = roundNum(tCount, fCount)*inputParams.tStp;
+
         fCount = int(inputParams.rsInt/inputParams.tStp);
         rsTime = roundNum(tCount, fCount)*inputParams.tStp;
     }
@@ -206,6 +228,16 @@ void scalar_d2::solvePDE() {
         prTime += inputParams.prInt;
     }
 
+    if (inputParams.renderSlices) {
+        sliceRender->renderSlice(time);
+        rdTime += inputParams.rdInt;
+    }
+
+    if (inputParams.recordPDFs) {
+        pdfWriter->writePDF(time);
+        pdTime += inputParams.pdInt;
+    }
+
     rsTime += inputParams.rsInt;
 
     // TIME-INTEGRATION LOOP
@@ -232,6 +264,16 @@ void scalar_d2::solvePDE() {
             prTime += inputParams.prInt;
         }
 
+        if (inputParams.renderSlices and std::abs(rdTime - time) < 0.5*dt) {
+            sliceRender->renderSlice(time);
+            rdTime += inputParams.rdInt;
+        }
+
+        if (inputParams.recordPDFs and std::abs(pdTime - time) < 0.5*dt) {
+            pdfWriter->writePDF(time);
+            pdTime += inputParams.pdInt;
+        }
+
         if (std::abs(fwTime - time) < 0.5*dt) {
             switch (inputParams.solnFormat) {
                 case 1: dataWriter.writeSolution(time);
@@ -111,7 +111,7 @@ scalar_d3::scalar_d3(const grid &mesh, const parser &solParam, parallel &mpiPara
     // Initialize velocity, pressure and temperature boundary conditions
     initVBCs();
     initPBCs();
-    initTBCs();
+    initTBCs(T, mesh);
 
     // Initialize velocity and temperature forcing fields
     initVForcing();
@@ -121,11 +121,46 @@ scalar_d3::scalar_d3(const grid &mesh, const parser &solParam, parallel &mpiPara
     V.imposeBCs();
     P.imposeBCs();
     T.imposeBCs();
+
+    // Initialize the temperature field on the refined grid by interpolating T, if enabled
+    if (inputParams.sRefine > 1) {
+        if (mesh.rankData.rank == 0) std::cout << "Solving temperature on a grid refined by a factor of " << inputParams.sRefine << std::endl << std::endl;
+
+        tMesh = new grid(inputParams, mpiData, inputParams.sRefine);
+        tFine = new sfield(*tMesh, "T");
+
+        initTBCs(*tFine, *tMesh);
+        tFine->tForcing = new zeroForcing(*tMesh, V);
+
+        // On restart, the refined temperature is read from its own restart files, since T holds only its restriction
+        if (inputParams.restartFlag) {
+            std::vector<field> readFields;
+            readFields.push_back(tFine->F);
+
+            reader fineReader(*tMesh, readFields, "Fine");
+
+            real fineTime = fineReader.readData();
+
+            // Abort if the refined temperature was not written along with the other fields
+            if (std::abs(fineTime - time) > 1.0e-6*std::max(real(1.0), time)) {
+                if (mesh.rankData.rank == 0) {
+                    std::cout << "ERROR: Restart data of the refined temperature does not match the time of the restart file. Aborting" << std::endl;
+                }
+                MPI_Finalize();
+                exit(0);
+            }
+        } else {
+            refine tInit(mesh, *tMesh);
+            tInit.prolong(T.F.F, tFine->F.F);
+        }
+
+        tFine->imposeBCs();
+    }
 }
 
 
 void scalar_d3::solvePDE() {
-    real fwTime, prTime, rsTime;
+    real fwTime, prTime, rsTime, rdTime, pdTime;
 
     // Set dt equal to input time step
     dt = inputParams.tStp;
@@ -148,6 +183,11 @@ void scalar_d3::solvePDE() {
         dataProbe = new probes(mesh, writeFields);
     }
 
+    // Initialize slice renderer
+    if (inputParams.renderSlices) {
+        sliceRender = new render(mesh, writeFields);
+    }
+
     // Output file and I/O writer to write time-series of various variables
     tseries tsWriter(mesh, V, time, dt);
 
@@ -161,12 +201,36 @@ void scalar_d3::solvePDE() {
             break;
     }
 
+    // The temperature is advanced on the refined grid, and restricted into T by the time-stepping method, if enabled
+    if (tFine) ivpSolver->setScalarGrid(*tMesh, T);
+
+    sfield &tSolve = (tFine)? *tFine: T;
+
+    // The restart data of the refined temperature is written by a separate writer, as its grid differs from that of the other fields
+    std::vector<field> fineFields;
+    writer *fineWriter = NULL;
+    if (tFine) {
+        fineFields.push_back(tFine->F);
+        fineWriter = new writer(*tMesh, fineFields, "Fine");
+    }
+
+    // Initialize PDF computation after the time-stepping method has set the diffusion constants
+    if (inputParams.recordPDFs) {
+        pdfWriter = new histogram(mesh, V, T, tsWriter.mDiff, tsWriter.tDiff);
+    }
+
     // FILE WRITING TIME
     fwTime = time;
 
     // FIELD PROBING TIME
     prTime = time;
 
+    // SLICE RENDERING TIME
+    rdTime = time;
+
+    // PDF WRITING TIME
+    pdTime = time;
+
     // RESTART FILE WRITING TIME
     rsTime = time;
 
@@ -190,6 +254,12 @@ void scalar_d3::solvePDE() {
         fCount = int(inputParams.prInt/inputParams.tStp);
         prTime = roundNum(tCount, fCount)*inputParams.tStp;
 
+        fCount = int(inputParams.rdInt/inputParams.tStp);
+        rdTime = roundNum(tCount, fCount)*inputParams.tStp;
+
+        fCount = int(inputParams.pdInt/inputParams.tStp);
+        pdTime = roundNum(tCount, fCount)*inputParams.tStp;
+
         fCount = int(inputParams.rsInt/inputParams.tStp);
         rsTime = roundNum(tCount, fCount)*inputParams.tStp;
     }
@@ -208,16 +278,29 @@ void scalar_d3::solvePDE() {
         prTime += inputParams.prInt;
     }
 
+    if (inputParams.renderSlices) {
+        sliceRender->renderSlice(time);
+        rdTime += inputParams.rdInt;
+    }
+
+    if (inputParams.recordPDFs) {
+        pdfWriter->writePDF(time);
+        pdTime += inputParams.pdInt;
+    }
+
     rsTime += inputParams.rsInt;
 
     // TIME-INTEGRATION LOOP
     while (true) {
         // MAIN FUNCTION CALLED IN EACH LOOP TO UPDATE THE FIELDS AT EACH TIME-STEP
-        ivpSolver->timeAdvance(V, P, T);
+        ivpSolver->timeAdvance(V, P, tSolve);
 
         if (inputParams.useCFL) {
             V.computeTStp(dt);
 
+            // THE FINITE-DIFFERENCE ADVECTION TERM OF TEMPERATURE ON THE REFINED GRID NEEDS A PROPORTIONATELY SMALLER TIME-STEP
+            if (tFine and inputParams.aScheme == 1) dt /= inputParams.sRefine;
+
             if (dt > inputParams.tStp)
                 dt = inputParams.tStp;
         }
@@ -234,6 +317,16 @@ void scalar_d3::solvePDE() {
             prTime += inputParams.prInt;
         }
 
+        if (inputParams.renderSlices and std::abs(rdTime - time) < 0.5*dt) {
+            sliceRender->renderSlice(time);
+            rdTime += inputParams.rdInt;
+        }
+
+        if (inputParams.recordPDFs and std::abs(pdTime - time) < 0.5*dt) {
+            pdfWriter->writePDF(time);
+            pdTime += inputParams.pdInt;
+        }
+
         if (std::abs(fwTime - time) < 0.5*dt) {
             switch (inputParams.solnFormat) {
                 case 1: dataWriter.writeSolution(time);
@@ -247,6 +340,7 @@ void scalar_d3::solvePDE() {
 
         if (std::abs(rsTime - time) < 0.5*dt) {
             dataWriter.writeRestart(time);
+            if (fineWriter) fineWriter->writeRestart(time);
             rsTime += inputParams.rsInt;
         }
 
@@ -254,6 +348,8 @@ void scalar_d3::solvePDE() {
             break;
         }
     }
+
+    if (fineWriter) delete fineWriter;
 }
 
 
@@ -0,0 +1,122 @@
+#!/usr/bin/python
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ #
+ ############################################################################################################################################
+ ##
+ ##! \file checkFloatPads.py
+ #
+ #   \brief Python script to compare the multigrid runs with single and double precision pads during smoothing
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+import sys
+
+# The pads at the finest level of the V-Cycle are always exchanged at full precision, so the round-off from the single
+# precision pads of the coarser levels is removed by the later V-Cycles. The run with single precision pads must hence
+# converge like the run with double precision pads until the residual reaches the round-off of single precision, and both
+# runs must deviate equally from the analytic solution, since this deviation is set by the discretization error
+# Maximum ratio of residuals of both runs after each V-Cycle, while the residual of the double precision run is above the floor
+residualRatio = 2.0
+# Residual below which the single precision round-off of the coarse grid corrections may stall the convergence
+residualFloor = 1.0e-6
+# Maximum relative difference permitted between the deviations of both runs from the analytic solution
+tolerance = 1.0e-2
+
+def readLog(fileName):
+    try:
+        f = open(fileName, 'r')
+    except:
+        print("Could not open file " + fileName + "\n")
+        exit(1)
+
+    residuals = []
+    deviation = None
+    for line in f:
+        if line.startswith("Residual after V Cycle"):
+            residuals.append(float(line.split()[-1]))
+        elif line.startswith("Maximum absolute deviation"):
+            deviation = float(line.split()[-1])
+
+    f.close()
+
+    if deviation is None or len(residuals) == 0:
+        print("Could not find the residuals and deviation from analytic solution in " + fileName + "\n")
+        exit(1)
+
+    return residuals, deviation
+
+
+def compareData(testDir):
+    baseRes, baseDev = readLog(testDir + "/output_float_false/log.txt")
+    testRes, testDev = readLog(testDir + "/output_float_true/log.txt")
+
+    testPass = True
+
+    print("")
+    print("Comparing multigrid run of " + testDir + " with single precision pads against the run with double precision pads\n")
+
+    if len(baseRes) != len(testRes):
+        print("Number of V-Cycles differs between the runs: " + str(len(baseRes)) + " and " + str(len(testRes)) + "\n")
+        testPass = False
+
+    for i in range(min(len(baseRes), len(testRes))):
+        print("V-Cycle " + str(i) + ": residual = " + str(baseRes[i]) + " | " + str(testRes[i]) + "\n")
+
+        if testRes[i] > residualRatio*max(baseRes[i], residualFloor):
+            testPass = False
+
+    relError = abs(testDev - baseDev)/baseDev if baseDev > 0.0 else abs(testDev)
+
+    print("Maximum deviation from analytic solution = " + str(baseDev) + " | " + str(testDev) + ", relative difference = " + str(relError) + "\n")
+
+    if relError > tolerance:
+        testPass = False
+
+    if testPass:
+        print("PASSED: Run with single precision pads converges like the run with double precision pads, and matches its deviation from analytic solution within tolerance of " + str(tolerance) + "\n")
+    else:
+        print("FAILED: Run with single precision pads converges slower than the run with double precision pads, or its deviation from analytic solution differs by more than " + str(tolerance) + "\n")
+
+    return testPass
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("Usage: python checkFloatPads.py <test directory>\n")
+        exit(1)
+
+    if not compareData(sys.argv[1]):
+        exit(1)
@@ -0,0 +1,86 @@
+#!/usr/bin/python
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ #
+ ############################################################################################################################################
+ ##
+ ##! \file checkMixed.py
+ #
+ #   \brief Python script to compare solutions computed with mixed precision storage against the double precision baseline
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+import sys
+import numpy as np
+from testUtils import loadData, relativeError
+
+# Maximum relative error permitted between the mixed precision and double precision solutions
+# Scratch arrays in single precision introduce round-off of the order of 1e-7 in each time-step,
+# which should remain far below the discretization error of the test cases
+tolerance = 1.0e-4
+
+def compareData(testDir, timeVal):
+    baseData = loadData(testDir + "/output_double", timeVal)
+    testData = loadData(testDir + "/output_mixed", timeVal)
+
+    testPass = True
+
+    print("")
+    print("Comparing mixed precision solution of " + testDir + " with double precision baseline at t = " + str(timeVal) + "\n")
+
+    for fName in sorted(baseData.keys()):
+        relError = relativeError(fName, baseData[fName], testData[fName])
+        maxError = np.max(np.absolute(testData[fName] - baseData[fName]))
+
+        print("Field " + fName + ": relative L2 error = " + str(relError) + ", maximum absolute error = " + str(maxError) + "\n")
+
+        if relError > tolerance:
+            testPass = False
+
+    if testPass:
+        print("PASSED: Mixed precision solution matches the double precision baseline within tolerance of " + str(tolerance) + "\n")
+    else:
+        print("FAILED: Mixed precision solution differs from the double precision baseline by more than " + str(tolerance) + "\n")
+
+    return testPass
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("Usage: python checkMixed.py <test directory> <time>\n")
+        exit(1)
+
+    if not compareData(sys.argv[1], sys.argv[2]):
+        exit(1)
@@ -0,0 +1,186 @@
+#!/usr/bin/python
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ #
+ ############################################################################################################################################
+ ##
+ ##! \file checkPDF.py
+ #
+ #   \brief Python script to check the PDFs computed during the run for normalization, volume weighting and independence from
+ #          the domain decomposition
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+import os
+import sys
+import glob
+import numpy as np
+import yaml as yl
+from testUtils import loadData
+
+# Maximum deviation of the integral of each PDF from 1, permitted due to the 8 significant digits written in the PDF files
+normTolerance = 1.0e-6
+
+# Maximum relative difference permitted between the PDFs computed with different domain decompositions and thread counts
+# The histograms are summed in a different order, and the PDFs are written with 8 significant digits
+rankTolerance = 1.0e-6
+
+# Maximum fraction of volume permitted to fall in different bins when the PDFs of velocity are recomputed from the solution file
+# Points lying within round-off of a bin edge can be placed in either bin, since the bin limits are read from the PDF file
+binTolerance = 1.0e-3
+
+def readPDF(fileName):
+    pdfData = {}
+
+    with open(fileName, 'r') as f:
+        for line in f:
+            if line.startswith("# Variable:"):
+                # HEADER OF EACH BLOCK: "# Variable: <name>, Band: <band>, Mean: <mean>, Std. dev.: <stdv>"
+                varInfo = dict(item.split(": ") for item in line[2:].strip().split(", "))
+                blockKey = (varInfo["Variable"], varInfo["Band"])
+                pdfData[blockKey] = []
+            elif line.strip() and not line.startswith("#"):
+                pdfData[blockKey].append([float(x) for x in line.split()])
+
+    return dict((key, np.array(val)) for key, val in pdfData.items())
+
+
+def volumeHistogram(fValues, zWeight, binCentres):
+    # RECOMPUTE THE VOLUME WEIGHTED PDF OVER THE BIN LIMITS READ FROM THE PDF FILE
+    binWidth = (binCentres[-1] - binCentres[0])/(len(binCentres) - 1)
+    binStart = binCentres[0] - 0.5*binWidth
+
+    binIndex = np.clip(np.floor((fValues - binStart)/binWidth).astype(int), 0, len(binCentres) - 1)
+    weights = np.broadcast_to(zWeight, fValues.shape)
+
+    hist = np.bincount(binIndex.ravel(), weights=weights.ravel(), minlength=len(binCentres))
+
+    return hist/(np.sum(weights)*binWidth)
+
+
+def checkPDFs(testDir, bandHeight):
+    testPass = True
+
+    paraFile = open(testDir + "/input/parameters.yaml", 'r')
+    yamlData = yl.safe_load(paraFile)
+    paraFile.close()
+
+    zLen = yamlData["Program"]["Z Length"]
+    zMesh = yamlData["Mesh"]["Mesh Type"][2]
+    zBeta = yamlData["Mesh"]["Z Beta"]
+
+    print("")
+    print("Checking PDFs of " + testDir + " computed with 1 and 2 ranks\n")
+
+    baseFiles = sorted(glob.glob(testDir + "/output_pdf_1/pdf_*.dat"))
+    if not baseFiles:
+        print("FAILED: No PDF files found in " + testDir + "/output_pdf_1\n")
+        return False
+
+    for baseName in baseFiles:
+        testName = testDir + "/output_pdf_2/" + os.path.basename(baseName)
+        if not os.path.isfile(testName):
+            print("File " + testName + " is missing\n")
+            testPass = False
+            continue
+
+        basePDF = readPDF(baseName)
+        testPDF = readPDF(testName)
+
+        if sorted(basePDF.keys()) != sorted(testPDF.keys()):
+            print("The variables and bands in " + testName + " do not match those in " + baseName + "\n")
+            testPass = False
+            continue
+
+        # EVERY PDF MUST INTEGRATE TO 1, AND MUST BE THE SAME IRRESPECTIVE OF THE DECOMPOSITION
+        for key in sorted(basePDF.keys()):
+            binWidth = (basePDF[key][-1, 0] - basePDF[key][0, 0])/(len(basePDF[key]) - 1)
+            pdfIntegral = np.sum(testPDF[key][:, 1])*binWidth
+            rankError = np.max(np.absolute(testPDF[key] - basePDF[key]))/np.max(np.absolute(basePDF[key]))
+
+            print(os.path.basename(baseName) + ", " + key[0] + ", " + key[1] + ": integral = " + str(pdfIntegral) +
+                  ", relative difference between 1 and 2 ranks = " + str(rankError) + "\n")
+
+            if abs(pdfIntegral - 1.0) > normTolerance or rankError > rankTolerance:
+                testPass = False
+
+        # RECOMPUTE THE PDFS OF VELOCITY FROM THE SOLUTION FILE WRITTEN AT THE SAME TIME, TO CHECK THE VOLUME WEIGHTS AND THE BANDS
+        timeVal = os.path.basename(baseName)[4:-4]
+        if not os.path.isfile(testDir + "/output_pdf_1/Soln_" + timeVal + ".h5"):
+            continue
+
+        solnData = loadData(testDir + "/output_pdf_1", timeVal, ['Vx', 'Vy', 'Vz', 'Z'])
+        Z = solnData['Z']
+
+        # THE HEIGHT OF EACH CELL IS PROPORTIONAL TO THE INVERSE OF THE GRID DERIVATIVE, AND THE CONSTANT FACTOR CANCELS ON NORMALIZING
+        if zMesh == 'D':
+            zWeight = 1.0 - ((1.0 - 2.0*Z/zLen)*np.tanh(zBeta))**2
+        else:
+            zWeight = np.ones_like(Z)
+
+        if bandHeight > 0.0:
+            bandMasks = {"Near-wall": (Z < bandHeight) | (Z > zLen - bandHeight), "Bulk": (Z >= bandHeight) & (Z <= zLen - bandHeight)}
+        else:
+            bandMasks = {"Full domain": np.ones_like(Z, dtype=bool)}
+
+        for fName in ['Vx', 'Vy', 'Vz']:
+            for bName in sorted(bandMasks.keys()):
+                binCentres = basePDF[(fName, bName)][:, 0]
+                binWidth = (binCentres[-1] - binCentres[0])/(len(binCentres) - 1)
+
+                solnPDF = volumeHistogram(solnData[fName][:, :, bandMasks[bName]], zWeight[bandMasks[bName]], binCentres)
+                binError = 0.5*np.sum(np.absolute(solnPDF - basePDF[(fName, bName)][:, 1]))*binWidth
+
+                print(os.path.basename(baseName) + ", " + fName + ", " + bName + ": fraction of volume in different bins from solution file = " +
+                      str(binError) + "\n")
+
+                if binError > binTolerance:
+                    testPass = False
+
+    if testPass:
+        print("PASSED: PDFs are normalized, independent of the decomposition, and match the PDFs computed from the solution\n")
+    else:
+        print("FAILED: PDFs are not normalized, depend on the decomposition, or differ from the PDFs computed from the solution\n")
+
+    return testPass
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("Usage: python checkPDF.py <test directory> <band height>\n")
+        exit(1)
+
+    if not checkPDFs(sys.argv[1], float(sys.argv[2])):
+        exit(1)
@@ -0,0 +1,191 @@
+#!/usr/bin/python
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ #
+ ############################################################################################################################################
+ ##
+ ##! \file checkRender.py
+ #
+ #   \brief Python script to decode the PNG slices written by the renderer and compare them against the PPM slices
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+import os
+import sys
+import glob
+import zlib
+import struct
+import numpy as np
+
+pngSignature = b'\x89PNG\r\n\x1a\n'
+
+def readPPM(fileName):
+    with open(fileName, 'rb') as f:
+        fData = f.read()
+
+    # THE HEADER IS WRITTEN AS "P6\n<width> <height>\n255\n"
+    magic, imgSize, maxVal, rgbData = fData.split(b'\n', 3)
+    width, height = [int(x) for x in imgSize.split()]
+
+    if magic != b'P6' or int(maxVal) != 255 or len(rgbData) != 3*width*height:
+        print("Invalid PPM file " + fileName + "\n")
+        return None
+
+    return np.frombuffer(rgbData, dtype=np.uint8).reshape(height, width, 3)
+
+
+def readPNG(fileName):
+    with open(fileName, 'rb') as f:
+        fData = f.read()
+
+    if fData[:8] != pngSignature:
+        print("Invalid PNG signature in " + fileName + "\n")
+        return None
+
+    # SPLIT THE FILE INTO CHUNKS AND CHECK THE CRC OF EACH
+    chunks = {}
+    fPos = 8
+    while fPos < len(fData):
+        cLen = struct.unpack('>I', fData[fPos:fPos + 4])[0]
+        cType = fData[fPos + 4:fPos + 8]
+        cData = fData[fPos + 8:fPos + 8 + cLen]
+        cCRC = struct.unpack('>I', fData[fPos + 8 + cLen:fPos + 12 + cLen])[0]
+
+        if zlib.crc32(cType + cData) & 0xFFFFFFFF != cCRC:
+            print("CRC mismatch in chunk " + cType.decode() + " of " + fileName + "\n")
+            return None
+
+        chunks[cType] = cData
+        fPos += 12 + cLen
+
+    for cType in [b'IHDR', b'PLTE', b'IDAT', b'IEND']:
+        if cType not in chunks:
+            print("Chunk " + cType.decode() + " missing in " + fileName + "\n")
+            return None
+
+    width, height, bitDepth, colourType = struct.unpack('>IIBB', chunks[b'IHDR'][:10])
+    if bitDepth != 8 or colourType != 3:
+        print("Unexpected bit depth or colour type in " + fileName + "\n")
+        return None
+
+    # DECOMPRESS THE IMAGE DATA, AND CHECK THE ADLER-32 CHECKSUM STORED AT THE END OF THE ZLIB STREAM
+    zData = chunks[b'IDAT']
+    try:
+        rawData = zlib.decompress(zData)
+    except zlib.error as zErr:
+        print("Unable to decompress image data of " + fileName + ": " + str(zErr) + "\n")
+        return None
+
+    if zlib.adler32(rawData) & 0xFFFFFFFF != struct.unpack('>I', zData[-4:])[0]:
+        print("Adler-32 mismatch in " + fileName + "\n")
+        return None
+
+    if len(rawData) != height*(width + 1):
+        print("Unexpected size of image data in " + fileName + "\n")
+        return None
+
+    # UNDO THE SUB FILTER OF EACH ROW, AND MAP THE INDICES TO COLOURS USING THE PALETTE
+    rows = np.frombuffer(rawData, dtype=np.uint8).reshape(height, width + 1)
+    if np.any(rows[:, 0] != 1):
+        print("Unexpected filter type in " + fileName + "\n")
+        return None
+
+    indices = np.cumsum(rows[:, 1:], axis=1, dtype=np.uint64) % 256
+    palette = np.frombuffer(chunks[b'PLTE'], dtype=np.uint8).reshape(-1, 3)
+
+    return palette[indices.astype(np.intp)]
+
+
+def readPIL(fileName):
+    # DECODE THE PNG FILE INDEPENDENTLY WITH PIL WHEN IT IS AVAILABLE
+    try:
+        from PIL import Image
+    except ImportError:
+        return None
+
+    return np.array(Image.open(fileName).convert('RGB'))
+
+
+def compareImages(testDir):
+    testPass = True
+
+    print("")
+    print("Comparing PNG slices of " + testDir + " against the PPM slices\n")
+
+    ppmFiles = sorted(glob.glob(testDir + "/output_render_1/slice_*.ppm"))
+    if not ppmFiles:
+        print("FAILED: No rendered slices found in " + testDir + "/output_render_1\n")
+        return False
+
+    for ppmName in ppmFiles:
+        pngName = testDir + "/output_render_2/" + os.path.basename(ppmName)[:-4] + ".png"
+
+        if not os.path.isfile(pngName):
+            print("File " + pngName + " is missing\n")
+            testPass = False
+            continue
+
+        ppmImage = readPPM(ppmName)
+        pngImage = readPNG(pngName)
+
+        if ppmImage is None or pngImage is None or ppmImage.shape != pngImage.shape:
+            testPass = False
+            continue
+
+        numDiff = np.count_nonzero(np.any(ppmImage != pngImage, axis=2))
+        print("Slice " + os.path.basename(pngName) + ": " + str(numDiff) + " pixels differ from the PPM image\n")
+        if numDiff:
+            testPass = False
+
+        pilImage = readPIL(pngName)
+        if pilImage is not None and not np.array_equal(pilImage, ppmImage):
+            print("Slice " + os.path.basename(pngName) + " decoded with PIL differs from the PPM image\n")
+            testPass = False
+
+    if testPass:
+        print("PASSED: PNG slices are valid and identical to the PPM slices\n")
+    else:
+        print("FAILED: PNG slices are invalid or differ from the PPM slices\n")
+
+    return testPass
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("Usage: python checkRender.py <test directory>\n")
+        exit(1)
+
+    if not compareImages(sys.argv[1]):
+        exit(1)
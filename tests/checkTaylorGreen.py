@@ -0,0 +1,94 @@
+#!/usr/bin/python
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ #
+ ############################################################################################################################################
+ ##
+ ##! \file checkTaylorGreen.py
+ #
+ #   \brief Python script to compare the decay of 2D Taylor-Green vortices with the analytic solution
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+import sys
+import numpy as np
+from testUtils import loadData, relativeError
+
+# Maximum relative error permitted between the computed and analytic velocity fields
+# The vortices keep their shape while decaying, and the error is dominated by the second-order error in tracing the departure
+# points, which grows with the Courant number. The tolerance allows for this error at Courant numbers near 2 with 128 points per wavelength
+tolerance = 2.0e-2
+
+def compareData(testDir, outDir, timeVal, Re):
+    initData = loadData(testDir + "/" + outDir, 0.0, ['Vx', 'Vz'])
+    testData = loadData(testDir + "/" + outDir, timeVal, ['Vx', 'Vz'])
+
+    # The initial condition is u = sin(kx)cos(kz), w = -cos(kx)sin(kz) with k = 2*pi/L, which decays as exp(-2*k*k*t/Re)
+    # The domain is a unit square, and the analytic solution is hence the initial field scaled by the decay factor
+    kWave = 2.0*np.pi
+    decayFactor = np.exp(-2.0*kWave*kWave*float(timeVal)/float(Re))
+
+    testPass = True
+
+    print("")
+    print("Comparing solution of " + testDir + " in " + outDir + " with decaying Taylor-Green vortices at t = " + str(timeVal) + "\n")
+
+    for fName in sorted(initData.keys()):
+        anlData = decayFactor*initData[fName]
+
+        relError = relativeError(fName, anlData, testData[fName])
+        maxValue = np.max(np.absolute(testData[fName]))
+        maxLimit = np.max(np.absolute(anlData))*(1.0 + tolerance)
+
+        print("Field " + fName + ": relative L2 error = " + str(relError) + ", maximum magnitude = " + str(maxValue) + ", analytic maximum = " + str(np.max(np.absolute(anlData))) + "\n")
+
+        if relError > tolerance or maxValue > maxLimit or not np.all(np.isfinite(testData[fName])):
+            testPass = False
+
+    if testPass:
+        print("PASSED: Solution matches the analytic decay of Taylor-Green vortices within tolerance of " + str(tolerance) + "\n")
+    else:
+        print("FAILED: Solution is unbounded, or differs from the analytic decay of Taylor-Green vortices by more than " + str(tolerance) + "\n")
+
+    return testPass
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 5:
+        print("Usage: python checkTaylorGreen.py <test directory> <output folder> <time> <Reynolds number>\n")
+        exit(1)
+
+    if not compareData(sys.argv[1], sys.argv[2], sys.argv[3], sys.argv[4]):
+        exit(1)
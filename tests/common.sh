@@ -0,0 +1,107 @@
+#!/bin/bash
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ #
+ ############################################################################################################################################
+ ##
+ ##! \file common.sh
+ #
+ #   \brief Shell functions shared by the test scripts to compile SARAS and run the test cases
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+# The functions below must be called from the tests directory, and they return to it when done.
+# Number of MPI ranks used for running the test cases, unless set by the calling script
+PROC=${PROC:-4}
+
+# Function to compile SARAS with given cmake flags, and move the executable to the given test directory
+buildCase () {
+    TESTDIR=$1
+    shift 1
+
+    # Remove pre-existing executable
+    rm -f $TESTDIR/saras
+
+    # If build directory doesn't exist, create it
+    if [ ! -d build ]; then
+        mkdir build
+    fi
+
+    # Switch to build directory
+    cd build
+
+    # Run cmake with necessary flags for the test
+    CC=mpicc CXX=mpicxx cmake ../../ "$@"
+
+    # Compile
+    make -j8
+
+    # Move the executable to the directory where the test will be performed
+    mv ../../saras ../../tests/$TESTDIR/
+    cd ../
+}
+
+# Function to run the test case in the given directory, and move its output to the given folder
+# The log of the run is saved as log.txt inside this folder
+# Any further arguments are parameters to be changed in the input file for this run, given as "Key: value" pairs
+# The input file is restored after the run
+runCase () {
+    TESTDIR=$1
+    OUTDIR=$2
+    shift 2
+
+    # Switch to test directory and set the parameters for this run
+    cd $TESTDIR
+    cp input/parameters.yaml input/parameters.yaml.orig
+
+    for PARAM in "$@"; do
+        sed -i "s/\"${PARAM%%: *}\": .*/\"${PARAM%%: *}\": ${PARAM#*: }/" input/parameters.yaml
+    done
+
+    # Run the test case
+    rm -rf $OUTDIR output/*
+    mpirun -np $PROC ./saras | tee log.txt
+    mv output $OUTDIR
+    mv log.txt $OUTDIR/
+    mkdir output
+
+    mv input/parameters.yaml.orig input/parameters.yaml
+    cd ../
+}
+
+# Function to remove the executable from the given test directory once all its runs are complete
+cleanCase () {
+    rm -f $1/saras
+}
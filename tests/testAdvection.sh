@@ -0,0 +1,84 @@
+#!/bin/bash
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ #
+ ##! \file testAdvection.sh
+ #
+ #   \brief Shell script to compare runs with the finite-difference and semi-Lagrangian advection schemes
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+# The 2D LDC and 3D channel flow tests are run twice - first with the finite-difference advection scheme,
+# and then with the semi-Lagrangian scheme. Both schemes must converge to the same solution within the discretization error.
+# Thereafter, decaying Taylor-Green vortices are solved in a periodic square with the semi-Lagrangian scheme at a Courant number
+# above 1, where the finite-difference scheme is unstable. This is done with both integration schemes, and the solutions are
+# compared with the analytic decay of the vortices.
+source common.sh
+
+# Parameters of the LDC test which are changed to solve decaying Taylor-Green vortices on a uniform periodic grid of 128 x 128 points
+# The fixed time-step gives a CFL number of 1.6, and the pads are sized for a Courant number of 2
+TGV_PARAMS=("Problem Type: 2" "Initial Condition: 1" 'Domain Type: "PPP"' 'Mesh Type: "UUU"' "Advection Scheme: 2"
+            "Use CFL Condition: false" "Courant Number: 2.0" "Time-Step: 0.0125" "Final Time: 2.5"
+            "Solution Write Interval: 2.5" "Restart Write Interval: 2.5")
+
+buildCase ldcTest -DPLANAR=ON
+
+# Run the LDC test case first with finite-difference and then with semi-Lagrangian advection
+for SCHEME in 1 2; do
+    runCase ldcTest output_advection_$SCHEME "Advection Scheme: $SCHEME"
+done
+
+# Run the Taylor-Green vortices first with Euler-CN and then with RK3 integration
+for SCHEME in 1 2; do
+    runCase ldcTest output_tgv_$SCHEME "${TGV_PARAMS[@]}" "Integration Scheme: $SCHEME"
+done
+cleanCase ldcTest
+
+buildCase channelTest
+
+# Run the channel flow test case first with finite-difference and then with semi-Lagrangian advection
+for SCHEME in 1 2; do
+    runCase channelTest output_advection_$SCHEME "Advection Scheme: $SCHEME"
+done
+cleanCase channelTest
+
+# Run the python scripts to compare the solutions of both advection schemes, and the Taylor-Green vortices with the analytic solution
+STATUS=0
+python checkAdvection.py ldcTest 30.0 || STATUS=1
+python checkAdvection.py channelTest 20.0 || STATUS=1
+python checkTaylorGreen.py ldcTest output_tgv_1 2.5 1000 || STATUS=1
+python checkTaylorGreen.py ldcTest output_tgv_2 2.5 1000 || STATUS=1
+
+exit $STATUS
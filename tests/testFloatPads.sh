@@ -0,0 +1,65 @@
+#!/bin/bash
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ #
+ ############################################################################################################################################
+ ##
+ ##! \file testFloatPads.sh
+ #
+ #   \brief Shell script to compare the multigrid solver with and without single precision pads during smoothing
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+# The 3D Poisson test is run twice - first with all pads exchanged at full precision, and then with the pads exchanged
+# in single precision during smoothing at the coarser levels of the V-Cycle.
+# The residuals after each V-Cycle and the deviations from the analytic solution of both runs are then compared.
+source common.sh
+
+buildCase mgTest -DTEST_POISSON=ON
+
+# Run the test case without and with single precision pads
+for FLAG in false true; do
+    runCase mgTest output_float_$FLAG "Float Smoother Pads: $FLAG"
+done
+cleanCase mgTest
+
+# List the wall time of both runs
+echo
+echo "Time taken by simulation (full precision pads | single precision pads)"
+paste <(grep "Time taken by simulation" mgTest/output_float_false/log.txt | awk '{print $NF}') \
+      <(grep "Time taken by simulation" mgTest/output_float_true/log.txt | awk '{print $NF}')
+
+# Run the python script to compare the convergence and accuracy of both runs
+python checkFloatPads.py mgTest
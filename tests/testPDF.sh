@@ -0,0 +1,61 @@
+#!/bin/bash
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ##! \file testPDF.sh
+ #
+ #   \brief Shell script to check the PDFs computed during the run, with different domain decompositions
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+# The 3D channel flow test is run for a short duration with PDFs conditioned on height, first on 1 rank with 1 thread,
+# and then on 2 ranks with 2 threads each. The PDFs of both runs must integrate to 1 and must match each other.
+# The PDFs of velocity are also recomputed from the solution file written at the same time, using the stretched grid
+# to weight each point by the volume of its cell, and compared against the PDFs written by the solver.
+source common.sh
+
+BAND_HEIGHT=0.2
+
+PDF_PARAMS=("Final Time: 1.0" "Solution Write Interval: 0.5" "Restart Write Interval: 1.0"
+            "Record PDFs: true" "PDF Time Interval: 0.5" "PDF Band Height: $BAND_HEIGHT")
+
+buildCase channelTest
+
+# Run the test case first on 1 rank, and then with the sub-domain split into 2 along X
+PROC=1 runCase channelTest output_pdf_1 "${PDF_PARAMS[@]}" "X Number of Procs: 1" "Y Number of Procs: 1" "Number of OMP threads: 1"
+PROC=2 runCase channelTest output_pdf_2 "${PDF_PARAMS[@]}" "X Number of Procs: 2" "Y Number of Procs: 1" "Number of OMP threads: 2"
+cleanCase channelTest
+
+# Run the python script to check the PDFs of both runs
+python checkPDF.py channelTest $BAND_HEIGHT
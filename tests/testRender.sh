@@ -0,0 +1,60 @@
+#!/bin/bash
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ##! \file testRender.sh
+ #
+ #   \brief Shell script to check the PNG images written by the in-situ renderer against the PPM images
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+# The 2D LDC test is run for a short duration with slice rendering, first writing PPM and then PNG images.
+# Since both runs are identical, every PNG image must decode to the same pixels as the PPM image written at the same time.
+# The CRC of each PNG chunk and the Adler-32 checksum of the compressed image data are verified while decoding.
+source common.sh
+
+# The colour map limits are fixed so that the full range of the colour map is exercised by the velocity magnitude
+RENDER_PARAMS=("Final Time: 1.0" "Solution Write Interval: 1.0" "Restart Write Interval: 1.0"
+               "Render Slices: true" "Render Time Interval: 0.25" "Render Minimum: 0.0" "Render Maximum: 1.0")
+
+buildCase ldcTest -DPLANAR=ON
+
+# Run the test case first writing PPM and then PNG images
+for FORMAT in 1 2; do
+    runCase ldcTest output_render_$FORMAT "${RENDER_PARAMS[@]}" "Image Format: $FORMAT"
+done
+cleanCase ldcTest
+
+# Run the python script to decode the PNG images and compare them with the PPM images
+python checkRender.py ldcTest
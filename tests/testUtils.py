@@ -0,0 +1,76 @@
+#!/usr/bin/python
+
+#############################################################################################################################################
+ # Saras
+ # 
+ # Copyright (C) 2019, Mahendra K. Verma
+ #
+ # All rights reserved.
+ # 
+ # Redistribution and use in source and binary forms, with or without
+ # modification, are permitted provided that the following conditions are met:
+ #     1. Redistributions of source code must retain the above copyright
+ #        notice, this list of conditions and the following disclaimer.
+ #     2. Redistributions in binary form must reproduce the above copyright
+ #        notice, this list of conditions and the following disclaimer in the
+ #        documentation and/or other materials provided with the distribution.
+ #     3. Neither the name of the copyright holder nor the
+ #        names of its contributors may be used to endorse or promote products
+ #        derived from this software without specific prior written permission.
+ # 
+ # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ # ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ # WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ # DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ # ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ # (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ # LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ # ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ #
+ ############################################################################################################################################
+ ##
+ ##! \file testUtils.py
+ #
+ #   \brief Python functions shared by the test scripts to read and compare solution files
+ #
+ #   \author Roshan Samuel
+ #   \date Jan 2020
+ #   \copyright New BSD License
+ #
+ ############################################################################################################################################
+ ##
+
+import numpy as np
+import h5py as hp
+
+def loadData(folderName, timeVal, fieldList = ['Vx', 'Vy', 'Vz', 'P']):
+    fileName = folderName + "/Soln_{0:09.4f}.h5".format(float(timeVal))
+
+    try:
+        f = hp.File(fileName, 'r')
+    except:
+        print("Could not open file " + fileName + "\n")
+        exit(1)
+
+    fieldData = {}
+    for fName in fieldList:
+        if fName in f:
+            fieldData[fName] = np.array(f[fName])
+
+    f.close()
+
+    return fieldData
+
+
+def relativeError(fName, fBase, fTest):
+    # Pressure is determined only up to a constant, so its mean is removed before comparison
+    if fName == 'P':
+        fBase = fBase - np.mean(fBase)
+        fTest = fTest - np.mean(fTest)
+
+    errNorm = np.linalg.norm(fTest - fBase)
+    refNorm = np.linalg.norm(fBase)
+
+    return errNorm/refNorm if refNorm > 0.0 else errNorm